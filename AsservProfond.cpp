@@ -1,60 +1,207 @@
 #include "CommandMotor.h"
 #include "Capteurs.h"
 #include "AsservProfond.h"
+#include "Journal.h"
 
 AsservProfond::AsservProfond(CommandMotor* motorPtr, Capteurs* capteursPtr) {
     _motor = motorPtr;
     _capteurs = capteursPtr;
     
     // Le gain doit être positif si (Angle ++ => On descend)
-    _gainProportionnel = 30.0f; // Augmenté car on travaille sur une plage réduite
-    _angleNeutre = 30.0f;       // Correspond à ballastEquilibre()
+    _loi.kp          = ReelAsserv(30);   // Augmenté car on travaille sur une plage réduite
+    _loi.ki          = ReelAsserv(10);   // rattrape un défaut de trim (deg par m.s)
+    _loi.kd          = ReelAsserv(90);   // amortit la vitesse verticale (deg par m/s), seul terme d'anticipation
+    _loi.neutre      = ReelAsserv(30);   // Correspond à ballastEquilibre()
+    _loi.integrale   = ReelAsserv(0);
+    _filtreDerivee_s = fraction<ReelAsserv>(2, 10);   // ~4 échantillons MS5837 à 20 Hz
+    _vitesse_mps     = ReelAsserv(0);
+    _profPrecedente  = ReelAsserv(0);
+    _derniereConsigne = ReelAsserv(-1);
 }
 
 float AsservProfond::getProfondeur() {
     return _capteurs->getDepthData().depth_m; 
 }
 
-void AsservProfond::setServoAngle(float angle) {
-    _motor->setServoAngle(angle); 
+void AsservProfond::setServoAngle(ReelAsserv angle) {
+    _motor->commandeServo(angle);
 }
 
-// Limites physiques du servo (selon CommandMotor.cpp)
-#define ANGLE_MIN 0.0f
-#define ANGLE_MAX 360.0f 
-#define PROFONDEUR_MAX 10.0f // Sécurité : n'essayez pas d'aller trop profond
+void AsservProfond::setGainProportionnel(float kp) {
+    _loi.kp = reel<ReelAsserv>(kp);
+    _derniereConsigne = ReelAsserv(-1);   // recalcul au prochain appel
+}
+
+void AsservProfond::setGains(float kp, float ki, float kd) {
+    _loi.kp = reel<ReelAsserv>(kp);
+    _loi.ki = reel<ReelAsserv>(ki);
+    _loi.kd = reel<ReelAsserv>(kd);
+    _derniereConsigne = ReelAsserv(-1);
+}
+
+void AsservProfond::setFiltreDerivee(float tf_s) {
+    _filtreDerivee_s = reel<ReelAsserv>((tf_s < 0.0f) ? 0.0f : tf_s);
+}
+
+void AsservProfond::setAngleNeutre(float angle) {
+    _loi.neutre = reel<ReelAsserv>(angle);
+    _derniereConsigne = ReelAsserv(-1);
+}
+
+// Limites physiques du servo (CommandMotor::setServoAngle borne à [0 ; 180])
+#define ANGLE_MIN 0
+#define ANGLE_MAX 180
+#define PROFONDEUR_MAX 10 // Sécurité : n'essayez pas d'aller trop profond
+
+// Au-delà, la dernière profondeur n'est plus considérée comme valide
+static const uint32_t kProfondeurPerimeeMs = 500;
+
+// Écart entre deux échantillons au-delà duquel I et D ne sont pas mis à jour
+// (capteur qui a sauté des cycles) : on repart de la mesure courante
+static const uint32_t kDtMax_ms = 500;
+
+// Autorité du terme intégral (défaut de trim rattrapable), en degrés
+static const int kIntegraleMax_deg = 45;
+
+// L'intégrale n'apprend le trim qu'aux abords de la consigne (cm) ou poisson
+// arrêté (cm/s) : pendant une descente, l'écart de plusieurs décimètres la
+// remplirait jusqu'à la borne et la tenue commencerait par un dépassement de
+// même ampleur ; mais un gros défaut de trim immobilise le poisson hors de
+// la zone (P seul l'équilibre), et seul I peut l'en sortir
+static const int kZoneIntegrale_cm   = 10;
+static const int kVitesseArret_cm_s  = 2;
+
+// =====================
+//   Loi PID
+// =====================
+
+template <typename T>
+void LoiPid<T>::reprise(T erreur, T angleActuel)
+{
+    integrale = (T(0) < ki)
+              ? borneReel(angleActuel - neutre - erreur * kp, T(-kIntegraleMax_deg), T(kIntegraleMax_deg))
+              : T(0);
+}
+
+template <typename T>
+T LoiPid<T>::commande(T erreur, T vitesse, T dt)
+{
+    T P = erreur * kp;
+    T D = -(kd * vitesse);
+
+    // Intégrale conditionnelle (anti-windup) : on n'intègre que près de la
+    // consigne ou à l'arrêt, et pas quand la sortie est en butée et que
+    // l'erreur pousse plus loin dans la butée
+    T zone  = fraction<T>(kZoneIntegrale_cm, 100);
+    T arret = fraction<T>(kVitesseArret_cm_s, 100);
+    T i     = integrale + ki * erreur * dt;
+    T brute = neutre + P + i + D;
+    bool sature  = (T(ANGLE_MAX) < brute && T(0) < erreur) || (brute < T(ANGLE_MIN) && erreur < T(0));
+    bool proche  = (erreur < zone && -zone < erreur) || (vitesse < arret && -arret < vitesse);
+    if (proche && !sature) integrale = borneReel(i, T(-kIntegraleMax_deg), T(kIntegraleMax_deg));
+
+    return borneReel(neutre + P + integrale + D, T(ANGLE_MIN), T(ANGLE_MAX));
+}
+
+template <typename T>
+T LoiPid<T>::filtreVitesse(T vitesse, T brute, T dt, T tf)
+{
+    return vitesse + (brute - vitesse) * dt / (tf + dt);
+}
+
+// Référence float et chemin virgule fixe (comparés par BancPointFixe)
+template struct LoiPid<float>;
+template struct LoiPid<Q16_16>;
+
+// =====================
+//   Tenue de profondeur
+// =====================
 
 void AsservProfond::setProfondeurVoulue(float ProfMetres)
 {
+    typedef ReelAsserv T;
+
     // 1. Sécurité Bornage Consigne
-    if (ProfMetres < 0.0f) ProfMetres = 0.0f;
-    if (ProfMetres > PROFONDEUR_MAX) ProfMetres = PROFONDEUR_MAX;
+    T consigne = borneReel(reel<T>(ProfMetres), T(0), T(PROFONDEUR_MAX));
+
+    // 2. Lecture (instantané cohérent)
+    const DepthData& depth = _capteurs->getDepthData();
 
-    // 2. Lecture
-    float ProfActuelle = getProfondeur(); 
+    // MS5837 muet : on ne suit plus une valeur figée, ballast au neutre
+    if (_capteurs->isDepthStale(kProfondeurPerimeeMs)) {
+        if (!_profondeurPerimee) {
+            LOG_ALERTE("Asserv", "Profondeur perimee -> ballast neutre");
+            _profondeurPerimee = true;
+            _actif = false;   // reprise sans à-coup depuis le neutre (_enTenue gardé)
+            setServoAngle(_loi.neutre);
+        }
+        return;
+    }
+    _profondeurPerimee = false;
+
+    // Rien de nouveau (même échantillon, même consigne) : commande inchangée
+    bool nouvelEchantillon = (depth.seq != _dernierSeqProfondeur);
+    if (!nouvelEchantillon && consigne == _derniereConsigne && _actif) return;
+    _dernierSeqProfondeur = depth.seq;
+    _derniereConsigne     = consigne;
+
+    // Avec l'estimateur : profondeur filtrée pour P et I, vitesse estimée
+    // pour D. Pas la profondeur prédite : elle contient déjà kp.v.horizon,
+    // la vitesse compterait deux fois (P et D) et I intégrerait une
+    // erreur anticipée au lieu du défaut de trim réel. L'anticipation du
+    // retard crémaillère + ballast est portée par kd seul.
+    // Sans : mesure brute et dérivée filtrée ci-dessous.
+    // Valeurs publiées dans le type du calcul : aucune conversion par tick.
+    bool estime       = depth.estimationValide;
+    T    profMesuree  = grandeur<T>(depth.depth_m, depth.depth_q);
+    T    ProfActuelle = estime ? grandeur<T>(depth.profondeurFiltree_m, depth.profondeurFiltree_q) : profMesuree;
 
     // 3. Calcul Erreur (Consigne - Mesure)
     // Ex: Veut 5m, est à 2m => Erreur = 3m (doit descendre)
-    float erreur = ProfMetres - ProfActuelle;
+    // Si on doit descendre (erreur > 0), on ajoute de l'angle (vers 180 = Remplir)
+    // Si on doit monter (erreur < 0), on enlève de l'angle (vers 0 = Vider)
+    T erreur = consigne - ProfActuelle;
+
+    // 4. Début de tenue : l'intégrale part du trim appris (nulle au
+    // démarrage). Capteur revenu en cours de tenue : la sortie repart de
+    // l'angle actuel (transfert sans choc)
+    if (!_actif) {
+        _actif          = true;
+        _vitesse_mps    = estime ? grandeur<T>(depth.vitesseVerticale_mps, depth.vitesseVerticale_q) : T(0);
+        _profPrecedente = profMesuree;
+        _tPrecedent_ms  = depth.t_ms;
+        if (_enTenue) _loi.reprise(erreur, _motor->angleServo());
+        _enTenue        = true;
+        nouvelEchantillon = false;
+    }
 
-    // 4. Commande P (Proportionnelle)
-    // AngleNeutre (30°) + (3m * Gain)
-    // Si on doit descendre (erreur > 0), on ajoute de l'angle (vers 180 = Remplir) -> CORRECT
-    // Si on doit monter (erreur < 0), on enlève de l'angle (vers 0 = Vider) -> CORRECT
-    float commandeAngle = _angleNeutre + (erreur * _gainProportionnel);
+    // 5. Dérivée sur la mesure (pas sur l'erreur : pas de pic au changement
+    // de consigne), filtrée 1er ordre, dt mesuré entre deux échantillons
+    T dt = T(0);
+    if (nouvelEchantillon) {
+        uint32_t dt_ms = depth.t_ms - _tPrecedent_ms;
+        if (dt_ms > 0 && dt_ms <= kDtMax_ms) {
+            dt = fraction<T>((int32_t)dt_ms, 1000);
+            if (estime) {
+                _vitesse_mps = grandeur<T>(depth.vitesseVerticale_mps, depth.vitesseVerticale_q);
+            } else {
+                T brute = (profMesuree - _profPrecedente) / dt;
+                _vitesse_mps = LoiPid<T>::filtreVitesse(_vitesse_mps, brute, dt, _filtreDerivee_s);
+            }
+        }
+        _profPrecedente = profMesuree;
+        _tPrecedent_ms  = depth.t_ms;
+    }
 
-    // 5. Bornage final
-    if (commandeAngle < ANGLE_MIN) commandeAngle = ANGLE_MIN;
-    if (commandeAngle > ANGLE_MAX) commandeAngle = ANGLE_MAX;
+    // 6. PID, anti-windup et bornage final
+    T commandeAngle = _loi.commande(erreur, _vitesse_mps, dt);
 
-    // 6. Envoi
+    // 7. Envoi
     setServoAngle(commandeAngle);
     
-    // Debug optionnel pour voir ce qui se passe
-    /*
-    Serial.print("Cible: "); Serial.print(ProfMetres);
-    Serial.print(" Actuel: "); Serial.print(ProfActuelle);
-    Serial.print(" Err: "); Serial.print(erreur);
-    Serial.print(" Cmd: "); Serial.println(commandeAngle);
-    */
+    // Debug (compilé seulement avec -DJOURNAL_NIVEAU=JOURNAL_DEBUG)
+    LOG_DEBUG("Asserv", "Cible: %ld mm Actuel: %ld mm Err: %ld mm I: %d Cmd: %d deg",
+              (long)(versFloat(consigne) * 1000.0f), (long)(versFloat(ProfActuelle) * 1000.0f),
+              (long)(versFloat(erreur) * 1000.0f), (int)versFloat(_loi.integrale),
+              (int)versFloat(commandeAngle));
 }
@@ -4,8 +4,32 @@
 // Inclusion des dépendances nécessaires
 #include "CommandMotor.h"
 #include "Capteurs.h"
+#include "PointFixe.h"
 #include <Arduino.h> // Souvent nécessaire pour les types comme 'byte' ou 'float' sur microcontrôleur
 
+// Loi PID sur un échantillon, écrite une fois pour float (référence) et
+// virgule fixe (chemin embarqué, cf. POINT_FIXE). Angles en degrés,
+// profondeurs en mètres (+ = vers le fond), dt en secondes.
+template <typename T>
+struct LoiPid
+{
+    T kp;         // deg/m
+    T ki;         // deg/(m.s)
+    T kd;         // deg.s/m
+    T neutre;     // angle servo de flottabilité nulle supposée
+    T integrale;  // terme intégral, en degrés
+
+    // Reprise sans à-coup : l'intégrale absorbe l'écart pour que la sortie
+    // parte de angleActuel (sans terme intégral, rien ne le résorberait)
+    void reprise(T erreur, T angleActuel);
+
+    // Angle servo borné [0 ; 180] ; dt = 0 : pas d'intégration
+    T commande(T erreur, T vitesse, T dt);
+
+    // Dérivée de la mesure filtrée 1er ordre (constante de temps tf)
+    static T filtreVitesse(T vitesse, T brute, T dt, T tf);
+};
+
 class AsservProfond {
 public:
     /**
@@ -16,16 +40,37 @@ public:
     AsservProfond(CommandMotor* motorPtr, Capteurs* capteursPtr);
 
     /**
-     * Méthode principale d'asservissement.
-     * Calcule l'erreur et envoie la commande au servo.
+     * Méthode principale d'asservissement (PID).
+     * Recalcule la commande à chaque nouvel échantillon de profondeur
+     * (dt mesuré entre échantillons) ou changement de consigne.
      * @param ProfMetres : La profondeur cible en mètres.
      */
     void setProfondeurVoulue(float ProfMetres);
 
+    /**
+     * Fin de tenue de profondeur (remontée, urgence, arrêt).
+     * La prochaine tenue repart du trim appris (intégrale conservée, nulle
+     * au démarrage), pas de l'angle servo courant : parqué à 90° ou vidé,
+     * il ne dit rien de la flottabilité.
+     */
+    void arrete() { _actif = false; _enTenue = false; }
+
     // --- Setters pour le réglage dynamique (optionnel mais recommandé) ---
     
     // Pour changer le gain Kp sans re-téléverser le code
     void setGainProportionnel(float kp); 
+
+    // Gains PID : kp en deg/m, ki en deg/(m.s), kd en deg.s/m.
+    // Changer ki ne fait pas sauter la sortie (l'intégrale est stockée en degrés).
+    void setGains(float kp, float ki, float kd);
+    // Constante de temps du filtre de la dérivée (s), si pas d'estimateur vertical
+    void setFiltreDerivee(float tf_s);
+
+    float getKp() const { return versFloat(_loi.kp); }
+    float getKi() const { return versFloat(_loi.ki); }
+    float getKd() const { return versFloat(_loi.kd); }
+    float getFiltreDerivee() const { return versFloat(_filtreDerivee_s); }
+    float getIntegrale() const { return versFloat(_loi.integrale); }
     
     // Pour ajuster le "zéro" du servo
     void setAngleNeutre(float angle);
@@ -35,20 +80,26 @@ private:
     CommandMotor* _motor;
     Capteurs* _capteurs;
 
-    // --- Paramètres de l'asservissement ---
-    float _gainProportionnel; // Kp
-    float _angleNeutre;       // Angle pour maintenir la position (ex: 180°)
-    
-    // --- Constantes de sécurité ---
-    // (Peuvent être statiques si elles ne changent jamais pour aucune instance)
-    const float _profondeurMax = 180.0f;
-    const float _angleMin = 0.0f;
-    const float _angleMax = 360.0f;
+    // --- Paramètres et état de l'asservissement ---
+    LoiPid<ReelAsserv> _loi;       // gains, neutre, intégrale
+    ReelAsserv _filtreDerivee_s;   // constante de temps du filtre de la dérivée
+
+    // --- État du PID ---
+    bool       _actif = false;     // false : prochain calcul = (re)prise
+    bool       _enTenue = false;   // tenue interrompue (capteur muet) : reprise depuis l'angle servo
+    ReelAsserv _vitesse_mps;       // vitesse estimée ou dérivée filtrée (+ = descente)
+    ReelAsserv _profPrecedente;
+    uint32_t   _tPrecedent_ms = 0; // horodatage de l'échantillon précédent
+
+    // --- Dernière commande (pour ne recalculer que sur donnée nouvelle) ---
+    uint32_t   _dernierSeqProfondeur = 0;
+    ReelAsserv _derniereConsigne;
+    bool       _profondeurPerimee = false;
 
     // --- Méthodes internes ---
     // Abstractions pour simplifier le code principal
     float getProfondeur();
-    void setServoAngle(float angle);
+    void setServoAngle(ReelAsserv angle);
 };
 
 #endif // ASSERV_PROFOND_H
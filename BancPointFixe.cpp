@@ -0,0 +1,436 @@
+#include "BancPointFixe.h"
+#include "PointFixe.h"
+#include "AsservProfond.h"
+#include "CommandMotor.h"
+#include "Capteurs.h"
+#include "Safety.h"
+#include "ReponseHttp.h"
+
+static const uint16_t N_APPELS  = 1000;   // appels chronométrés par version
+static const uint8_t  N_ENTREES = 64;     // entrées précalculées, parcourues en boucle
+static const uint16_t N_TRANCHE = 100;    // appels chronométrés par tranche
+static const uint32_t BUDGET_US = 4000;   // durée d'une tranche de calcul d'écart
+
+// Résultats écrits ici : les boucles chronométrées ne sont pas éliminées
+static volatile float    s_puitsFloat;
+static volatile uint32_t s_puitsEntier;
+
+// Suite reproductible (xorshift32) : même banc d'une exécution à l'autre
+static uint32_t s_graine = 1;
+
+static uint32_t aleatoire()
+{
+    s_graine ^= s_graine << 13;
+    s_graine ^= s_graine >> 17;
+    s_graine ^= s_graine << 5;
+    return s_graine;
+}
+
+static float aleatoireEntre(float mini, float maxi)
+{
+    return mini + (maxi - mini) * (float)(aleatoire() >> 8) * (1.0f / 16777216.0f);
+}
+
+// =====================
+//   Reprise entre deux tranches
+// =====================
+
+enum Section : uint8_t { SECTION_PID, SECTION_COULOMB, SECTION_BATTERIE, SECTION_PWM, SECTION_JSON, SECTION_FIN };
+
+static uint8_t  s_section = SECTION_FIN;   // banc en cours
+static uint8_t  s_phase;                   // étape dans le banc
+static uint32_t s_n;                       // itération dans l'étape
+
+// Entrées précalculées, partagées par les bancs (un seul à la fois)
+static float s_entree[3][N_ENTREES];
+
+// Mesures du banc en cours
+static float    s_ecartF, s_ecartQ;
+static uint32_t s_differences, s_essais, s_ecartMax;
+static uint32_t s_flottant_us, s_fixe_us;
+
+static void etapeSuivante()
+{
+    s_n = 0;
+    s_phase++;
+}
+
+static void debutSection(uint8_t section)
+{
+    s_section = section;
+    s_phase = 0;
+    s_n = 0;
+    s_ecartF = s_ecartQ = 0.0f;
+    s_differences = s_essais = s_ecartMax = 0;
+    s_flottant_us = s_fixe_us = 0;
+}
+
+static void sectionSuivante()
+{
+    debutSection(s_section + 1);
+}
+
+// Calcul d'écart : itérations jusqu'à BUDGET_US, reprise à la tranche suivante
+template <typename F>
+static void parcours(uint32_t total, F corps)
+{
+    uint32_t t0 = micros();
+    while (s_n < total) {
+        corps(s_n++);
+        if ((s_n & 15) == 0 && micros() - t0 >= BUDGET_US) return;
+    }
+    etapeSuivante();
+}
+
+// Boucle chronométrée : N_TRANCHE appels par tranche, durées cumulées
+template <typename F>
+static void chronometre(uint32_t& total_us, F corps)
+{
+    uint32_t fin = s_n + N_TRANCHE;
+    uint32_t t0 = micros();
+    for (uint32_t n = s_n; n < fin; n++) corps(n);
+    total_us += micros() - t0;
+    s_n = fin;
+    if (s_n >= N_APPELS) etapeSuivante();
+}
+
+static void afficheDuree(const char* version, uint32_t total_us)
+{
+    float us = (float)total_us / N_APPELS;
+    Serial.print(version);
+    Serial.print(us, 2);
+    Serial.print(" us (");
+    Serial.print((uint32_t)(us * (F_CPU / 1000000UL) + 0.5f));
+    Serial.print(" cycles)");
+}
+
+static void afficheDurees(uint32_t flottant_us, uint32_t fixe_us)
+{
+    afficheDuree(" | float ", flottant_us);
+    afficheDuree(" | fixe ", fixe_us);
+    Serial.println();
+}
+
+// =====================
+//   Loi PID
+// =====================
+
+static LoiPid<float>  s_loiF;
+static LoiPid<Q16_16> s_loiQ;
+
+static void bancPid()
+{
+    float* erreur  = s_entree[0];
+    float* vitesse = s_entree[1];
+    float* dt      = s_entree[2];
+
+    switch (s_phase) {
+    case 0:
+        s_loiF.kp = 30.0f; s_loiF.ki = 10.0f; s_loiF.kd = 80.0f; s_loiF.neutre = 30.0f; s_loiF.integrale = 0.0f;
+        s_loiQ.kp = Q16_16(30); s_loiQ.ki = Q16_16(10); s_loiQ.kd = Q16_16(80); s_loiQ.neutre = Q16_16(30); s_loiQ.integrale = Q16_16(0);
+        for (uint8_t i = 0; i < N_ENTREES; i++) {
+            erreur[i]  = aleatoireEntre(-2.0f, 2.0f);
+            vitesse[i] = aleatoireEntre(-0.3f, 0.3f);
+            dt[i]      = (aleatoire() & 1) ? aleatoireEntre(0.04f, 0.06f) : 0.0f;   // nouvel échantillon ou non
+        }
+        etapeSuivante();
+        break;
+
+    case 1:
+        // Ecart : les deux lois suivent la même suite, intégrale comprise
+        parcours(N_APPELS, [](uint32_t n) {
+            uint8_t i = n % N_ENTREES;
+            float cf = s_loiF.commande(s_entree[0][i], s_entree[1][i], s_entree[2][i]);
+            float cq = s_loiQ.commande(reel<Q16_16>(s_entree[0][i]), reel<Q16_16>(s_entree[1][i]), reel<Q16_16>(s_entree[2][i])).versFloat();
+            float e  = fabsf(cf - cq);
+            if (e > s_ecartF) s_ecartF = e;
+        });
+        break;
+
+    case 2:
+        chronometre(s_flottant_us, [](uint32_t n) {
+            uint8_t i = n % N_ENTREES;
+            s_puitsFloat = s_loiF.commande(s_entree[0][i], s_entree[1][i], s_entree[2][i]);
+        });
+        break;
+
+    case 3:
+        chronometre(s_fixe_us, [](uint32_t n) {
+            uint8_t i = n % N_ENTREES;
+            s_puitsFloat = versFloat(s_loiQ.commande(reel<Q16_16>(s_entree[0][i]), reel<Q16_16>(s_entree[1][i]), reel<Q16_16>(s_entree[2][i])));
+        });
+        break;
+
+    default:
+        Serial.print("[PointFixe] pid      ecart max ");
+        Serial.print(s_ecartF, 4);
+        Serial.print(" deg");
+        afficheDurees(s_flottant_us, s_fixe_us);
+        sectionSuivante();
+        break;
+    }
+}
+
+// =====================
+//   Compteur coulomb
+// =====================
+
+static const float    kCapacite_mAh = 2200.0f;
+static const uint32_t kPas_ms       = 100;     // POWER_BATT à 10 Hz
+static const uint32_t kPas          = 36000;   // 1 h
+
+static CoulombCounter     s_coulombF(kCapacite_mAh);
+static CoulombCounterFixe s_coulombQ(kCapacite_mAh);
+static double             s_reference_mAh;
+
+static void bancCoulomb()
+{
+    switch (s_phase) {
+    case 0:
+        s_coulombF.reset();
+        s_coulombQ.reset();
+        s_reference_mAh = kCapacite_mAh;
+        etapeSuivante();
+        break;
+
+    case 1:
+        parcours(kPas, [](uint32_t) {
+            float courant_mA = aleatoireEntre(50.0f, 2000.0f);
+            s_coulombF.integre(courant_mA, kPas_ms);
+            s_coulombQ.integre(courant_mA, kPas_ms);
+            s_reference_mAh -= (double)courant_mA * kPas_ms / 3600000.0;
+        });
+        break;
+
+    case 2:
+        s_ecartF = (float)((double)s_coulombF.get_soc() * kCapacite_mAh / 100.0 - s_reference_mAh);
+        s_ecartQ = (float)((double)s_coulombQ.get_soc() * kCapacite_mAh / 100.0 - s_reference_mAh);
+        for (uint8_t i = 0; i < N_ENTREES; i++) s_entree[0][i] = aleatoireEntre(50.0f, 2000.0f);
+        etapeSuivante();
+        break;
+
+    case 3:
+        chronometre(s_flottant_us, [](uint32_t n) { s_coulombF.integre(s_entree[0][n % N_ENTREES], kPas_ms); });
+        break;
+
+    case 4:
+        chronometre(s_fixe_us, [](uint32_t n) { s_coulombQ.integre(s_entree[0][n % N_ENTREES], kPas_ms); });
+        break;
+
+    default:
+        Serial.print("[PointFixe] coulomb  1h : float ");
+        Serial.print(s_ecartF, 3);
+        Serial.print(" mAh, fixe ");
+        Serial.print(s_ecartQ, 3);
+        Serial.print(" mAh");
+        afficheDurees(s_flottant_us, s_fixe_us);
+        sectionSuivante();
+        break;
+    }
+}
+
+// =====================
+//   Seuil batterie (Safety)
+// =====================
+
+static void bancSeuilBatterie()
+{
+    static const float kLimites[] = {
+        NAN, INFINITY, -INFINITY, -1.0f, 0.0f, 1e-7f, 14.99999f, 15.0f, 15.00001f,
+        99.9999f, 100.0f, 100.0001f, 1e9f
+    };
+
+    switch (s_phase) {
+    case 0:
+        for (uint8_t i = 0; i < sizeof(kLimites) / sizeof(kLimites[0]); i++, s_essais++) {
+            if (niveauBatterie(kLimites[i]) != niveauBatterie(Q16_16::depuisFloat(kLimites[i]))) s_differences++;
+        }
+        etapeSuivante();
+        break;
+
+    case 1:
+        parcours(N_APPELS, [](uint32_t) {
+            float v = aleatoireEntre(-10.0f, 120.0f);
+            if (niveauBatterie(v) != niveauBatterie(Q16_16::depuisFloat(v))) s_differences++;
+            s_essais++;
+        });
+        break;
+
+    case 2:
+        for (uint8_t i = 0; i < N_ENTREES; i++) s_entree[0][i] = aleatoireEntre(-10.0f, 120.0f);
+        etapeSuivante();
+        break;
+
+    case 3:
+        chronometre(s_flottant_us, [](uint32_t n) { s_puitsEntier = (uint32_t)niveauBatterie(s_entree[0][n % N_ENTREES]); });
+        break;
+
+    case 4:
+        chronometre(s_fixe_us, [](uint32_t n) { s_puitsEntier = (uint32_t)niveauBatterie(Q16_16::depuisFloat(s_entree[0][n % N_ENTREES])); });
+        break;
+
+    default:
+        Serial.print("[PointFixe] batterie differences ");
+        Serial.print(s_differences);
+        Serial.print('/');
+        Serial.print(s_essais);
+        afficheDurees(s_flottant_us, s_fixe_us);
+        sectionSuivante();
+        break;
+    }
+}
+
+// =====================
+//   PWM propulsion
+// =====================
+
+static void bancPwm()
+{
+    switch (s_phase) {
+    case 0:
+        // Balayage de [-0,1 ; 1,1] par pas de 1e-4 : tous les paliers, bornes comprises
+        parcours(12001, [](uint32_t n) {
+            float c = ((int32_t)n - 1000) * 1e-4f;
+            int e = (int)CommandMotor::pwmDepuisCommande(c) - (int)CommandMotor::pwmDepuisCommande(Q8_24::depuisFloat(c));
+            if (e) s_differences++;
+            if ((uint32_t)abs(e) > s_ecartMax) s_ecartMax = abs(e);
+            s_essais++;
+        });
+        break;
+
+    case 1:
+        for (uint8_t i = 0; i < N_ENTREES; i++) s_entree[0][i] = aleatoireEntre(-0.1f, 1.1f);
+        etapeSuivante();
+        break;
+
+    case 2:
+        chronometre(s_flottant_us, [](uint32_t n) { s_puitsEntier = CommandMotor::pwmDepuisCommande(s_entree[0][n % N_ENTREES]); });
+        break;
+
+    case 3:
+        chronometre(s_fixe_us, [](uint32_t n) { s_puitsEntier = CommandMotor::pwmDepuisCommande(Q8_24::depuisFloat(s_entree[0][n % N_ENTREES])); });
+        break;
+
+    default:
+        Serial.print("[PointFixe] pwm      differences ");
+        Serial.print(s_differences);
+        Serial.print('/');
+        Serial.print(s_essais);
+        Serial.print(" (max ");
+        Serial.print(s_ecartMax);
+        Serial.print(')');
+        afficheDurees(s_flottant_us, s_fixe_us);
+        sectionSuivante();
+        break;
+    }
+}
+
+// =====================
+//   Nombres JSON
+// =====================
+
+static void bancJson()
+{
+    switch (s_phase) {
+    case 0:
+        // Ecart en unités du dernier chiffre affiché
+        parcours(N_APPELS, [](uint32_t) {
+            float   v = aleatoireEntre(-1.0f, 1.0f) * (float)(1UL << (aleatoire() % 30));
+            uint8_t d = aleatoire() % 7;
+
+            bool nf, nq;
+            uint32_t ef, ff, eq, fq;
+            bool okF = ReponseHttp::decoupeDecimalFlottant(v, d, nf, ef, ff);
+            bool okQ = ReponseHttp::decoupeDecimal(v, d, nq, eq, fq);
+            if (okF != okQ) { s_differences++; return; }
+            if (!okF || (ef == eq && ff == fq)) return;
+
+            s_differences++;
+            static const uint32_t p10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+            uint64_t a = (uint64_t)ef * p10[d] + ff;
+            uint64_t b = (uint64_t)eq * p10[d] + fq;
+            uint32_t e = (uint32_t)(a > b ? a - b : b - a);
+            if (e > s_ecartMax) s_ecartMax = e;
+        });
+        break;
+
+    case 1:
+        for (uint8_t i = 0; i < N_ENTREES; i++) s_entree[0][i] = aleatoireEntre(-2000.0f, 2000.0f);
+        etapeSuivante();
+        break;
+
+    case 2:
+        chronometre(s_flottant_us, [](uint32_t n) {
+            bool     negatif;
+            uint32_t ent, frac;
+            ReponseHttp::decoupeDecimalFlottant(s_entree[0][n % N_ENTREES], 2, negatif, ent, frac);
+            s_puitsEntier = ent + frac;
+        });
+        break;
+
+    case 3:
+        chronometre(s_fixe_us, [](uint32_t n) {
+            bool     negatif;
+            uint32_t ent, frac;
+            ReponseHttp::decoupeDecimal(s_entree[0][n % N_ENTREES], 2, negatif, ent, frac);
+            s_puitsEntier = ent + frac;
+        });
+        break;
+
+    default:
+        Serial.print("[PointFixe] json     differences ");
+        Serial.print(s_differences);
+        Serial.print('/');
+        Serial.print(N_APPELS);
+        Serial.print(" (max ");
+        Serial.print(s_ecartMax);
+        Serial.print(" dernier chiffre)");
+        afficheDurees(s_flottant_us, s_fixe_us);
+        sectionSuivante();
+        break;
+    }
+}
+
+// =====================
+//   Déroulement
+// =====================
+
+void bancPointFixeDemarre()
+{
+    s_graine = 1;
+    debutSection(SECTION_PID);
+
+    Serial.print("[PointFixe] chemin firmware : ");
+    Serial.println(POINT_FIXE ? "virgule fixe" : "float (-DPOINT_FIXE=0)");
+}
+
+bool bancPointFixeEnCours()
+{
+    return s_section != SECTION_FIN;
+}
+
+bool bancPointFixeTranche()
+{
+    switch (s_section) {
+    case SECTION_PID:      bancPid();           break;
+    case SECTION_COULOMB:  bancCoulomb();       break;
+    case SECTION_BATTERIE: bancSeuilBatterie(); break;
+    case SECTION_PWM:      bancPwm();           break;
+    case SECTION_JSON:     bancJson();          break;
+    default:               return false;
+    }
+    return bancPointFixeEnCours();
+}
+
+void bancPointFixeAbandonne()
+{
+    if (!bancPointFixeEnCours()) return;
+    s_section = SECTION_FIN;
+    Serial.println("[PointFixe] banc interrompu");
+}
+
+void bancPointFixe()
+{
+    bancPointFixeDemarre();
+    while (bancPointFixeTranche()) {}
+}
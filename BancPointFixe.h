@@ -0,0 +1,39 @@
+#ifndef BANC_POINT_FIXE_H
+#define BANC_POINT_FIXE_H
+
+#include <Arduino.h>
+
+// =====================
+//   Banc virgule fixe / float (touche 'x')
+// =====================
+//
+// Sur la cible, pour chaque calcul par tick passé en virgule fixe
+// (PointFixe.h) : écart avec la référence float sur des entrées
+// reproductibles, puis durée moyenne d'un appel pour chaque version
+// (entrées et sorties float comprises, comme dans le firmware).
+//
+//   loi PID        LoiPid<float> / LoiPid<Q16_16>
+//   coulomb        CoulombCounter / CoulombCounterFixe, 1 h à 10 Hz
+//                  (écart à une intégration en double)
+//   seuil batterie niveauBatterie<float> / <Q16_16>
+//   PWM            CommandMotor::pwmDepuisCommande(float / Q8_24)
+//   JSON           ReponseHttp::decoupeDecimalFlottant / decoupeDecimal
+//
+// Durées par micros() sur 1000 appels ; cycles = durée x F_CPU (pas de
+// compteur de cycles DWT sur Cortex-M0+).
+//
+// ~0,5 s de calcul en tout, découpé en tranches de quelques ms (100 appels
+// chronométrés, ou BUDGET_US de calcul d'écart) : une tranche par tick de
+// tacheControle, Safety et les failsafes tournent entre deux. Le croquis ne
+// le lance qu'à l'arrêt (IDLE, propulsion à 0) et l'interrompt sinon.
+
+void bancPointFixeDemarre();
+bool bancPointFixeEnCours();
+// Une tranche ; faux quand le banc est terminé
+bool bancPointFixeTranche();
+void bancPointFixeAbandonne();
+
+// Banc complet d'un seul tenant (banc_tick sur le PC)
+void bancPointFixe();
+
+#endif
@@ -0,0 +1,134 @@
+#include "CanalUdp.h"
+#include "Journal.h"
+
+CanalUdp::CanalUdp()
+: _actif(false)
+, _emetteurPort(0)
+, _emetteurConnu(false)
+, _dernierSeq(0)
+, _acceptes(0)
+, _doublons(0)
+, _malformes(0)
+{
+}
+
+bool CanalUdp::begin(uint16_t port)
+{
+    if (_actif) _udp.stop();
+
+    _actif = _udp.begin(port) != 0;
+    _emetteurConnu = false;
+
+    if (_actif) LOG_INFO("UDP", "Ecoute port %u", port);
+    else        LOG_ERREUR("UDP", "Ecoute port %u ECHEC", port);
+    return _actif;
+}
+
+void CanalUdp::stop()
+{
+    if (_actif) _udp.stop();
+    _actif = false;
+}
+
+// =====================
+//   Réception
+// =====================
+
+void CanalUdp::update(Controller& ctrl, Capteurs& caps)
+{
+    if (!_actif) return;
+
+    int taille = _udp.parsePacket();
+    if (taille <= 0) return;
+
+    uint32_t debut = micros();
+
+    // Plus grand paquet attendu : en-tête + touche
+    uint8_t paquet[sizeof(EnteteUdp) + 1];
+    if (taille > (int)sizeof(paquet)) {
+        _malformes++;
+        while (_udp.read(paquet, sizeof(paquet)) > 0) { }   // vide le paquet
+        return;
+    }
+
+    int n = _udp.read(paquet, sizeof(paquet));
+
+    EnteteUdp e;
+    if (n < (int)sizeof(e)) { _malformes++; return; }
+    memcpy(&e, paquet, sizeof(e));
+
+    if (e.magic[0] != UDP_MAGIC_0 || e.magic[1] != UDP_MAGIC_1 || e.version != UDP_VERSION) {
+        _malformes++;
+        return;
+    }
+
+    if (e.type == UDP_CMD) {
+        if (n < (int)sizeof(e) + 1) { _malformes++; return; }
+    }
+    else if (e.type != UDP_TELEM) {
+        _malformes++;
+        return;
+    }
+
+    if (!seqAccepte(_udp.remoteIP(), _udp.remotePort(), e.seq)) {
+        _doublons++;
+        return;
+    }
+    _acceptes++;
+
+    // Même chemin que /cmd et le clavier série
+    if (e.type == UDP_CMD) ctrl.onKey((char)toupper(paquet[sizeof(e)]));
+
+    repond(e, debut, ctrl, caps);
+}
+
+bool CanalUdp::seqAccepte(IPAddress ip, uint16_t port, uint16_t seq)
+{
+    bool memeEmetteur = _emetteurConnu && ip == _emetteurIp && port == _emetteurPort;
+
+    // Différence signée : robuste au rebouclage du compteur 16 bits
+    if (memeEmetteur && (int16_t)(seq - _dernierSeq) <= 0) return false;
+
+    _emetteurIp    = ip;
+    _emetteurPort  = port;
+    _emetteurConnu = true;
+    _dernierSeq    = seq;
+    return true;
+}
+
+// =====================
+//   Réponse
+// =====================
+
+void CanalUdp::repond(const EnteteUdp& requete, uint32_t debut_us, Controller& ctrl, Capteurs& caps)
+{
+    struct __attribute__((packed)) {
+        EnteteUdp  entete;
+        ReponseUdp corps;
+    } r;
+
+    r.entete      = requete;
+    r.entete.type = requete.type | UDP_REPONSE;
+
+    remplitTrameData(r.corps.trame, caps.snapshot(), ctrl.mode() == ControlMode::AUTONOMOUS);
+    r.corps.rejets = (uint16_t)rejets();
+
+    // Commande appliquée : on mesure avant l'émission de la réponse
+    uint32_t duree = micros() - debut_us;
+    _traitement.ajoute(duree);
+    r.corps.traitement_us = (duree > 0xFFFF) ? 0xFFFF : (uint16_t)duree;
+
+    _udp.beginPacket(_udp.remoteIP(), _udp.remotePort());
+    _udp.write((const uint8_t*)&r, sizeof(r));
+    _udp.endPacket();
+}
+
+void CanalUdp::printStats()
+{
+    Serial.print("[UDP] acceptes=");  Serial.print(_acceptes);
+    Serial.print(" doublons=");       Serial.print(_doublons);
+    Serial.print(" malformes=");      Serial.println(_malformes);
+    Serial.print("[UDP] traitement(us) ");
+    _traitement.print(Serial);
+    _traitement.reset();
+}
@@ -0,0 +1,94 @@
+#ifndef CANAL_UDP_H
+#define CANAL_UDP_H
+
+#include <Arduino.h>
+#include <WiFiNINA.h>
+#include "Controller.h"
+#include "Capteurs.h"
+#include "Telemetrie.h"
+#include "StatTemps.h"
+
+// =====================
+//   Canal UDP de pilotage
+// =====================
+//
+// Un datagramme par commande, sans poignée de main TCP ni file d'attente
+// derrière les requêtes /data. Chaque commande acceptée reçoit une réponse
+// avec la trame TrameData (même format que /data.bin) et le temps de
+// traitement réception -> actionneurs.
+//
+// Protocole (little-endian, voir outils/client_udp.py) :
+//   requête : EnteteUdp [+ touche (1 octet) si UDP_CMD]
+//   réponse : EnteteUdp (type | 0x80, même seq) + ReponseUdp
+//
+// Numéro de séquence 16 bits par émetteur : un paquet dont le seq n'est pas
+// strictement après le dernier accepté (doublon, arrivé dans le désordre)
+// est ignoré sans réponse. Un nouvel émetteur (IP/port) resynchronise.
+
+static const uint16_t UDP_PORT_DEFAUT = 4210;
+static const uint8_t  UDP_VERSION     = 1;
+static const uint8_t  UDP_MAGIC_0     = 'P';
+static const uint8_t  UDP_MAGIC_1     = 'U';
+
+enum UdpType : uint8_t
+{
+    UDP_CMD       = 0x01,   // touche de pilotage (mêmes touches que /cmd)
+    UDP_TELEM     = 0x02,   // demande de télémétrie seule
+    UDP_REPONSE   = 0x80    // bit ajouté au type dans la réponse
+};
+
+struct __attribute__((packed)) EnteteUdp
+{
+    uint8_t  magic[2];    // 'P' 'U'
+    uint8_t  version;     // UDP_VERSION
+    uint8_t  type;        // UdpType
+    uint16_t seq;
+};
+
+struct __attribute__((packed)) ReponseUdp
+{
+    uint16_t  traitement_us;   // réception -> commande appliquée (saturé)
+    uint16_t  rejets;          // paquets ignorés depuis le boot (16 bits bas)
+    TrameData trame;
+};
+
+static_assert(sizeof(EnteteUdp) == 6, "EnteteUdp : format fige, decode par outils/client_udp.py");
+static_assert(sizeof(ReponseUdp) == 40, "ReponseUdp : format fige, decode par outils/client_udp.py");
+
+class CanalUdp
+{
+public:
+    CanalUdp();
+
+    // A appeler une fois le WiFi connecté (et à chaque reconnexion)
+    bool begin(uint16_t port = UDP_PORT_DEFAUT);
+    void stop();
+
+    // Traite au plus un datagramme en attente
+    void update(Controller& ctrl, Capteurs& caps);
+
+    uint32_t acceptes() const { return _acceptes; }
+    uint32_t rejets()   const { return _doublons + _malformes; }
+
+    // Compteurs + temps de traitement, puis remise à zéro des temps
+    void printStats();
+
+private:
+    WiFiUDP   _udp;
+    bool      _actif;
+
+    IPAddress _emetteurIp;
+    uint16_t  _emetteurPort;
+    bool      _emetteurConnu;
+    uint16_t  _dernierSeq;
+
+    uint32_t  _acceptes;
+    uint32_t  _doublons;      // doublons et paquets en retard
+    uint32_t  _malformes;
+    StatTemps _traitement;
+
+    bool seqAccepte(IPAddress ip, uint16_t port, uint16_t seq);
+    void repond(const EnteteUdp& requete, uint32_t debut_us, Controller& ctrl, Capteurs& caps);
+};
+
+#endif
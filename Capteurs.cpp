@@ -2,9 +2,158 @@
 #include <Arduino.h>
 #include <Wire.h>
 #include <string.h>
+#include "Journal.h"
+#include "Horloge.h"
+#include "Metriques.h"
 
 static const int32_t BNO_SENSOR_ID = 55;
 
+// Registres BNO055 (page 0) : ACC, MAG, GYR, EUL, QUA, LIA, GRV, TEMP
+// puis CALIB_STAT sont contigus -> une seule lecture de 0x08 à 0x35
+static const uint8_t BNO055_ACC_DATA_X_LSB = 0x08;
+static const uint8_t BNO055_CALIB_STAT     = 0x35;
+static const uint8_t BNO055_BURST_LEN      = BNO055_CALIB_STAT - BNO055_ACC_DATA_X_LSB + 1; // 46 octets
+
+// Décalages dans la rafale (octets)
+static const uint8_t BNO_OFF_ACC   = 0x08 - BNO055_ACC_DATA_X_LSB;
+static const uint8_t BNO_OFF_GYR   = 0x14 - BNO055_ACC_DATA_X_LSB;
+static const uint8_t BNO_OFF_EUL   = 0x1A - BNO055_ACC_DATA_X_LSB;
+static const uint8_t BNO_OFF_LIA   = 0x28 - BNO055_ACC_DATA_X_LSB;
+static const uint8_t BNO_OFF_GRV   = 0x2E - BNO055_ACC_DATA_X_LSB;
+static const uint8_t BNO_OFF_CALIB = BNO055_CALIB_STAT - BNO055_ACC_DATA_X_LSB;
+
+// Échelles : UNIT_SEL laissé à sa valeur de reset (m/s², dps, degrés), que
+// Adafruit_BNO055::begin() ne modifie pas. Le gyro est sorti en rad/s comme
+// getEvent() : 16 LSB/dps = 916,73 LSB par rad/s (900 ne vaut qu'en mode rps)
+static const float BNO_ACC_LSB_PER_MS2 = 100.0f;               // m/s²
+static const float BNO_GYR_LSB_PER_RAD = 16.0f / DEG_TO_RAD;   // rad/s
+static const float BNO_EUL_LSB_PER_DEG = 16.0f;   // degrés
+static const float BNO_LIA_LSB_PER_MS2 = 100.0f;  // m/s² (LIA et GRV)
+
+// Horizon de prédiction par défaut : crémaillère + remplissage du ballast
+static const float HORIZON_PREDICTION_S = 0.3f;
+
+// INA236 : conversion et moyennage faits par la puce
+// (codes registre CONFIG : AVG 0..7 = 1,4,16,64,128,256,512,1024 ; CT 4 = 1.1 ms)
+static const uint8_t INA_AVG_16        = 2;
+static const uint8_t INA_AVG_64        = 3;
+static const uint8_t INA_CT_1100US     = 4;
+
+// Registre MASK/ENABLE INA236
+static const uint16_t INA_MASK_SOL     = 0x8000;  // shunt over-voltage
+static const uint16_t INA_MASK_BUL     = 0x1000;  // bus under-voltage
+static const uint16_t INA_MASK_LEN     = 0x0001;  // alerte mémorisée jusqu'à lecture
+static const uint16_t INA_FLAG_AFF     = 0x0010;  // alert function flag
+
+// Seuils ALERT (ADCRANGE = 0 : 2.5 µV/LSB shunt, 1.6 mV/LSB bus)
+static const float INA_SHUNT_OHM          = 0.010f;   // à ajuster avec la résistance réelle
+static const float ALERTE_SURINTENSITE_mA = 8000.0f;
+static const float ALERTE_SOUS_TENSION_V  = 6.6f;     // 2S Li-ion, 3.3 V/élément
+
+static const uint8_t PAS_DE_BROCHE = 0xFF;
+
+// Drapeaux levés par les ISR ALERT, consommés par updateAlertes()
+static volatile bool s_alerteBatt   = false;
+static volatile bool s_alerteMesure = false;
+
+static void isrAlerteBatt()   { s_alerteBatt = true; }
+static void isrAlerteMesure() { s_alerteMesure = true; }
+
+// =====================
+//   Fuite : chemin rapide par interruption
+// =====================
+//
+// ISR (fronts) -> contexte différé (PendSV sur SAMD, priorité la plus
+// basse, préempte la boucle principale) -> filtre anti-glitch -> latch +
+// failsafe. Un seul capteur de fuite : l'état est donc statique.
+//
+// Filtre sans attente : l'ISR horodate le front montant, une retombée
+// avant FUITE_FILTRE_US annule (parasite). Le contexte différé confirme
+// dès que le signal est resté haut assez longtemps ; il est relancé à
+// chaque tick SysTick (1 ms) tant qu'un front est en attente, et par la
+// scrutation 100 Hz.
+
+static const uint32_t FUITE_FILTRE_US = 200;   // signal stable sur 200 µs
+
+static volatile bool     s_fuiteEnAttente  = false;  // front vu, filtrage à faire
+static volatile bool     s_fuiteConfirmee  = false;  // latch ISR-safe
+static volatile bool     s_fuiteParIsr     = false;
+static volatile uint32_t s_fuiteFront_us   = 0;
+static volatile uint32_t s_fuiteLatence_us = 0;
+static volatile uint16_t s_fuiteParasites  = 0;
+static uint8_t           s_fuitePin        = 2;
+static void            (*s_fuiteFailsafe)() = nullptr;
+
+static void traiteFuiteDifferee()
+{
+    // Décision sous interruptions masquées : la scrutation (boucle) et
+    // PendSV peuvent se croiser, le failsafe ne part qu'une fois
+    bool confirme = false;
+    noInterrupts();
+    if (s_fuiteEnAttente && !s_fuiteConfirmee) {
+        if (digitalRead(s_fuitePin) != HIGH) {
+            s_fuiteEnAttente = false;
+            s_fuiteParasites++;
+        } else if (micros() - s_fuiteFront_us >= FUITE_FILTRE_US) {
+            s_fuiteEnAttente = false;
+            s_fuiteConfirmee = true;
+            s_fuiteParIsr    = true;
+            confirme         = true;
+        }
+    }
+    interrupts();
+
+    if (!confirme) return;
+    if (s_fuiteFailsafe) s_fuiteFailsafe();
+    s_fuiteLatence_us = micros() - s_fuiteFront_us;
+}
+
+static void demandeTraitementFuite()
+{
+#ifdef ARDUINO_ARCH_SAMD
+    SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+#else
+    traiteFuiteDifferee();
+#endif
+}
+
+static void isrFuite()
+{
+    if (s_fuiteConfirmee) return;
+
+    if (digitalRead(s_fuitePin) == HIGH) {
+        if (s_fuiteEnAttente) return;
+        s_fuiteFront_us  = micros();
+        s_fuiteEnAttente = true;
+    } else {
+        if (!s_fuiteEnAttente) return;
+        s_fuiteEnAttente = false;   // retombé avant la fin du filtre
+        s_fuiteParasites++;
+        return;
+    }
+
+    demandeTraitementFuite();
+}
+
+#ifdef ARDUINO_ARCH_SAMD
+extern "C" void PendSV_Handler(void)
+{
+    traiteFuiteDifferee();
+}
+
+// Appelé par SysTick_Handler (1 ms) : filtre en cours -> nouveau passage
+extern "C" int sysTickHook(void)
+{
+    if (s_fuiteEnAttente) SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+    return 0;
+}
+#endif
+
+static inline int16_t le16(const uint8_t* p)
+{
+    return (int16_t)((uint16_t)p[0] | ((uint16_t)p[1] << 8));
+}
+
 // =====================
 //   CoulombCounter
 // =====================
@@ -20,13 +169,13 @@ CoulombCounter::CoulombCounter(float capacity_mAh, float initial_soc)
 void CoulombCounter::reset(float initial_soc)
 {
     charge_mAh  = capacity_mAh * (initial_soc / 100.0f);
-    last_millis = millis();
+    last_millis = horloge_ms();
     initialized = true;
 }
 
 void CoulombCounter::update(float current_mA)
 {
-    unsigned long now = millis();
+    unsigned long now = horloge_ms();
 
     if (!initialized) {
         last_millis = now;
@@ -34,9 +183,16 @@ void CoulombCounter::update(float current_mA)
         return;
     }
 
-    float dt_s = (now - last_millis) / 1000.0f;
+    uint32_t dt_ms = now - last_millis;
     last_millis = now;
 
+    integre(current_mA, dt_ms);
+}
+
+void CoulombCounter::integre(float current_mA, uint32_t dt_ms)
+{
+    float dt_s = dt_ms / 1000.0f;
+
     float consumed_mAh = current_mA * (dt_s / 3600.0f);
     charge_mAh -= consumed_mAh;
 
@@ -50,6 +206,67 @@ float CoulombCounter::get_soc() const
     return 100.0f * (charge_mAh / capacity_mAh);
 }
 
+// =====================
+//   CoulombCounterFixe
+// =====================
+
+CoulombCounterFixe::CoulombCounterFixe(float capacity_mAh, float initial_soc)
+    : capacite((int64_t)(capacity_mAh * 3600.0f) * 1000 * Q16_16::UN),
+      charge(0),
+      parPourcent(capacite / 100 / Q16_16::UN),
+      last_millis(0),
+      initialized(false),
+      chargeSoc(-1),
+      socCalcule()
+{
+    charge = (int64_t)(capacite / 100 * initial_soc);
+}
+
+void CoulombCounterFixe::reset(float initial_soc)
+{
+    // Hors chemin par tick : le float est toléré ici
+    charge      = (int64_t)(capacite / 100 * initial_soc);
+    last_millis = horloge_ms();
+    initialized = true;
+}
+
+void CoulombCounterFixe::update(float current_mA)
+{
+    unsigned long now = horloge_ms();
+
+    if (!initialized) {
+        last_millis = now;
+        initialized = true;
+        return;
+    }
+
+    uint32_t dt_ms = now - last_millis;
+    last_millis = now;
+
+    integre(current_mA, dt_ms);
+}
+
+void CoulombCounterFixe::integre(float current_mA, uint32_t dt_ms)
+{
+    // Une multiplication 32 x 32 -> 64, pas de division
+    charge -= (int64_t)Q16_16::depuisFloat(current_mA).brut() * dt_ms;
+
+    if (charge < 0)        charge = 0;
+    if (charge > capacite) charge = capacite;
+}
+
+Q16_16 CoulombCounterFixe::soc() const
+{
+    if (parPourcent <= 0) return Q16_16();
+
+    // Lu à 100 Hz (Safety) pour une charge intégrée à 10 Hz
+    if (charge != chargeSoc) {
+        chargeSoc  = charge;
+        socCalcule = Q16_16::depuisBrut(Q16_16::sature(charge / parPourcent));
+    }
+    return socCalcule;
+}
+
 // =====================
 //   Constructeur
 // =====================
@@ -69,13 +286,21 @@ Capteurs::Capteurs(uint8_t bnoAddress,
 , ms_addr(msAddress)
 , leak_pin(leakPin)
 , leak_latch(leakLatch)
+, ina_batt_alert_pin(7)                       // ALERT INA batterie sur D7
+, ina_mesure_alert_pin(PAS_DE_BROCHE)
+, ina_batt_alerte(InaAlerte::SURINTENSITE)
+, ina_mesure_alerte(InaAlerte::AUCUNE)
 , bno(BNO_SENSOR_ID, bno_addr, &Wire)
 , ina_batt(ina_batt_addr, &Wire)
 , ina_mesure(ina_mesure_addr, &Wire)
-, baro()
+, baro(Wire, ms_addr)
 , coulomb_batt(battCapacity_mAh)
+, horizonPrediction_s(HORIZON_PREDICTION_S)
 {
-    memset(&data, 0, sizeof(CapteursData));
+    data = CapteursData();
+    published[0] = published[1] = data;
+    front   = 0;
+    modifie = false;
 
     imu_ok        = false;
     ina_batt_ok   = false;
@@ -85,6 +310,39 @@ Capteurs::Capteurs(uint8_t bnoAddress,
     data.leak.sensorPresent = false;
     data.leak.leakNow = false;
     data.leak.leakLatched = false;
+
+    // Cadences par défaut : la fuite à chaque appel, le reste étalé sur
+    // des phases différentes pour ne pas tout lire dans le même tick
+    memset(policies, 0, sizeof(policies));
+    setSamplePolicy(SensorId::LEAK,           0,  0);
+    setSamplePolicy(SensorId::IMU,           20,  0);   // 50 Hz
+    setSamplePolicy(SensorId::DEPTH,         50, 10);   // 20 Hz (cycle D1+D2 ~40 ms)
+    setSamplePolicy(SensorId::POWER_BATT,   100,  5);   // 10 Hz (coulomb counter)
+    setSamplePolicy(SensorId::POWER_MESURE, 500, 15);   //  2 Hz (diagnostic)
+}
+
+// =====================
+//   Cadence d'échantillonnage
+// =====================
+
+void Capteurs::setSamplePolicy(SensorId id, uint16_t periode_ms, uint16_t phase_ms)
+{
+    SamplePolicy& p = policies[(uint8_t)id];
+    p.periode_ms  = periode_ms;
+    p.phase_ms    = phase_ms;
+    p.prochain_ms = horloge_ms() + phase_ms;
+}
+
+bool Capteurs::sampleDue(SensorId id, uint32_t now)
+{
+    SamplePolicy& p = policies[(uint8_t)id];
+    if (p.periode_ms == 0) return true;
+    if ((int32_t)(now - p.prochain_ms) < 0) return false;
+
+    // Créneau suivant sans dérive ; si on a raté plus d'une période, on se recale
+    p.prochain_ms += p.periode_ms;
+    if ((int32_t)(now - p.prochain_ms) >= 0) p.prochain_ms = now + p.periode_ms;
+    return true;
 }
 
 // =====================
@@ -135,6 +393,7 @@ bool Capteurs::begin()
     // ===== Leak sensor (SOS BlueRobotics) =====
     pinMode(leak_pin, INPUT_PULLDOWN);
     leakBootCheck(500, 5);
+    armLeakInterrupt();
 
     // ===== IMU =====
     if (bno.begin(OPERATION_MODE_NDOF)) {
@@ -150,6 +409,7 @@ bool Capteurs::begin()
     // ===== INA Batterie =====
     if (ina_batt.begin()) {
         ina_batt_ok = true;
+        configureINA(ina_batt, INA_AVG_16, ina_batt_alert_pin, ina_batt_alerte);
         coulomb_batt.reset(100.0f);
         Serial.print("[OK] INA Batterie détecté à 0x");
         Serial.println(ina_batt_addr, HEX);
@@ -162,6 +422,7 @@ bool Capteurs::begin()
     // ===== INA Mesure =====
     if (ina_mesure.begin()) {
         ina_mesure_ok = true;
+        configureINA(ina_mesure, INA_AVG_64, ina_mesure_alert_pin, ina_mesure_alerte);
         Serial.print("[OK] INA Mesure détecté à 0x");
         Serial.println(ina_mesure_addr, HEX);
     } else {
@@ -173,14 +434,23 @@ bool Capteurs::begin()
     // ===== MS5837 =====
     if (baro.init()) {
         depth_ok = true;
-        baro.setModel(MS5837::MS5837_02BA);
+        baro.setModel(MS5837Async::MODEL_02BA);
         baro.setFluidDensity(997);
-        Serial.println("[OK] Capteur profondeur MS5837 détecté");
+        baro.startConversion(horloge_us());
+        Serial.println("[OK] Capteur profondeur MS5837 détecté (lecture non bloquante)");
     } else {
         depth_ok = false;
         Serial.println("[ERREUR] MS5837 non détecté (ignoré)");
     }
 
+    // Phases relatives à la fin de l'init (les délais de boot ne comptent pas)
+    for (uint8_t i = 0; i < (uint8_t)SensorId::COUNT; i++) {
+        policies[i].prochain_ms = horloge_ms() + policies[i].phase_ms;
+    }
+
+    modifie = true;
+    publish();
+
     return true;
 }
 
@@ -207,6 +477,9 @@ void Capteurs::calibrate(bool verbose)
         Serial.print(accel); Serial.print(", ");
         Serial.print(mag);   Serial.println("]");
     }
+
+    modifie = true;
+    publish();
 }
 
 // =====================
@@ -215,77 +488,409 @@ void Capteurs::calibrate(bool verbose)
 
 void Capteurs::update()
 {
+    uint32_t now = horloge_ms();
+
+    // Chaque lecture est chronométrée (Metriques, touche 'm' / /metrics)
+    if (sampleDue(SensorId::LEAK, now)) { ChronoPortee c(Etape::CAPT_FUITE); scruteFuite(); }
+    { ChronoPortee c(Etape::CAPT_ALERTES); traiteAlertes(); }
+    if (imu_ok && sampleDue(SensorId::IMU, now)) { ChronoPortee c(Etape::CAPT_IMU); updateIMU(); }
+    if (ina_batt_ok && sampleDue(SensorId::POWER_BATT, now))     { ChronoPortee c(Etape::CAPT_BATT);   updatePowerBatt(); }
+    if (ina_mesure_ok && sampleDue(SensorId::POWER_MESURE, now)) { ChronoPortee c(Etape::CAPT_MESURE); updatePowerMesure(); }
+
+    // Profondeur : la conversion en cours est scrutée à chaque appel,
+    // une nouvelle conversion n'est lancée qu'à la cadence demandée
+    if (depth_ok) {
+        ChronoPortee c(Etape::CAPT_PROFONDEUR);
+        pollDepth(!baro.busy() && sampleDue(SensorId::DEPTH, now));
+    }
+
+    ChronoPortee c(Etape::CAPT_PUBLIE);
+    publish();
+}
+
+// =====================
+//   Publication (double tampon)
+// =====================
+
+void Capteurs::publish()
+{
+    if (!modifie) return;
+    modifie = false;
+
+    uint8_t back = front ^ 1;
+    published[back] = data;
+    published[back].frameId = published[front].frameId + 1;
+    published[back].t_ms    = horloge_ms();
+    front = back;
+}
+
+bool Capteurs::isDepthStale(uint32_t maxAge_ms) const
+{
+    return ageEchantillon_ms(getDepthData().t_ms, horloge_ms()) > maxAge_ms;
+}
+
+void Capteurs::updateLeak()
+{
+    { ChronoPortee c(Etape::CAPT_FUITE); scruteFuite(); }
+    publish();
+}
+
+void Capteurs::scruteFuite()
+{
+    // Front en attente dont le filtre est écoulé (relance du chemin rapide)
+    traiteFuiteDifferee();
+
     // ===== Leak sensor (SOS) =====
     {
         bool leakNow = (digitalRead(leak_pin) == HIGH);
-        data.leak.leakNow = leakNow;
+        bool latched = data.leak.leakLatched;
 
         if (leak_latch) {
-            if (leakNow) data.leak.leakLatched = true;
+            // Front en cours de filtrage : c'est le filtre qui tranche
+            if ((leakNow && !s_fuiteEnAttente) || s_fuiteConfirmee) latched = true;
         } else {
-            data.leak.leakLatched = leakNow;
+            latched = leakNow;
         }
+
+        if (leakNow != data.leak.leakNow || latched != data.leak.leakLatched ||
+            s_fuiteParasites != data.leak.parasites) {
+            data.leak.leakNow     = leakNow;
+            data.leak.leakLatched = latched;
+            data.leak.parasites   = s_fuiteParasites;
+            modifie = true;
+        }
+    }
+
+    if (!leak_latch || !data.leak.leakLatched || data.leak.failsafeDeclenche) return;
+
+    // Fuite vue par scrutation avant l'ISR (ou broche sans interruption) :
+    // on exécute le failsafe ici, une seule fois
+    noInterrupts();
+    bool dejaFait = s_fuiteConfirmee;
+    s_fuiteConfirmee = true;
+    interrupts();
+
+    if (!dejaFait) {
+        uint32_t t0 = micros();
+        if (s_fuiteFailsafe) s_fuiteFailsafe();
+        s_fuiteLatence_us = micros() - t0;
     }
 
+    data.leak.failsafeDeclenche  = true;
+    data.leak.detectionParIsr    = s_fuiteParIsr;
+    data.leak.latenceFailsafe_us = s_fuiteLatence_us;
+
+    LOG_ERREUR("LEAK", "Fuite %s -> failsafe en %lu us",
+               s_fuiteParIsr ? "(interruption)" : "(scrutation)",
+               (unsigned long)data.leak.latenceFailsafe_us);
+
+    modifie = true;
+}
+
+void Capteurs::setLeakFailsafe(void (*failsafe)())
+{
+    s_fuiteFailsafe = failsafe;
+}
+
+void Capteurs::armLeakInterrupt()
+{
+    s_fuitePin = leak_pin;
+    data.leak.interruptActive = false;
+
+    // En mode non mémorisé, la fuite peut disparaître : pas de failsafe irréversible
+    if (!leak_latch) return;
+
+#ifdef ARDUINO_ARCH_SAMD
+    if (g_APinDescription[leak_pin].ulExtInt == NOT_AN_INTERRUPT) {
+        // Câblage à corriger : la fuite ne serait vue qu'à la scrutation 100 Hz
+        Serial.print("[ERREUR] Capteur fuite sur D"); Serial.print(leak_pin);
+        Serial.println(" sans interruption externe (utiliser D0/D1/D4-D9/A1/A2)"
+                       " -> scrutation 100 Hz uniquement");
+        LOG_ERREUR("LEAK", "D%u sans EXTINT, failsafe par scrutation seulement", leak_pin);
+        return;
+    }
+    NVIC_SetPriority(PendSV_IRQn, (1 << __NVIC_PRIO_BITS) - 1);
+#endif
+
+    attachInterrupt(digitalPinToInterrupt(leak_pin), isrFuite, CHANGE);
+    data.leak.interruptActive = true;
+    Serial.println("[LEAK] Interruption fuite armee");
+}
+
+void Capteurs::updateIMU()
+{
     // ===== IMU =====
-    if (imu_ok) {
-        sensors_event_t euler;
-        bno.getEvent(&euler, Adafruit_BNO055::VECTOR_EULER);
-        data.imu.yaw   = euler.orientation.x;
-        data.imu.roll  = euler.orientation.y;
-        data.imu.pitch = euler.orientation.z;
-
-        sensors_event_t acc;
-        bno.getEvent(&acc, Adafruit_BNO055::VECTOR_ACCELEROMETER);
-        data.imu.ax = acc.acceleration.x;
-        data.imu.ay = acc.acceleration.y;
-        data.imu.az = acc.acceleration.z;
-
-        sensors_event_t gyro;
-        bno.getEvent(&gyro, Adafruit_BNO055::VECTOR_GYROSCOPE);
-        data.imu.gx = gyro.gyro.x;
-        data.imu.gy = gyro.gyro.y;
-        data.imu.gz = gyro.gyro.z;
-
-        bno.getCalibration(&data.imu.sysCal, &data.imu.gyroCal, &data.imu.accelCal, &data.imu.magCal);
+    if (imu_ok && readIMUBurst()) {
+        data.imu.t_ms = horloge_ms();
+        data.imu.seq++;
+        modifie = true;
+
+        // L'accélération précédente s'appliquait jusqu'à cet instant
+        estimateur.prediction(data.imu.t_ms);
+        estimateur.setAcceleration(data.imu.accVerticale_mps2);
+        publieEstimation();
     }
+}
+
+// Chemin rapide : une transaction I2C pour accel, gyro, Euler et calibration
+bool Capteurs::readIMUBurst()
+{
+    uint8_t buf[BNO055_BURST_LEN];
+
+    Wire.beginTransmission(bno_addr);
+    Wire.write(BNO055_ACC_DATA_X_LSB);
+    if (Wire.endTransmission(false) != 0) return false;   // restart, pas de stop
+
+    if (Wire.requestFrom(bno_addr, (uint8_t)BNO055_BURST_LEN) != BNO055_BURST_LEN) return false;
+    for (uint8_t i = 0; i < BNO055_BURST_LEN; i++) buf[i] = Wire.read();
+
+    const uint8_t* acc = buf + BNO_OFF_ACC;
+    data.imu.ax = le16(acc + 0) / BNO_ACC_LSB_PER_MS2;
+    data.imu.ay = le16(acc + 2) / BNO_ACC_LSB_PER_MS2;
+    data.imu.az = le16(acc + 4) / BNO_ACC_LSB_PER_MS2;
+
+    const uint8_t* gyr = buf + BNO_OFF_GYR;
+    data.imu.gx = le16(gyr + 0) / BNO_GYR_LSB_PER_RAD;
+    data.imu.gy = le16(gyr + 2) / BNO_GYR_LSB_PER_RAD;
+    data.imu.gz = le16(gyr + 4) / BNO_GYR_LSB_PER_RAD;
+
+    // Ordre registre : heading, roll, pitch (même mapping que getEvent)
+    const uint8_t* eul = buf + BNO_OFF_EUL;
+    data.imu.yaw   = le16(eul + 0) / BNO_EUL_LSB_PER_DEG;
+    data.imu.roll  = le16(eul + 2) / BNO_EUL_LSB_PER_DEG;
+    data.imu.pitch = le16(eul + 4) / BNO_EUL_LSB_PER_DEG;
+
+    // Vertical hors gravité : -(LIA . GRV) / |GRV|. Au repos GRV vaut +g
+    // vers le haut du capteur ; une accélération vers le bas donne LIA
+    // opposé à GRV, d'où le signe.
+    const uint8_t* lia = buf + BNO_OFF_LIA;
+    const uint8_t* grv = buf + BNO_OFF_GRV;
+    float lx = le16(lia + 0), ly = le16(lia + 2), lz = le16(lia + 4);
+    float gx = le16(grv + 0), gy = le16(grv + 2), gz = le16(grv + 4);
+    float ng = sqrtf(gx * gx + gy * gy + gz * gz);
+    data.imu.accVerticale_mps2 = (ng > 0.0f)
+        ? -(lx * gx + ly * gy + lz * gz) / (ng * BNO_LIA_LSB_PER_MS2)
+        : 0.0f;
+
+    uint8_t cal = buf[BNO_OFF_CALIB];
+    data.imu.sysCal   = (cal >> 6) & 0x03;
+    data.imu.gyroCal  = (cal >> 4) & 0x03;
+    data.imu.accelCal = (cal >> 2) & 0x03;
+    data.imu.magCal   =  cal       & 0x03;
+
+    return true;
+}
+
+// Ancien chemin (3 getEvent + getCalibration), gardé pour comparaison
+void Capteurs::readIMUEvents()
+{
+    sensors_event_t euler;
+    bno.getEvent(&euler, Adafruit_BNO055::VECTOR_EULER);
+    data.imu.yaw   = euler.orientation.x;
+    data.imu.roll  = euler.orientation.y;
+    data.imu.pitch = euler.orientation.z;
+
+    sensors_event_t acc;
+    bno.getEvent(&acc, Adafruit_BNO055::VECTOR_ACCELEROMETER);
+    data.imu.ax = acc.acceleration.x;
+    data.imu.ay = acc.acceleration.y;
+    data.imu.az = acc.acceleration.z;
+
+    sensors_event_t gyro;
+    bno.getEvent(&gyro, Adafruit_BNO055::VECTOR_GYROSCOPE);
+    data.imu.gx = gyro.gyro.x;
+    data.imu.gy = gyro.gyro.y;
+    data.imu.gz = gyro.gyro.z;
+
+    bno.getCalibration(&data.imu.sysCal, &data.imu.gyroCal, &data.imu.accelCal, &data.imu.magCal);
+}
+
+void Capteurs::benchmarkIMU(uint8_t iterations)
+{
+    if (!imu_ok || iterations == 0) return;
+
+    uint32_t t0 = micros();
+    for (uint8_t i = 0; i < iterations; i++) readIMUEvents();
+    uint32_t avant_us = (micros() - t0) / iterations;
+
+    t0 = micros();
+    for (uint8_t i = 0; i < iterations; i++) readIMUBurst();
+    uint32_t apres_us = (micros() - t0) / iterations;
+
+    Serial.print("[IMU] Lecture getEvent x3 + calib : "); Serial.print(avant_us); Serial.println(" us");
+    Serial.print("[IMU] Lecture rafale 0x08-0x35    : "); Serial.print(apres_us); Serial.println(" us");
+}
+
+void Capteurs::updatePower()
+{
+    updatePowerBatt();
+    updatePowerMesure();
+}
 
+void Capteurs::updatePowerBatt()
+{
     // ===== INA Batterie =====
     if (ina_batt_ok) {
-        data.power.busVoltage_V    = ina_batt.getBusVoltage();
-        data.power.shuntVoltage_mV = ina_batt.getShuntVoltage();
-        data.power.current_mA      = ina_batt.getCurrent();
-        data.power.power_mW        = ina_batt.getPower();
+        // Valeurs déjà moyennées par la puce : 2 lectures au lieu de 4
+        data.power.busVoltage_V = ina_batt.getBusVoltage();
+        data.power.current_mA   = ina_batt.getCurrent();
+        data.power.power_mW     = data.power.busVoltage_V * data.power.current_mA;
 
         // Si tu constates que le courant est NEGATIF en décharge, inverse ici :
         // coulomb_batt.update(-data.power.current_mA);
         coulomb_batt.update(data.power.current_mA);
 
-        data.power.soc1_percent = coulomb_batt.get_soc();
+        data.power.t_ms = horloge_ms();
+        data.power.seq++;
+        modifie = true;
     }
+}
 
+void Capteurs::updatePowerMesure()
+{
     // ===== INA Mesure =====
     if (ina_mesure_ok) {
-        data.power.busVoltage2_V    = ina_mesure.getBusVoltage();
-        data.power.shuntVoltage2_mV = ina_mesure.getShuntVoltage();
-        data.power.current2_mA      = ina_mesure.getCurrent();
-        data.power.power2_mW        = ina_mesure.getPower();
+        data.power.busVoltage2_V = ina_mesure.getBusVoltage();
+        data.power.current2_mA   = ina_mesure.getCurrent();
+        data.power.power2_mW     = data.power.busVoltage2_V * data.power.current2_mA;
+
+        data.power.t2_ms = horloge_ms();
+        data.power.seq2++;
+        modifie = true;
     }
+}
 
+void Capteurs::updateDepth()
+{
     // ===== Profondeur =====
-    if (depth_ok) {
-        baro.read();
-        data.depth.pressure_mbar = baro.pressure();
-        data.depth.temperature_C = baro.temperature();
-        data.depth.depth_m       = baro.depth();
+    // Conversion D1/D2 en deux phases : chaque appel fait au plus une
+    // transaction I2C. DepthData n'est publié que sur un échantillon complet.
+    if (depth_ok) pollDepth(true);
+}
+
+void Capteurs::pollDepth(bool lancer)
+{
+    uint32_t now = horloge_us();
+
+    if (baro.poll(now)) {
+        data.depth.pressure_mbar = baro.pressure_mbar();
+        data.depth.temperature_C = baro.temperature_C();
+        data.depth.depth_m       = baro.depth_m();
+        data.depth.depth_q       = baro.profondeur();
+        data.depth.t_ms          = horloge_ms();
+        data.depth.seq++;
+        modifie = true;
+
+        estimateur.correction(data.depth.depth_m, data.depth.t_ms);
+        publieEstimation();
+    }
+
+    if (lancer && !baro.busy()) baro.startConversion(now);
+}
+
+void Capteurs::publieEstimation()
+{
+    if (!estimateur.initialise()) return;
+
+    data.depth.estimationValide     = true;
+    data.depth.profondeurFiltree_m  = estimateur.profondeur_m();
+    data.depth.vitesseVerticale_mps = estimateur.vitesse_mps();
+    data.depth.profondeurPredite_m  = estimateur.profondeurPredite_m(horizonPrediction_s);
+    data.depth.profondeurFiltree_q  = Q16_16::depuisFloat(data.depth.profondeurFiltree_m);
+    data.depth.vitesseVerticale_q   = Q16_16::depuisFloat(data.depth.vitesseVerticale_mps);
+    modifie = true;
+}
+
+// =====================
+//   INA236 : configuration et alertes
+// =====================
+
+void Capteurs::setInaAlerte(uint8_t battPin,   InaAlerte battFonction,
+                            uint8_t mesurePin, InaAlerte mesureFonction)
+{
+    ina_batt_alert_pin   = battPin;
+    ina_batt_alerte      = battFonction;
+    ina_mesure_alert_pin = mesurePin;
+    ina_mesure_alerte    = mesureFonction;
+}
+
+void Capteurs::configureINA(INA236& ina, uint8_t moyenne, uint8_t alertPin, InaAlerte fonction)
+{
+    // Filtrage fait par la puce : N échantillons x (1.1 ms bus + 1.1 ms shunt)
+    ina.setAverage(moyenne);
+    ina.setBusVoltageConversionTime(INA_CT_1100US);
+    ina.setShuntVoltageConversionTime(INA_CT_1100US);
+
+    if (fonction == InaAlerte::AUCUNE || alertPin == PAS_DE_BROCHE) {
+        ina.setAlertRegister(0);
+        return;
+    }
+
+    if (fonction == InaAlerte::SURINTENSITE) {
+        float limite = (ALERTE_SURINTENSITE_mA / 1000.0f) * INA_SHUNT_OHM / 2.5e-6f;
+        if (limite > 32767.0f) limite = 32767.0f;
+        ina.setAlertLimit((uint16_t)limite);
+        ina.setAlertRegister(INA_MASK_SOL | INA_MASK_LEN);
+    } else {
+        ina.setAlertLimit((uint16_t)(ALERTE_SOUS_TENSION_V / 1.6e-3f));
+        ina.setAlertRegister(INA_MASK_BUL | INA_MASK_LEN);
+    }
+
+    // ALERT est open-drain, actif bas
+    pinMode(alertPin, INPUT_PULLUP);
+    if (&ina == &ina_batt) attachInterrupt(digitalPinToInterrupt(alertPin), isrAlerteBatt,   FALLING);
+    else                   attachInterrupt(digitalPinToInterrupt(alertPin), isrAlerteMesure, FALLING);
+
+    Serial.print("[OK] ALERT INA sur D"); Serial.print(alertPin);
+    Serial.println(fonction == InaAlerte::SURINTENSITE ? " (surintensite)" : " (sous-tension)");
+}
+
+void Capteurs::updateAlertes()
+{
+    { ChronoPortee c(Etape::CAPT_ALERTES); traiteAlertes(); }
+    publish();
+}
+
+void Capteurs::traiteAlertes()
+{
+    if (s_alerteBatt) {
+        s_alerteBatt = false;
+        if (ina_batt_ok) traiteAlerteINA(ina_batt, ina_batt_alerte);
+    }
+
+    if (s_alerteMesure) {
+        s_alerteMesure = false;
+        if (ina_mesure_ok) traiteAlerteINA(ina_mesure, ina_mesure_alerte);
+    }
+}
+
+void Capteurs::traiteAlerteINA(INA236& ina, InaAlerte fonction)
+{
+    // La lecture de MASK/ENABLE acquitte l'alerte mémorisée (LEN)
+    uint16_t flags = ina.getAlertFlag();
+    if (!(flags & INA_FLAG_AFF)) return;   // front parasite
+
+    modifie = true;
+
+    if (fonction == InaAlerte::SURINTENSITE) {
+        data.power.alerteSurintensite = true;
+        LOG_ALERTE("INA", "ALERTE surintensite");
+    } else if (fonction == InaAlerte::SOUS_TENSION) {
+        data.power.alerteSousTension = true;
+        LOG_ALERTE("INA", "ALERTE sous-tension");
     }
 }
 
 float Capteurs::getBatteryPercent() const
+{
+    return versFloat(socBatterie());
+}
+
+CompteurCoulomb::Reel Capteurs::socBatterie() const
 {
     // SoC estimé via coulomb counter (si INA batt absent => 0)
-    if (!ina_batt_ok) return 0.0f;
-    return data.power.soc1_percent;
+    if (!ina_batt_ok) return CompteurCoulomb::Reel();
+    return coulomb_batt.soc();
 }
 
 // =====================
@@ -300,14 +905,34 @@ void Capteurs::printDebug()
     Serial.print("LEAK (D"); Serial.print(leak_pin); Serial.print(") ");
     Serial.print("present="); Serial.print(data.leak.sensorPresent ? "YES" : "NO");
     Serial.print(" now="); Serial.print(data.leak.leakNow ? "LEAK" : "DRY");
-    Serial.print(" latched="); Serial.println(data.leak.leakLatched ? "LEAK" : "DRY");
+    Serial.print(" latched="); Serial.print(data.leak.leakLatched ? "LEAK" : "DRY");
+    Serial.print(" isr="); Serial.print(data.leak.interruptActive ? "ON" : "OFF");
+    Serial.print(" parasites="); Serial.print(data.leak.parasites);
+    if (data.leak.failsafeDeclenche) {
+        Serial.print(" failsafe="); Serial.print(data.leak.latenceFailsafe_us); Serial.print("us");
+    }
+    Serial.println();
+
+    // Profondeur
+    if (depth_ok) {
+        Serial.print("DEPTH (0x"); Serial.print(ms_addr, HEX); Serial.println(")");
+        Serial.print("  P="); Serial.print(data.depth.pressure_mbar);
+        Serial.print("mbar z="); Serial.print(data.depth.depth_m);
+        Serial.print("m zf="); Serial.print(data.depth.profondeurFiltree_m, 3);
+        Serial.print("m vz="); Serial.print(data.depth.vitesseVerticale_mps, 3);
+        Serial.print("m echantillons="); Serial.print(baro.sampleCount());
+        Serial.print(" cycle="); Serial.print(baro.lastCycle_us());
+        Serial.println("us");
+    } else {
+        Serial.println("DEPTH: capteur absent");
+    }
 
     // Batterie
     if (ina_batt_ok) {
         Serial.print("BAT (0x"); Serial.print(ina_batt_addr, HEX); Serial.println(")");
         Serial.print("  V="); Serial.print(data.power.busVoltage_V);
         Serial.print("V I="); Serial.print(data.power.current_mA);
-        Serial.print("mA SoC="); Serial.print(data.power.soc1_percent);
+        Serial.print("mA SoC="); Serial.print(getBatteryPercent());
         Serial.println("%");
     } else {
         Serial.println("BAT: capteur absent");
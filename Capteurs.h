@@ -7,7 +7,9 @@
 #include <Adafruit_BNO055.h>
 #include <utility/imumaths.h>
 #include <INA236.h>
-#include <MS5837.h>
+#include "MS5837Async.h"
+#include "EstimateurVertical.h"
+#include "PointFixe.h"
 
 // =====================
 //   Structures de données
@@ -19,25 +21,44 @@ struct IMUData
     float ax, ay, az;
     float gx, gy, gz;
 
+    // Accélération verticale hors gravité (LIA projetée sur GRV), + vers le bas
+    float accVerticale_mps2;
+
     uint8_t sysCal, gyroCal, accelCal, magCal;
+
+    uint32_t t_ms;   // instant de l'échantillon (millis)
+    uint32_t seq;    // incrémenté à chaque nouvel échantillon
 };
 
 struct PowerData
 {
     // Voie 1 (INA #1, batterie globale)
+    // Seuls tension bus et courant sont lus, la puissance est calculée ici
     float busVoltage_V;
-    float shuntVoltage_mV;
     float current_mA;
     float power_mW;
 
     // Voie 2 (INA #2, mesure)
     float busVoltage2_V;
-    float shuntVoltage2_mV;
     float current2_mA;
     float power2_mW;
 
-    // SoC (%) UNIQUEMENT sur la batterie (voie 1)
-    float soc1_percent;
+    // SoC (%) de la batterie : calculé à la lecture, cf. Capteurs::socBatterie()
+
+    uint32_t t_ms,  seq;    // voie 1 (batterie)
+    uint32_t t2_ms, seq2;   // voie 2 (mesure)
+
+    // Alertes matérielles (broche ALERT des INA236), mémorisées jusqu'au reset
+    bool alerteSurintensite;
+    bool alerteSousTension;
+};
+
+// Fonction affectée à la broche ALERT d'un INA236 (une seule par puce)
+enum class InaAlerte : uint8_t
+{
+    AUCUNE,
+    SURINTENSITE,   // shunt over-voltage -> courant > seuil
+    SOUS_TENSION    // bus under-voltage  -> tension < seuil
 };
 
 struct LeakData
@@ -46,6 +67,13 @@ struct LeakData
     bool sensorPresent;  // "présence" au boot (test de cohérence du signal)
     bool leakNow;        // état instantané (HIGH = fuite)
     bool leakLatched;    // mémorisé : reste true jusqu'au reset si latch activé
+
+    // Chemin rapide par interruption (fronts sur leak_pin, filtre horodaté)
+    bool     interruptActive;     // broche capable d'interruption et ISR armée
+    bool     failsafeDeclenche;   // fuite traitée (failsafe exécuté s'il est configuré)
+    bool     detectionParIsr;     // true : détecté par l'ISR, false : par scrutation
+    uint32_t latenceFailsafe_us;  // front -> failsafe exécuté (filtre compris)
+    uint16_t parasites;           // fronts rejetés par le filtre anti-glitch
 };
 
 struct DepthData
@@ -53,6 +81,44 @@ struct DepthData
     float pressure_mbar;
     float depth_m;
     float temperature_C;
+
+    uint32_t t_ms;   // fin de conversion D2 (millis)
+    uint32_t seq;
+
+    // Estimateur vertical (MS5837 + accélération IMU), mis à jour aussi
+    // entre deux échantillons, à la cadence IMU. + vers le bas.
+    bool  estimationValide;     // au moins un échantillon de profondeur reçu
+    float profondeurFiltree_m;
+    float vitesseVerticale_mps;
+    float profondeurPredite_m;  // à l'horizon d'actionnement (setHorizonPrediction)
+
+    // Mêmes grandeurs pour le chemin par tick (AsservProfond), écrites une
+    // fois par échantillon : depth_q depuis la pression entière du MS5837,
+    // les deux autres à chaque mise à jour de l'estimateur (float)
+    Q16_16 depth_q;
+    Q16_16 profondeurFiltree_q;
+    Q16_16 vitesseVerticale_q;
+};
+
+// =====================
+//   Cadence d'échantillonnage par capteur
+// =====================
+
+enum class SensorId : uint8_t
+{
+    LEAK,
+    IMU,
+    POWER_BATT,
+    POWER_MESURE,
+    DEPTH,
+    COUNT
+};
+
+struct SamplePolicy
+{
+    uint16_t periode_ms;  // 0 = à chaque appel de update()
+    uint16_t phase_ms;    // décalage pour étaler les lectures I2C entre les ticks
+    uint32_t prochain_ms; // prochaine lecture due
 };
 
 struct CapteursData
@@ -61,22 +127,36 @@ struct CapteursData
     PowerData power;
     LeakData  leak;
     DepthData depth;
+
+    uint32_t frameId;   // incrémenté à chaque publication (au moins un bloc nouveau)
+    uint32_t t_ms;      // instant de publication
 };
 
+// Âge d'un échantillon (t_ms d'un bloc) ; 0xFFFFFFFF si jamais reçu
+inline uint32_t ageEchantillon_ms(uint32_t t_ms, uint32_t now_ms)
+{
+    return (t_ms == 0) ? 0xFFFFFFFFUL : (now_ms - t_ms);
+}
+
 // =====================
 //   CoulombCounter
 // =====================
 
 class CoulombCounter {
 public:
+    typedef float Reel;   // type de soc()
+
     CoulombCounter(float capacity_mAh = 2200.0f, float initial_soc = 100.0f);
 
     void reset(float initial_soc = 100.0f);
 
     // courant en mA, positif = décharge
     void update(float current_mA);
+    // Un pas d'intégration (update() sans l'horloge)
+    void integre(float current_mA, uint32_t dt_ms);
 
     float get_soc() const;
+    float soc() const { return get_soc(); }
 
 private:
     float         capacity_mAh;
@@ -85,6 +165,43 @@ private:
     bool          initialized;
 };
 
+// Même interface, charge entière en mA.ms Q16.16 (int64) : pas d'arrondi
+// à l'intégration. En float, un pas de 100 ms à 150 mA (4e-3 mAh) ne vaut
+// qu'une quinzaine d'ulp d'une charge de 2200 mAh : quelques % de chaque pas
+// sont perdus. Voir PointFixe.h.
+//
+// L'intégration ne fait qu'une multiplication ; soc() divise (64 bits) et
+// n'est donc calculé qu'à la lecture, une fois par changement de charge.
+class CoulombCounterFixe {
+public:
+    typedef Q16_16 Reel;
+
+    CoulombCounterFixe(float capacity_mAh = 2200.0f, float initial_soc = 100.0f);
+
+    void reset(float initial_soc = 100.0f);
+    void update(float current_mA);
+    void integre(float current_mA, uint32_t dt_ms);
+
+    float  get_soc() const { return soc().versFloat(); }
+    Q16_16 soc() const;
+
+private:
+    int64_t       capacite;      // mA.ms * 2^16
+    int64_t       charge;        // mA.ms * 2^16
+    int64_t       parPourcent;   // capacite / 100, dans l'unité de soc() (Q16.16)
+    unsigned long last_millis;
+    bool          initialized;
+
+    mutable int64_t chargeSoc;   // charge de la dernière division
+    mutable Q16_16  socCalcule;
+};
+
+#if POINT_FIXE
+typedef CoulombCounterFixe CompteurCoulomb;
+#else
+typedef CoulombCounter     CompteurCoulomb;
+#endif
+
 // =====================
 //   Classe Capteurs
 // =====================
@@ -100,23 +217,67 @@ public:
         uint8_t hihAddress        = 0x27,  // IGNORÉ (ancien capteur humidité)
         uint8_t msAddress         = 0x76,
         float   battCapacity_mAh  = 2200.0f,
-        uint8_t leakPin           = 2,     // D2 par défaut
+        uint8_t leakPin           = 1,     // D1 : EXTINT7 (D2 n'a pas d'interruption externe sur MKR)
         bool    leakLatch         = true   // mémorise la fuite
     );
 
     bool begin();
     void calibrate(bool verbose = true);
+    // Lit uniquement les capteurs dont la période est échue
     void update();
     void printDebug();
 
-    const IMUData&      getIMUData()   const { return data.imu; }
-    const PowerData&    getPowerData() const { return data.power; }
-    const LeakData&     getLeakData()  const { return data.leak; }
-    const DepthData&    getDepthData() const { return data.depth; }
-    const CapteursData& getAllData()   const { return data; }
+    // Cadence par capteur (période + phase, en ms). Pour DEPTH la période
+    // est l'intervalle entre deux lancements de conversion D1/D2.
+    void setSamplePolicy(SensorId id, uint16_t periode_ms, uint16_t phase_ms = 0);
+    const SamplePolicy& getSamplePolicy(SensorId id) const { return policies[(uint8_t)id]; }
+
+    // Broches ALERT des INA236 (open-drain, actif bas) et fonction associée.
+    // À appeler avant begin(). 0xFF = pas de broche câblée.
+    void setInaAlerte(uint8_t battPin,   InaAlerte battFonction,
+                      uint8_t mesurePin, InaAlerte mesureFonction);
+
+    // Action immédiate sur fuite confirmée (ex: coupure moteurs + ballastVider),
+    // exécutée en contexte différé hors boucle principale. Doit être courte.
+    void setLeakFailsafe(void (*failsafe)());
+
+    // Traite une alerte INA signalée par interruption (lecture/acquittement I2C)
+    void updateAlertes();
+
+    // Mise à jour capteur par capteur (hors politique de cadence)
+    void updateLeak();
+    void updateIMU();
+    void updatePower();
+    void updateDepth();
+
+    // Instantané cohérent : double tampon publié en fin de mise à jour.
+    // La référence reste valide et inchangée jusqu'à la publication suivante
+    // (au moins une tâche), copier via getSnapshot() pour la garder plus longtemps.
+    const CapteursData& snapshot() const { return published[front]; }
+    void     getSnapshot(CapteursData& out) const { out = published[front]; }
+    uint32_t frameId() const { return published[front].frameId; }
+
+    const IMUData&      getIMUData()   const { return snapshot().imu; }
+    const PowerData&    getPowerData() const { return snapshot().power; }
+    const LeakData&     getLeakData()  const { return snapshot().leak; }
+    const DepthData&    getDepthData() const { return snapshot().depth; }
+    const CapteursData& getAllData()   const { return snapshot(); }
+
+    // Profondeur périmée : MS5837 muet (ou absent) depuis plus de maxAge_ms
+    bool isDepthStale(uint32_t maxAge_ms = 500) const;
+
+    // Horizon de DepthData::profondeurPredite_m (retard servo + ballast)
+    void setHorizonPrediction(float horizon_s) { horizonPrediction_s = horizon_s; }
+    EstimateurVertical& getEstimateur() { return estimateur; }
+
+    // Compare l'ancienne lecture IMU (getEvent) à la lecture en rafale (µs sur Serial)
+    void benchmarkIMU(uint8_t iterations = 20);
 
     // ✅ Ajout pour Safety (évite d'exposer une struct BatteryData inexistante)
     float getBatteryPercent() const;
+    // Même SoC dans le type du compteur (Q16_16 si POINT_FIXE), sans
+    // conversion ; calculé à la lecture, pas à chaque intégration
+    CompteurCoulomb::Reel socBatterie() const;
 
 private:
     uint8_t bno_addr;
@@ -129,10 +290,16 @@ private:
     uint8_t leak_pin;
     bool    leak_latch;
 
+    // Broches ALERT INA236
+    uint8_t   ina_batt_alert_pin;
+    uint8_t   ina_mesure_alert_pin;
+    InaAlerte ina_batt_alerte;
+    InaAlerte ina_mesure_alerte;
+
     Adafruit_BNO055 bno;
     INA236          ina_batt;    // batterie
     INA236          ina_mesure;  // mesure
-    MS5837          baro;
+    MS5837Async     baro;        // profondeur, lecture en deux phases
 
     bool imu_ok;
     bool ina_batt_ok;
@@ -140,12 +307,37 @@ private:
     bool depth_ok;
 
     // CoulombCounter UNIQUEMENT pour la batterie
-    CoulombCounter coulomb_batt;
+    CompteurCoulomb coulomb_batt;
+
+    // Profondeur + vitesse verticale
+    EstimateurVertical estimateur;
+    float              horizonPrediction_s;
+    void               publieEstimation();
+
+    CapteursData data;            // tampon de travail, modifié pendant les mises à jour
+    CapteursData published[2];    // instantanés publiés (double tampon)
+    uint8_t      front;
+    bool         modifie;         // un bloc a changé depuis la dernière publication
+
+    void publish();
+    void scruteFuite();      // updateLeak() sans publication
+    void traiteAlertes();    // updateAlertes() sans publication
+
+    SamplePolicy policies[(uint8_t)SensorId::COUNT];
+    bool         sampleDue(SensorId id, uint32_t now);
+    void         configureINA(INA236& ina, uint8_t moyenne, uint8_t alertPin, InaAlerte fonction);
+    void         traiteAlerteINA(INA236& ina, InaAlerte fonction);
+    void         updatePowerBatt();
+    void         updatePowerMesure();
+    void         pollDepth(bool lancer);
 
-    CapteursData data;
+    // IMU : rafale unique de registres (rapide) / API Adafruit (référence)
+    bool readIMUBurst();
+    void readIMUEvents();
 
     // test de cohérence du leak sensor au boot (signal stable / fuite au boot)
     void leakBootCheck(uint32_t test_ms = 500, uint8_t max_transitions = 5);
+    void armLeakInterrupt();
 };
 
 #endif
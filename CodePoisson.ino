@@ -5,6 +5,12 @@
 #include "Wifi.h"
 #include "Safety.h"
 #include "StateMachine.h"
+#include "Scheduler.h"
+#include "Telemetrie.h"
+#include "CanalUdp.h"
+#include "Journal.h"
+#include "Metriques.h"
+#include "BancPointFixe.h"
 
 // ==========================================
 // INSTANCIATION DES OBJETS GLOBAUX
@@ -30,14 +36,49 @@ StateMachine stateMachine(commandMotor, capteurs, safety);
 // Controller a besoin de Motor et StateMachine
 Controller controller(commandMotor, stateMachine);
 
+Scheduler scheduler;
+
+// Boîte noire : historique compact en RAM, servi par /log
+Telemetrie telemetrie;
+
+// Pilotage basse latence (datagrammes), en parallèle du /cmd HTTP
+CanalUdp canalUdp;
+
+// ==========================================
+// CADENCES DES TACHES (période en µs, priorité 0 = la plus haute)
+// ==========================================
+static const uint32_t PERIODE_SAFETY_US   = 10000;  // 100 Hz : fuite + safety
+static const uint32_t PERIODE_MOTEUR_US   = 10000;  // 100 Hz : fin des mouvements de direction
+static const uint32_t PERIODE_UDP_US      = 2000;   // 500 Hz : commandes UDP (latence < 2 ms + réseau)
+static const uint32_t PERIODE_CAPTEURS_US = 5000;   // 200 Hz : tick capteurs (cadence par capteur dans Capteurs)
+static const uint32_t PERIODE_CONTROLE_US = 40000;  //  25 Hz : asserv + machine d'état
+static const uint32_t PERIODE_WIFI_US     = 50000;  //  20 Hz : pas de la connexion WiFi (scrutation interne plus lente)
+
+static const uint32_t ATTENTE_SERIE_MS    = 3000;
+
+void tacheSafety();
+void failsafeFuite();
+void tacheMoteur();
+void tacheUdp();
+void tacheCapteurs();
+void tacheControle();
+bool bancAutorise();
+void tacheWeb();
+void tacheWifi();
+void tacheJournal();
+void surWifiConnecte();
+void surWifiPerdu();
+
 
 // ==========================================
 // SETUP
 // ==========================================
 void setup() {
   Serial.begin(115200);
-  while (!Serial) {
-    ; // attendre ouverture port série (USB natif)
+  // Attente du port série (USB natif) bornée : sans PC branché on démarre quand même
+  uint32_t debutSerie = millis();
+  while (!Serial && millis() - debutSerie < ATTENTE_SERIE_MS) {
+    ;
   }
 
   Serial.println("=== DEMARRAGE POISSON  ===");
@@ -54,6 +95,7 @@ void setup() {
 
   // 3. Init Capteurs
   Serial.println("[SETUP] Init Capteurs...");
+  capteurs.setLeakFailsafe(failsafeFuite);
   if (!capteurs.begin()) {
     Serial.println("[SETUP] ERREUR capteurs, blocage.");
     // On ne bloque pas infiniment pour le debug, mais attention en réel
@@ -62,15 +104,30 @@ void setup() {
 
   Serial.println("[SETUP] Calibration capteurs...");
   capteurs.calibrate(true);
+  capteurs.benchmarkIMU();
 
   // 4. Init Safety & StateMachine
   safety.begin();
   stateMachine.begin();
 
-  // 5. Init Wifi
+  // 5. Init Wifi : non bloquant, la connexion se poursuit dans tacheWifi
   Serial.println("Init Wifi...");
+  setCallbacksWifi(surWifiConnecte, surWifiPerdu);
+  setAsservWeb(&stateMachine.asserv());
   setupWifi();
 
+  // 6. Ordonnanceur
+  scheduler.addTask("safety",   tacheSafety,   PERIODE_SAFETY_US,   0);
+  scheduler.addTask("moteur",   tacheMoteur,   PERIODE_MOTEUR_US,   1);
+  scheduler.addTask("udp",      tacheUdp,      PERIODE_UDP_US,      2);
+  scheduler.addTask("capteurs", tacheCapteurs, PERIODE_CAPTEURS_US, 3);
+  scheduler.addTask("controle", tacheControle, PERIODE_CONTROLE_US, 4);
+  scheduler.addTask("wifi",     tacheWifi,     PERIODE_WIFI_US,     5);
+  scheduler.addBackgroundTask("web", tacheWeb);
+  scheduler.addBackgroundTask("journal", tacheJournal);
+  scheduler.begin();
+  metriques.attache(&scheduler);
+
   Serial.println("[SETUP] OK. Pret.");
   Serial.println();
 }
@@ -79,7 +136,57 @@ void setup() {
 // LOOP
 // ==========================================
 void loop() {
-  
+  // Plus de delay() : chaque sous-système tourne à sa propre cadence
+  scheduler.run();
+}
+
+// ==========================================
+// TACHES
+// ==========================================
+
+// Fuite confirmée (appelé hors boucle, depuis le contexte différé de l'ISR) :
+// propulsion coupée sans attendre Safety / StateMachine, ballast vidé
+// par tacheMoteur au tick suivant
+void failsafeFuite() {
+  commandMotor.coupureImmediate();
+}
+
+// 100 Hz : la fuite est relue et le Safety évalué à chaque tick.
+// En urgence, la réaction matérielle (comme updateEmergency, idempotente)
+// est appliquée tout de suite ; la transition d'état suit dans
+// tacheControle, seule tâche qui fait tourner la machine d'état.
+void tacheSafety() {
+  capteurs.updateLeak();
+  capteurs.updateAlertes();   // ALERT INA236 (surintensité / sous-tension)
+
+  // Safety check (retourne un état d'urgence si problème détecté)
+  EmergencyState e;
+  {
+    ChronoPortee c(Etape::SAFETY);
+    e = safety.update(capteurs);
+  }
+
+  // Si le Safety détecte un problème, on force l'urgence dans la machine
+  if (e != EmergencyState::NONE) {
+      stateMachine.setEmergency(e);
+      commandMotor.coupureUrgence();
+  }
+}
+
+// 100 Hz : les mouvements du servo de direction et la rampe du servo
+// ballast sont découpés en ticks
+void tacheMoteur() {
+  commandMotor.update();
+}
+
+// 500 Hz : au plus un datagramme par tick, la commande est appliquée
+// directement (Controller::onKey) sans attendre la tâche de contrôle
+void tacheUdp() {
+  canalUdp.update(controller, capteurs);
+}
+
+void tacheControle() {
+
   // 1) LECTURE DES TOUCHES SERIE (Tout au même endroit)
   while (Serial.available() > 0) {
     char c = Serial.read();
@@ -92,37 +199,116 @@ void loop() {
       Serial.println("!!! EMERGENCY STATE TRIGGERED MANUALLY !!!");
       stateMachine.setEmergency(EmergencyState::LEAK);
     } 
+    else if (c == 't') {
+      // Statistiques de l'ordonnanceur (overruns, pire durée, histogramme de retard)
+      scheduler.printStats();
+    }
+    else if (c == 'p') {
+      // État des capteurs (dont cadence réelle du MS5837)
+      capteurs.printDebug();
+    }
+    else if (c == 'w') {
+      // Temps de service des réponses /data
+      printStatsWeb();
+    }
+    else if (c == 'm') {
+      // Métriques : boucle, tâches (durée, retard), étapes capteurs / contrôle
+      metriques.print(Serial);
+    }
+    else if (c == 'M') {
+      metriques.reset();
+      Serial.println("[Metriques] Remise a zero");
+    }
+    else if (c == 'i') {
+      // Liaison WiFi (SSID, IP)
+      printWifiStatus();
+    }
+    else if (c == 'u') {
+      // Canal UDP : paquets acceptés / rejetés, temps réception -> actionneurs
+      canalUdp.printStats();
+    }
+    else if (c == 'b') {
+      // Etage actionneur ballast : consignes reçues / évitées, écritures servo
+      commandMotor.printStatsServo();
+    }
+    else if (c == 'x') {
+      // Virgule fixe / float : écart et durée par appel, à l'arrêt seulement
+      if (!bancAutorise()) {
+        Serial.println("[PointFixe] refuse : poisson hors IDLE ou propulsion active");
+      } else if (!bancPointFixeEnCours()) {
+        bancPointFixeDemarre();
+      }
+    }
+    else if (c == 'T') {
+      // Remise à zéro des statistiques (ex: avant une mesure sous charge web)
+      scheduler.resetStats();
+      Serial.println("[Sched] Statistiques remises a zero");
+    }
     else {
       // Sinon on envoie la touche au controller
       controller.onKey(c);
     }
   }
 
-  // 2) LOGIQUE PRINCIPALE
-  
-  // Met à jour le mode (Manuel/Auto)
-  // Note: Controller appelle stateMachine.update() SI on est en mode AUTONOMOUS
-  controller.update();
+  // Banc 'x' : une tranche par tick, abandonné dès que le poisson repart
+  if (bancPointFixeEnCours()) {
+    if (bancAutorise()) bancPointFixeTranche();
+    else                bancPointFixeAbandonne();
+  }
 
-  // 3) CAPTEURS & SAFETY
-  capteurs.update();
-  
-  // Safety check (retourne un état d'urgence si problème détecté)
-  EmergencyState e = safety.update(capteurs);
-  
-  // Si le Safety détecte un problème, on force l'urgence dans la machine
-  if (e != EmergencyState::NONE) {
-      stateMachine.setEmergency(e);
+  // 2) STATE MACHINE : seul appel de stateMachine.update(), en mode
+  // MANUEL aussi pour gérer l'urgence (update() ne fait rien si IDLE)
+  {
+    ChronoPortee c(Etape::MACHINE_ETAT);
+    stateMachine.update();
   }
 
-  // 4) STATE MACHINE (Mise à jour inconditionnelle pour gérer l'urgence)
-  // On l'appelle ici pour être sûr que l'état EMERGENCY est géré même en mode MANUEL
-  // (La fonction update() du StateMachine a une protection pour ne rien faire si IDLE)
-  stateMachine.update();
+  // 3) Met à jour le mode (Manuel/Auto) : retour en MANUEL si mission finie
+  {
+    ChronoPortee c(Etape::CONTROLEUR);
+    controller.update();
+  }
+}
+
+// Tick rapide : Capteurs ne lit que les capteurs dont la période est échue
+// (IMU 50 Hz, profondeur 20 Hz, batterie 10 Hz, INA mesure 2 Hz, phases décalées)
+// et relit une conversion MS5837 dès qu'elle est prête
+// Banc 'x' : poisson à l'arrêt (IDLE, sans urgence) et propulsion à 0
+bool bancAutorise() {
+  return stateMachine.getCurrentState() == FishState::IDLE
+      && stateMachine.getEmergency() == EmergencyState::NONE
+      && commandMotor.getDriverPwm() == 0;
+}
 
-  // 5) WIFI
-  gestionServeurWeb(controller, capteurs);
+void tacheCapteurs() {
+  capteurs.update();
+  ChronoPortee c(Etape::TELEMETRIE);
+  telemetrie.update(capteurs, commandMotor, stateMachine);
+}
+
+// Connexion WiFi : un pas borné de la machine d'états
+void tacheWifi() {
+  updateWifi();
+}
 
-  // Petite pause pour ne pas saturer
-  delay(50);
-}
\ No newline at end of file
+// (Re)connexion : le serveur HTTP est relancé par Wifi.cpp, l'UDP ici
+void surWifiConnecte() {
+  canalUdp.begin();
+}
+
+void surWifiPerdu() {
+  canalUdp.stop();
+}
+
+// Tâche de fond : le journal part sur Serial sans jamais attendre le PC
+void tacheJournal() {
+  journal.vidange();
+}
+
+// Tâche de fond : le web prend le temps restant entre deux échéances,
+// plafonné pour que les tâches périodiques gardent leur cadence
+void tacheWeb() {
+  uint32_t budget = scheduler.tempsDisponible_us();
+  if (budget > BUDGET_WEB_DEFAUT_US) budget = BUDGET_WEB_DEFAUT_US;
+  gestionServeurWeb(controller, capteurs, telemetrie, budget);
+}
@@ -1,20 +1,46 @@
 #include "CommandMotor.h"
+#include "Journal.h"
+#include "Horloge.h"
 #include <Servo.h>
 
-// Variable pour mémoriser l'état : 0 = Centre, 1 = Droite, -1 = Gauche
-static int etatDirection = 0; 
-static const int DUREE_MOUVEMENT = 1000; // Temps en ms (1 seconde)
+// Temps de rotation du FT90R entre le centre et une butée (ms)
+static const int32_t DUREE_MOUVEMENT = 1000;
+
+// Commandes du FT90R (servo à rotation continue)
+static const int DIRECTION_VERS_DROITE = 0;
+static const int DIRECTION_VERS_GAUCHE = 180;
+static const int DIRECTION_ARRET       = 90;
+
+// Etage actionneur ballast, réglages par défaut. Le bruit du capteur de
+// profondeur fait osciller la sortie du PID de quelques dixièmes de degré :
+// sans bande morte, la crémaillère bouge en permanence (courant servo).
+// 1 deg de crémaillère ~ 0,3 mL de ballast, négligeable pour la flottabilité.
+static const float VITESSE_SERVO_DEFAUT_DPS = 90.0f;
+static const float BANDE_MORTE_DEFAUT_DEG   = 1.0f;
+static const float HYSTERESIS_DEFAUT_DEG    = 1.0f;
+
+// Tick moteur manqué : le mouvement ne rattrape pas plus que ça d'un coup
+static const uint32_t PAS_SERVO_MAX_US = 50000;
+
+static const int ANGLE_BALLAST_VIDE      = 0;     // à ajuster avec ta géométrie
+static const int ANGLE_BALLAST_PLEIN     = 180;   // valeur fictive, à ajuster
+static const int ANGLE_BALLAST_EQUILIBRE = 30;    // valeur fictive, à ajuster
 
 CommandMotor::CommandMotor()
 {
     servo_ok = false;
     servoDirection_ok = false; // 2e servo non initialisé par défaut
+
+    _servoAngleCmd = ReelAsserv(0);
+    _servoConsigne = ReelAsserv(0);
+    setLimiteurServo(VITESSE_SERVO_DEFAUT_DPS, BANDE_MORTE_DEFAUT_DEG, HYSTERESIS_DEFAUT_DEG);
 }
 
 bool CommandMotor::begin()
 {
     // ----- Servo ballast sur D0 -----
-    if (servo.attach(SERVO_PIN, pulseMin_us, pulseMax_us)) {
+    // attach() retourne l'index du servo (0 pour le premier), pas un booléen
+    if (servo.attach(SERVO_PIN, pulseMin_us, pulseMax_us) != INVALID_SERVO) {
         servo_ok = true;
         Serial.println("[OK] Servo SER0067 attaché sur D0");
     } else {
@@ -24,7 +50,7 @@ bool CommandMotor::begin()
 
     // ----- Servo direction sur SERVO_DIRECTION_PIN -----
     // NOTE : seulement la structure ici, tu pourras compléter la logique plus tard
-    if (servoDirection.attach(SERVO_DIRECTION_PIN, pulseMin_us, pulseMax_us)) {
+    if (servoDirection.attach(SERVO_DIRECTION_PIN, pulseMin_us, pulseMax_us) != INVALID_SERVO) {
         servoDirection_ok = true;
         Serial.println("[OK] Servo direction attaché");
     } else {
@@ -47,26 +73,174 @@ bool CommandMotor::begin()
 
 void CommandMotor::setServoAngle(float angleDeg)
 {
+    commandeServo(reel<ReelAsserv>(angleDeg));
+}
+
+void CommandMotor::commandeServo(ReelAsserv angleDeg)
+{
+    typedef ReelAsserv T;
+
     if (!servo_ok) return;
 
-    if (angleDeg < 0.0f)   angleDeg = 0.0f;
-    if (angleDeg > 180.0f) angleDeg = 180.0f;
+    angleDeg = borneReel(angleDeg, T(0), T(180));
+
+    _statsServo.commandes++;
+
+    // Coupure d'urgence : plus rien ne remplit le ballast
+    if (_coupure || _ballastVerrouille) {
+        _statsServo.evitees++;
+        return;
+    }
+
+    // Position inconnue (rien d'écrit depuis le démarrage) : pas de rampe
+    if (!_servoInitialise) {
+        noInterrupts();
+        if (!_coupure && !_ballastVerrouille) forceServo(angleDeg);
+        interrupts();
+        return;
+    }
+
+    // Bande morte autour de la consigne tenue, élargie quand la consigne
+    // repart dans l'autre sens : le bruit ne fait pas osciller la crémaillère.
+    // Les butées (plein / vide) restent toujours atteignables.
+    T      ecart = angleDeg - _servoConsigne;
+    int8_t sens  = (T(0) < ecart) ? 1 : (ecart < T(0)) ? -1 : 0;
+    T      seuil = _bandeMorteServo_deg;
+    if (_sensServo != 0 && sens != _sensServo) seuil += _hysteresisServo_deg;
+
+    bool butee = (angleDeg == T(0) || angleDeg == T(180));
+    if (sens == 0 || ((sens > 0 ? ecart : -ecart) < seuil && !butee)) {
+        _statsServo.evitees++;
+        return;
+    }
+
+    _servoConsigne = angleDeg;
+    _sensServo     = sens;
+
+    // Premier pas tout de suite, la suite dans update()
+    updateServo(horloge_us());
+}
+
+void CommandMotor::setLimiteurServo(float vitesseMax_dps, float bandeMorte_deg, float hysteresis_deg)
+{
+    // Réglage (hors tick) : conversion depuis l'API float
+    _vitesseServoMax_dps = reel<ReelAsserv>((vitesseMax_dps < 0.0f) ? 0.0f : vitesseMax_dps);
+    _bandeMorteServo_deg = reel<ReelAsserv>((bandeMorte_deg < 0.0f) ? 0.0f : bandeMorte_deg);
+    _hysteresisServo_deg = reel<ReelAsserv>((hysteresis_deg < 0.0f) ? 0.0f : hysteresis_deg);
+}
+
+void CommandMotor::updateServo(uint32_t now_us)
+{
+    typedef ReelAsserv T;
+
+    uint32_t dt_us = now_us - _dernierPasServo_us;
+    _dernierPasServo_us = now_us;
+
+    if (!servo_ok || _servoAngleCmd == _servoConsigne) return;
+
+    // Rampe : au plus vitesseMax * dt vers la consigne
+    T angle = _servoConsigne;
+    if (T(0) < _vitesseServoMax_dps) {
+        if (dt_us > PAS_SERVO_MAX_US) dt_us = PAS_SERVO_MAX_US;
+        T maxPas = pasServo(_vitesseServoMax_dps, dt_us);
+        if (_servoAngleCmd + maxPas < angle) angle = _servoAngleCmd + maxPas;
+        if (angle < _servoAngleCmd - maxPas) angle = _servoAngleCmd - maxPas;
+    }
+
+    // Le failsafe fuite (contexte différé, préempte la boucle) peut avoir
+    // coupé entre-temps : on ne relance pas le servo
+    noInterrupts();
+    if (!_coupure && !_ballastVerrouille) ecritServo(angle);
+    interrupts();
+}
+
+// Pas d'angle permis pendant dt (deg/s x µs), sans division
+ReelAsserv CommandMotor::pasServo(ReelAsserv vitesse_dps, uint32_t dt_us)
+{
+#if POINT_FIXE
+    // 2^32 / 10^6 = 4294,97 : multiplication 64 bits puis décalage
+    int64_t p = (int64_t)vitesse_dps.brut() * dt_us * 4295;
+    return Q16_16::depuisBrut(Q16_16::sature(p >> 32));
+#else
+    return vitesse_dps * (dt_us * 1e-6f);
+#endif
+}
+
+// Largeur d'impulsion d'un angle déjà borné [0 ; 180]
+int CommandMotor::largeurImpulsion(ReelAsserv angleDeg)
+{
+#if POINT_FIXE
+    // brut <= 180 x 2^16 : brut x 2000 déborderait 32 bits, 2000 / 180 = 100 / 9
+    static_assert(pulseMax_us - pulseMin_us == 2000, "echelle servo");
+    return pulseMin_us + (int)(((uint32_t)angleDeg.brut() * 100u / 9u + (Q16_16::UN >> 1)) >> 16);
+#else
+    return pulseMin_us + (int)(angleDeg * (pulseMax_us - pulseMin_us) / 180.0f + 0.5f);
+#endif
+}
 
-    servo.write(angleDeg);
+// Quantification à la résolution du Servo (µs) : une consigne qui ne change
+// pas l'impulsion n'est pas réécrite
+void CommandMotor::ecritServo(ReelAsserv angleDeg)
+{
+    int pulse = largeurImpulsion(angleDeg);
+    _servoAngleCmd = angleDeg;
+
+    if (_servoInitialise && pulse == _servoPulse_us) {
+        _statsServo.identiques++;
+        return;
+    }
+
+    if (_servoInitialise) _statsServo.parcours_us += abs(pulse - _servoPulse_us);
+    servo.writeMicroseconds(pulse);
+    _servoPulse_us   = pulse;
+    _servoInitialise = true;
+    _statsServo.ecritures++;
+}
+
+// Hors bande morte et hors rampe : la consigne est écrite immédiatement
+void CommandMotor::forceServo(ReelAsserv angleDeg)
+{
+    _servoConsigne = angleDeg;
+    _sensServo     = 0;
+    ecritServo(angleDeg);
+}
+
+void CommandMotor::resetStatsServo()
+{
+    _statsServo = StatsServo();
+}
+
+void CommandMotor::printStatsServo()
+{
+    Serial.print("[Servo] commandes=");  Serial.print(_statsServo.commandes);
+    Serial.print(" evitees=");           Serial.print(_statsServo.evitees);
+    Serial.print(" ecritures=");         Serial.print(_statsServo.ecritures);
+    Serial.print(" identiques=");        Serial.print(_statsServo.identiques);
+    Serial.print(" parcours=");          Serial.print((long)_statsServo.parcours_deg());
+    Serial.println("deg");
+    Serial.print("[Servo] consigne=");   Serial.print(getServoConsigne(), 1);
+    Serial.print(" angle=");             Serial.print(getServoAngle(), 1);
+    Serial.print(" impulsion=");         Serial.print(_servoPulse_us);
+    Serial.print("us");
+    if (_ballastVerrouille) Serial.print(" VERROUILLE");
+    Serial.println();
 }
 
 // ============================================================
 //   GESTION BALLAST PAR SERVO + CREMAILLERE
 // ============================================================
 
+// Vidage : remontée et urgence, hors limiteur (tout de suite, pleine vitesse)
 void CommandMotor::ballastVider()
 {
     if (!servo_ok) {
         return;
     }
 
-    float angleEmptyDeg = 0.0f; // à ajuster avec ta géométrie
-    setServoAngle(angleEmptyDeg);
+    _statsServo.commandes++;
+    noInterrupts();
+    if (!_ballastVerrouille) forceServo(ReelAsserv(ANGLE_BALLAST_VIDE));
+    interrupts();
 }
 
 void CommandMotor::ballastRemplir()
@@ -75,8 +249,7 @@ void CommandMotor::ballastRemplir()
         return;
     }
 
-    float angleFullDeg = 180.0f; // valeur fictive, à ajuster
-    setServoAngle(angleFullDeg);
+    commandeServo(ReelAsserv(ANGLE_BALLAST_PLEIN));
 }
 void CommandMotor::ballastEquilibre()
 {
@@ -84,89 +257,118 @@ void CommandMotor::ballastEquilibre()
         return;
     }
 
-    float angleFullDeg = 30.0f; // valeur fictive, à ajuster
-    setServoAngle(angleFullDeg);
+    commandeServo(ReelAsserv(ANGLE_BALLAST_EQUILIBRE));
+}
+
+void CommandMotor::coupureImmediate()
+{
+    _coupure = true;
+    _driverPwmCmd = 0;
+    coupeBroche(DRIVER_PWM_A);
+    coupeBroche(DRIVER_PWM_B);
+}
+
+void CommandMotor::coupureUrgence()
+{
+    setDriverRaw(0, 0);
+    coupureImmediate();
+
+    if (servo_ok && !_ballastVerrouille) {
+        forceServo(ReelAsserv(ANGLE_BALLAST_VIDE));
+        _ballastVerrouille = true;
+    }
 }
 
 // ============================================================
-//   GESTION SERVO DE DIRECTION (2e servo) – SQUELETTE SEULEMENT
+//   GESTION SERVO DE DIRECTION (2e servo, FT90R)
 // ============================================================
 
-// ... (Haut du fichier inchangé) ...
+// Les mouvements ne bloquent plus la boucle : on fixe une consigne,
+// on lance la rotation et update() coupe le moteur une fois la position
+// estimée atteinte.
 
+void CommandMotor::servoDirectionDroite()
+{
+    setCibleDirection(1);
+}
 
+void CommandMotor::servoDirectionGauche()
+{
+    setCibleDirection(-1);
+}
 
-void CommandMotor::servoDirectionDroite()
+void CommandMotor::servoDirectionStop()
 {
-    // Si on est déjà braqué à droite, on ne fait rien (on attend que la touche soit relâchée)
-    if (etatDirection == 1) return;
+    setCibleDirection(0);
+}
 
-    // Si on était à gauche, on revient d'abord au centre (sécurité optionnelle)
-    if (etatDirection == -1) servoDirectionStop();
+void CommandMotor::update()
+{
+    // Coupure faite depuis l'interruption : le ballast est vidé ici
+    if (_coupure && !_ballastVerrouille) coupureUrgence();
 
-    Serial.println("[Motor] Braquage DROITE en cours...");
-    
-    // 1. On tourne le FT90R (Vitesse sens horaire)
-    servoDirection.write(0); 
-    
-    // 2. On attend le temps qu'il fasse le mouvement
-    delay(DUREE_MOUVEMENT);
-    
-    // 3. On coupe le moteur (il arrête de forcer, mais la crémaillère est en position)
-    servoDirection.write(90); 
-    
-    // 4. On note l'état
-    etatDirection = 1; 
-    //Serial.println("[Motor] Braquage DROITE terminé (attente).");
+    updateDirection(horloge_ms());
+    updateServo(horloge_us());
 }
 
-void CommandMotor::servoDirectionGauche()
+void CommandMotor::setCibleDirection(int8_t cible)
 {
-    // Si on est déjà braqué à gauche, on ne fait rien
-    if (etatDirection == -1) return;
-
-    // Si on était à droite, on revient d'abord au centre
-    if (etatDirection == 1) servoDirectionStop();
-
-    Serial.println("[Motor] Braquage GAUCHE en cours...");
-    
-    // 1. On tourne le FT90R (Vitesse sens anti-horaire)
-    servoDirection.write(180); 
-    
-    // 2. On attend
-    delay(DUREE_MOUVEMENT);
-    
-    // 3. On coupe
-    servoDirection.write(90); 
-    
-    // 4. On note l'état
-    etatDirection = -1;
-    //Serial.println("[Motor] Braquage GAUCHE terminé (attente).");
-}
-
-// Fonction pour revenir au centre (à ajouter)
-void CommandMotor::servoDirectionStop()
+    // Même consigne : rien à faire (touche maintenue, mouvement déjà lancé)
+    if (cible == _cibleDirection) return;
+
+    if (_sensRotation != 0) {
+        LOG_DEBUG("Motor", "Nouvelle consigne direction en cours de mouvement");
+    }
+
+    _cibleDirection = cible;
+
+    // Démarrage immédiat, sans attendre le prochain tick
+    updateDirection(horloge_ms());
+}
+
+void CommandMotor::updateDirection(unsigned long now)
 {
-    if (etatDirection == 0) return; // Déjà au centre
+    // 1. Intégration de la position pendant la rotation
+    if (_sensRotation != 0) {
+        _positionDirection_ms += _sensRotation * (int32_t)(now - _dernierPasDirection_ms);
+    }
+    _dernierPasDirection_ms = now;
 
-    Serial.println("[Motor] Retour au CENTRE...");
+    int32_t cible_ms = _cibleDirection * DUREE_MOUVEMENT;
+    int32_t erreur   = cible_ms - _positionDirection_ms;
 
-    if (etatDirection == 1) {
-        // On était à Droite, on tourne à Gauche pour revenir
-        servoDirection.write(180);
-        delay(DUREE_MOUVEMENT);
-        servoDirection.write(90);
+    // 2. Arrivé (ou dépassé) : on coupe le moteur, la crémaillère reste en place
+    if (erreur == 0 || (_sensRotation != 0 && erreur * _sensRotation < 0)) {
+        if (_sensRotation != 0) {
+            ecritRotationDirection(0);
+            _positionDirection_ms = cible_ms;
+            _etatDirection = _cibleDirection;
+
+            if (_etatDirection == 0) LOG_DEBUG("Motor", "Retour CENTRE terminé.");
+        }
+        return;
     }
-    else if (etatDirection == -1) {
-        // On était à Gauche, on tourne à Droite pour revenir
-        servoDirection.write(0);
-        delay(DUREE_MOUVEMENT);
-        servoDirection.write(90);
+
+    // 3. Il reste du chemin : on (re)lance la rotation dans le bon sens
+    int8_t sens = (erreur > 0) ? 1 : -1;
+    if (sens != _sensRotation) {
+        if      (_cibleDirection == 1)  LOG_DEBUG("Motor", "Braquage DROITE en cours...");
+        else if (_cibleDirection == -1) LOG_DEBUG("Motor", "Braquage GAUCHE en cours...");
+        else                            LOG_DEBUG("Motor", "Retour au CENTRE...");
+
+        ecritRotationDirection(sens);
     }
+}
 
-    // On est revenu au centre
-    etatDirection = 0;
-    Serial.println("[Motor] Retour CENTRE terminé.");
+void CommandMotor::ecritRotationDirection(int8_t sens)
+{
+    _sensRotation = sens;
+
+    if (!servoDirection_ok) return;
+
+    if      (sens > 0) servoDirection.write(DIRECTION_VERS_DROITE);
+    else if (sens < 0) servoDirection.write(DIRECTION_VERS_GAUCHE);
+    else               servoDirection.write(DIRECTION_ARRET);
 }
 
 // ============================================================
@@ -175,19 +377,57 @@ void CommandMotor::servoDirectionStop()
 
 void CommandMotor::setDriverRaw(uint8_t pwm4, uint8_t pwm5)
 {
-    analogWrite(DRIVER_PWM_A, pwm4);
-    analogWrite(DRIVER_PWM_B, pwm5);
+    // Vérifié et écrit sans préemption : analogWrite() ne reconnecte pas le
+    // timer sur une broche que coupureImmediate() vient de couper
+    noInterrupts();
+    if (!_coupure) {
+        _driverPwmCmd = pwm4;
+        analogWrite(DRIVER_PWM_A, pwm4);
+        analogWrite(DRIVER_PWM_B, pwm5);
+    }
+    interrupts();
+}
+
+// Broche forcée au niveau bas, sortie du multiplexeur du timer : trois
+// écritures de registre, sûres depuis une interruption
+void CommandMotor::coupeBroche(uint8_t pin)
+{
+#ifdef ARDUINO_ARCH_SAMD
+    const PinDescription& p = g_APinDescription[pin];
+    PORT->Group[p.ulPort].OUTCLR.reg = 1ul << p.ulPin;
+    PORT->Group[p.ulPort].DIRSET.reg = 1ul << p.ulPin;
+    PORT->Group[p.ulPort].PINCFG[p.ulPin].reg &= (uint8_t)~PORT_PINCFG_PMUXEN;
+#else
+    digitalWrite(pin, LOW);
+#endif
 }
 
 void CommandMotor::setDriverCommand(float command)
+{
+#if POINT_FIXE
+    uint8_t pwm = pwmDepuisCommande(Q8_24::depuisFloat(command));
+#else
+    uint8_t pwm = pwmDepuisCommande(command);
+#endif
+
+    // Moteur UNIQUEMENT en marche avant : D4 = PWM, D5 = 0
+    setDriverRaw(pwm, 0);
+}
+
+uint8_t CommandMotor::pwmDepuisCommande(float command)
 {
     // Commande normalisée [0 ; 1]
     if (command < 0.0f) command = 0.0f;
     if (command > 1.0f) command = 1.0f;
 
     // Conversion en PWM 0–255
-    uint8_t pwm = (uint8_t)(command * 255.0f + 0.5f);
+    return (uint8_t)(command * 255.0f + 0.5f);
+}
 
-    // Moteur UNIQUEMENT en marche avant : D4 = PWM, D5 = 0
-    setDriverRaw(pwm, 0);
+uint8_t CommandMotor::pwmDepuisCommande(Q8_24 command)
+{
+    command = borneReel(command, Q8_24(0), Q8_24(1));
+
+    // brut <= 2^24 : le produit tient sur 32 bits
+    return (uint8_t)(((uint32_t)command.brut() * 255 + (Q8_24::UN >> 1)) >> 24);
 }
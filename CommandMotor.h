@@ -3,6 +3,7 @@
 
 #include <Arduino.h>
 #include <Servo.h>
+#include "PointFixe.h"
 
 class CommandMotor
 
@@ -15,21 +16,71 @@ public:
     bool begin();
 
     // ------- SERVO (SER0067 Feetech sur D0) -------
-    // Commande l’angle du servo en degrés [0 ; 180]
+    // Consigne d’angle du servo en degrés [0 ; 180], via l'étage actionneur :
+    // bande morte (+ hystérésis au changement de sens), vitesse bornée
+    // (le mouvement se poursuit dans update()), écriture seulement si la
+    // largeur d'impulsion quantifiée (µs) change
     void setServoAngle(float angleDeg);
+    // Même étage dans le type du chemin par tick (AsservProfond), sans
+    // conversion : l'étage calcule en ReelAsserv (virgule fixe si POINT_FIXE)
+    void commandeServo(ReelAsserv angleDeg);
+
+    // Réglage de l'étage : vitesse max (deg/s, 0 = sans limite), bande morte
+    // et hystérésis supplémentaire au changement de sens (deg)
+    void setLimiteurServo(float vitesseMax_dps, float bandeMorte_deg, float hysteresis_deg);
+
+    // Compteurs de l'étage actionneur ballast
+    struct StatsServo {
+        uint32_t commandes;    // consignes reçues (setServoAngle)
+        uint32_t evitees;      // consignes absorbées (bande morte, hystérésis, verrou)
+        uint32_t ecritures;    // impulsions envoyées au servo
+        uint32_t identiques;   // écritures sautées : impulsion inchangée
+        uint32_t parcours_us;  // course cumulée écrite, en largeur d'impulsion
+
+        float parcours_deg() const { return parcours_us * (180.0f / (pulseMax_us - pulseMin_us)); }
+    };
+    const StatsServo& statsServo() const { return _statsServo; }
+    void resetStatsServo();
+    void printStatsServo();
 
     // ------- DRIVER 2x PWM (D4 / D5) -------
     // Commande brute : valeurs PWM 0–255 pour chaque pin
     void setDriverRaw(uint8_t pwmD4, uint8_t pwmD5);
 
+    // Commande normalisée [0 ; 1] -> PWM 0–255 (virgule fixe si POINT_FIXE)
     void setDriverCommand(float command);
 
+    // Mise à l'échelle seule, référence float et virgule fixe
+    static uint8_t pwmDepuisCommande(float command);
+    static uint8_t pwmDepuisCommande(Q8_24 command);
+
+    // Dernières commandes émises (télémétrie) : angle réellement écrit,
+    // en retard sur la consigne pendant un mouvement limité en vitesse
+    float      getServoAngle() const { return versFloat(_servoAngleCmd); }
+    float      getServoConsigne() const { return versFloat(_servoConsigne); }
+    ReelAsserv angleServo() const { return _servoAngleCmd; }
+    uint8_t getDriverPwm()  const { return _driverPwmCmd; }
+
     // === GESTION BALLAST PAR SERVO ===
     void ballastVider();                               // vider la ballast
     void ballastRemplir();                             // remplir la ballast
     void ballastEquilibre();
     void ballastSuivreProfondeur(float targetDepth_m, float currentDepth_m);
 
+    // Failsafe fuite, depuis le contexte différé de l'ISR (PendSV) : broches
+    // du driver forcées à 0 par écriture directe des registres (ni
+    // analogWrite ni Servo, qui ne sont pas réentrants) et coupure
+    // verrouillée. Plus aucune écriture driver ni ballast ne passe ensuite ;
+    // le vidage du ballast est fait par le prochain update() (100 Hz).
+    void coupureImmediate();
+    bool coupee() const { return _coupure; }
+
+    // Coupure propulsion + vidage ballast, hors interruption : le ballast
+    // est écrit tout de suite (hors limiteur) puis verrouillé vide jusqu'au
+    // redémarrage. Termine aussi une coupureImmediate().
+    void coupureUrgence();
+    bool ballastVerrouille() const { return _ballastVerrouille; }
+
     // === GESTION SERVO DE DIRECTION (2e servo) ===
     // Tourner le poisson / la queue à droite
     void servoDirectionDroite();
@@ -39,6 +90,18 @@ public:
     // Tourner le poisson / remet la queue au centre
     void servoDirectionStop();
 
+    // Les trois commandes ci-dessus ne bloquent plus : elles fixent une consigne
+    // et démarrent la rotation. update() termine le mouvement aux ticks suivants
+    // (idem pour le servo ballast limité en vitesse).
+    // Une nouvelle consigne en cours de mouvement remplace la précédente
+    // (le FT90R repart directement depuis sa position estimée).
+    void update();
+
+    // Position stable atteinte : -1 = gauche, 0 = centre, 1 = droite
+    int8_t getEtatDirection() const { return _etatDirection; }
+    int8_t getCibleDirection() const { return _cibleDirection; }
+    bool   directionEnMouvement() const { return _sensRotation != 0; }
+
 private:
     // -------- SERVO BALLAST --------
     Servo servo;
@@ -47,6 +110,27 @@ private:
     static const int SERVO_PIN     = 3;
     static const int pulseMin_us   = 500;   // SER0067
     static const int pulseMax_us   = 2500;  // SER0067
+    ReelAsserv _servoAngleCmd;
+    uint8_t    _driverPwmCmd  = 0;
+
+    // Etage actionneur ballast (angles en degrés)
+    ReelAsserv    _servoConsigne;
+    bool          _servoInitialise   = false;  // aucune impulsion écrite : 1re consigne directe
+    int8_t        _sensServo         = 0;      // sens de la dernière consigne acceptée
+    int           _servoPulse_us     = 0;      // dernière impulsion écrite
+    ReelAsserv    _vitesseServoMax_dps;
+    ReelAsserv    _bandeMorteServo_deg;
+    ReelAsserv    _hysteresisServo_deg;
+    uint32_t      _dernierPasServo_us = 0;
+    volatile bool _ballastVerrouille = false;
+    volatile bool _coupure           = false;  // coupure d'urgence, driver et ballast bloqués
+    StatsServo    _statsServo = {};
+
+    void updateServo(uint32_t now_us);
+    void ecritServo(ReelAsserv angleDeg);
+    void forceServo(ReelAsserv angleDeg);
+    static ReelAsserv pasServo(ReelAsserv vitesse_dps, uint32_t dt_us);
+    static int        largeurImpulsion(ReelAsserv angleDeg);
 
     // -------- SERVO DIRECTION --------
     Servo servoDirection;          // 2e servomoteur pour tourner droite/gauche
@@ -55,9 +139,23 @@ private:
     // À ajuster suivant ton câblage réel
     static const int SERVO_DIRECTION_PIN = 6;
 
+    // FT90R à rotation continue : la position est estimée par le temps de
+    // rotation cumulé (en ms, + = droite), centre = 0, butée = ±DUREE_MOUVEMENT
+    int8_t        _etatDirection  = 0;   // dernière position stable atteinte
+    int8_t        _cibleDirection = 0;   // consigne en cours
+    int8_t        _sensRotation   = 0;   // -1 vers la gauche, 0 arrêt, +1 vers la droite
+    int32_t       _positionDirection_ms = 0;
+    unsigned long _dernierPasDirection_ms = 0;
+
+    void setCibleDirection(int8_t cible);
+    void updateDirection(unsigned long now);
+    void ecritRotationDirection(int8_t sens);
+
     // -------- DRIVER 2x PWM --------
     static const int DRIVER_PWM_A  = 4;
     static const int DRIVER_PWM_B  = 5;
+
+    static void coupeBroche(uint8_t pin);
 };
 
 #endif
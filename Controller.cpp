@@ -6,6 +6,7 @@
 //
 
 #include "Controller.h"
+#include "Journal.h"
 
 // ---- Paramètres généraux ----
 static constexpr float kForwardSpeed = 0.8f;     // 80%
@@ -32,16 +33,12 @@ void Controller::begin()
 
 void Controller::update()
 {
-    if (_mode == ControlMode::AUTONOMOUS) {
-            // On fait tourner la machine
-            _stateMachine.update();
-            
-            // NOUVEAU : Si la mission est finie, on repasse en manuel
-            if (_stateMachine.isMissionFinished()) {
-                Serial.println("[Controller] Mission terminée -> Retour en MANUEL");
-                exitAutonomousMode();
-            }
-        }
+    // La machine d'état tourne dans tacheControle, juste avant : on ne fait
+    // ici que reprendre la main une fois la mission finie
+    if (_mode == ControlMode::AUTONOMOUS && _stateMachine.isMissionFinished()) {
+        LOG_INFO("Controller", "Mission terminée -> Retour en MANUEL");
+        exitAutonomousMode();
+    }
 }
 
 void Controller::onKey(char key)
@@ -91,22 +88,22 @@ void Controller::applyManualCommand(CommandType cmd)
     {
         case CommandType::FORWARD:
             goStraight(kForwardSpeed);
-            Serial.println("[Controller] MANUAL → FORWARD");
+            LOG_INFO("Controller", "MANUAL → FORWARD");
             break;
 
         case CommandType::TURN_LEFT:
             turnLeft(kTurnSpeed);
-            Serial.println("[Controller] MANUAL → LEFT");
+            LOG_INFO("Controller", "MANUAL → LEFT");
             break;
 
         case CommandType::TURN_RIGHT:
             turnRight(kTurnSpeed);
-            Serial.println("[Controller] MANUAL → RIGHT");
+            LOG_INFO("Controller", "MANUAL → RIGHT");
             break;
 
         case CommandType::STOP:
             stop();
-            Serial.println("[Controller] MANUAL → STOP");
+            LOG_INFO("Controller", "MANUAL → STOP");
             break;
 // A voir mais pour le moment c'est commenté 
         //case CommandType::DESCEND:
@@ -167,7 +164,7 @@ void Controller::stop()
 void Controller::enterAutonomousMode()
 {
     _mode = ControlMode::AUTONOMOUS;
-        Serial.println("[Controller] Mode AUTONOME ON");
+        LOG_INFO("Controller", "Mode AUTONOME ON");
 
         // Lancement officiel de la mission
         _stateMachine.startMission();
@@ -176,7 +173,7 @@ void Controller::enterAutonomousMode()
 void Controller::exitAutonomousMode()
 {
     _mode = ControlMode::MANUAL;
-        Serial.println("[Controller] Mode MANUEL ON");
+        LOG_INFO("Controller", "Mode MANUEL ON");
 
         // Arrêt immédiat de la mission autonome
         _stateMachine.stopMission();
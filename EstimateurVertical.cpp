@@ -0,0 +1,118 @@
+#include "EstimateurVertical.h"
+#include <math.h>
+#include <string.h>
+
+// Incertitude initiale : vitesse et biais inconnus
+static const float kP0Vitesse = 0.25f;   // (0.5 m/s)²
+static const float kP0Biais   = 0.04f;   // (0.2 m/s²)²
+
+// Trou de plus d'une seconde (capteurs muets) : pas de prédiction sur ce pas
+static const uint32_t kDtMax_ms = 1000;
+
+EstimateurVertical::EstimateurVertical()
+: _acc_mps2(0.0f)
+, _t_ms(0)
+, _initialise(false)
+{
+    memset(_x, 0, sizeof(_x));
+    memset(_P, 0, sizeof(_P));
+    setBruits(0.2f, 0.005f, 0.003f);
+}
+
+void EstimateurVertical::setBruits(float acc_mps2, float biais_mps2, float profondeur_m)
+{
+    _qAcc   = acc_mps2 * acc_mps2;
+    _qBiais = biais_mps2 * biais_mps2;
+    _r      = profondeur_m * profondeur_m;
+}
+
+void EstimateurVertical::reset(float profondeur_m, uint32_t t_ms)
+{
+    _x[0] = profondeur_m;
+    _x[1] = 0.0f;
+    _x[2] = 0.0f;
+
+    memset(_P, 0, sizeof(_P));
+    _P[0][0] = _r;
+    _P[1][1] = kP0Vitesse;
+    _P[2][2] = kP0Biais;
+
+    _t_ms       = t_ms;
+    _initialise = true;
+}
+
+void EstimateurVertical::prediction(uint32_t t_ms)
+{
+    if (!_initialise) return;
+
+    int32_t ecart = (int32_t)(t_ms - _t_ms);
+    if (ecart <= 0) return;
+    _t_ms = t_ms;
+    if ((uint32_t)ecart > kDtMax_ms) return;
+
+    float dt  = ecart / 1000.0f;
+    float dt2 = dt * dt;
+
+    // x = F x + G (a - b)
+    float a = _acc_mps2 - _x[2];
+    _x[0] += _x[1] * dt + 0.5f * a * dt2;
+    _x[1] += a * dt;
+
+    // P = F P F' + Q, F = [1 dt -dt²/2 ; 0 1 -dt ; 0 0 1]
+    const float F[3][3] = {
+        { 1.0f, dt,   -0.5f * dt2 },
+        { 0.0f, 1.0f, -dt         },
+        { 0.0f, 0.0f, 1.0f        }
+    };
+
+    float FP[3][3];
+    for (uint8_t i = 0; i < 3; i++)
+        for (uint8_t j = 0; j < 3; j++)
+            FP[i][j] = F[i][0] * _P[0][j] + F[i][1] * _P[1][j] + F[i][2] * _P[2][j];
+
+    for (uint8_t i = 0; i < 3; i++)
+        for (uint8_t j = 0; j < 3; j++)
+            _P[i][j] = FP[i][0] * F[j][0] + FP[i][1] * F[j][1] + FP[i][2] * F[j][2];
+
+    // Accélération blanche sur le pas, biais en marche aléatoire
+    _P[0][0] += 0.25f * dt2 * dt2 * _qAcc;
+    _P[0][1] += 0.5f  * dt2 * dt  * _qAcc;
+    _P[1][0] += 0.5f  * dt2 * dt  * _qAcc;
+    _P[1][1] += dt2 * _qAcc;
+    _P[2][2] += dt  * _qBiais;
+}
+
+void EstimateurVertical::correction(float profondeur_m, uint32_t t_ms)
+{
+    if (!_initialise) {
+        reset(profondeur_m, t_ms);
+        return;
+    }
+
+    prediction(t_ms);
+
+    // H = [1 0 0]
+    float s = _P[0][0] + _r;
+    float k[3] = { _P[0][0] / s, _P[1][0] / s, _P[2][0] / s };
+    float y = profondeur_m - _x[0];
+
+    for (uint8_t i = 0; i < 3; i++) _x[i] += k[i] * y;
+
+    // P = (I - K H) P
+    float ligne0[3] = { _P[0][0], _P[0][1], _P[0][2] };
+    for (uint8_t i = 0; i < 3; i++)
+        for (uint8_t j = 0; j < 3; j++)
+            _P[i][j] -= k[i] * ligne0[j];
+}
+
+// Extrapolation à vitesse constante : l'accélération instantanée est trop
+// bruitée pour être projetée sur plusieurs centaines de ms
+float EstimateurVertical::profondeurPredite_m(float horizon_s) const
+{
+    return _x[0] + _x[1] * horizon_s;
+}
+
+float EstimateurVertical::incertitude_m() const
+{
+    return sqrtf(_P[0][0] > 0.0f ? _P[0][0] : 0.0f);
+}
@@ -0,0 +1,64 @@
+#ifndef ESTIMATEUR_VERTICAL_H
+#define ESTIMATEUR_VERTICAL_H
+
+#include <stdint.h>
+
+// =====================
+//   Estimateur d'état vertical (Kalman 3 états, taille fixe)
+// =====================
+//
+// État : profondeur d (m), vitesse verticale v (m/s), biais b de
+// l'accéléromètre (m/s²), tous positifs vers le bas.
+//
+//   prédiction : accélération verticale hors gravité de l'IMU (LIA projetée
+//                sur GRV), à la cadence IMU, entrée de commande a - b
+//   correction : profondeur MS5837 (bruit de mesure R)
+//
+// La vitesse n'est plus une dérivée de mesures bruitées, et la profondeur
+// est disponible entre deux échantillons du MS5837 (20 Hz). Sans IMU,
+// prediction() avec a = 0 donne un filtre à vitesse constante.
+//
+// Les instants sont en ms (horloge des échantillons) : prediction()
+// avance l'état jusqu'à t_ms, un instant passé est ignoré.
+
+class EstimateurVertical
+{
+public:
+    EstimateurVertical();
+
+    // Bruits : accélération (m/s², sur le pas), marche aléatoire du
+    // biais (m/s²/√s), mesure de profondeur (m)
+    void setBruits(float acc_mps2, float biais_mps2, float profondeur_m);
+
+    void reset(float profondeur_m, uint32_t t_ms);
+    bool initialise() const { return _initialise; }
+
+    // Accélération verticale hors gravité (+ vers le bas), appliquée
+    // jusqu'à la prochaine mesure
+    void setAcceleration(float acc_mps2) { _acc_mps2 = acc_mps2; }
+
+    void prediction(uint32_t t_ms);
+    void correction(float profondeur_m, uint32_t t_ms);
+
+    float profondeur_m() const { return _x[0]; }
+    float vitesse_mps()  const { return _x[1]; }
+    float biais_mps2()   const { return _x[2]; }
+
+    // Profondeur extrapolée à horizon_s (retard servo + ballast)
+    float profondeurPredite_m(float horizon_s) const;
+
+    // Écart-type de la profondeur estimée (m)
+    float incertitude_m() const;
+
+private:
+    float    _x[3];
+    float    _P[3][3];
+    float    _qAcc;      // variance accélération
+    float    _qBiais;    // variance biais par seconde
+    float    _r;         // variance mesure
+    float    _acc_mps2;
+    uint32_t _t_ms;
+    bool     _initialise;
+};
+
+#endif
@@ -0,0 +1,14 @@
+#include "Horloge.h"
+
+#ifdef HORLOGE_VIRTUELLE
+
+// 64 bits : millis() et micros() rebouclent chacun à leur rythme, comme sur la carte
+static uint64_t s_horloge_us = 0;
+
+uint32_t horloge_us() { return (uint32_t)s_horloge_us; }
+uint32_t horloge_ms() { return (uint32_t)(s_horloge_us / 1000); }
+
+void horlogeAvance_us(uint32_t dt_us) { s_horloge_us += dt_us; }
+void horlogeRegle_us(uint64_t t_us)   { s_horloge_us = t_us; }
+
+#endif
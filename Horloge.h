@@ -0,0 +1,37 @@
+#ifndef HORLOGE_H
+#define HORLOGE_H
+
+#include <Arduino.h>
+
+// =====================
+//   Horloge de la pile de contrôle
+// =====================
+//
+// Source de temps unique pour l'ordonnanceur, les capteurs (horodatage,
+// cadences, âge des échantillons), Safety, StateMachine et CommandMotor.
+//
+// Sur la carte : millis() / micros(), sans surcoût (inline).
+//
+// Compilé avec -DHORLOGE_VIRTUELLE : le temps n'avance que par
+// horlogeAvance_us(). Le même code tourne alors hors cible, ou plus vite
+// que le temps réel (simulation), avec des échéances reproductibles.
+//
+// Les mesures de temps CPU (Metriques, latence de l'ISR fuite, bancs de
+// mesure) restent sur micros() : elles mesurent le processeur, pas la mission.
+
+#ifdef HORLOGE_VIRTUELLE
+
+uint32_t horloge_us();
+uint32_t horloge_ms();
+
+void horlogeAvance_us(uint32_t dt_us);
+void horlogeRegle_us(uint64_t t_us);
+
+#else
+
+inline uint32_t horloge_us() { return micros(); }
+inline uint32_t horloge_ms() { return millis(); }
+
+#endif
+
+#endif
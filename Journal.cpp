@@ -0,0 +1,98 @@
+#include "Journal.h"
+#include "Horloge.h"
+#include <stdarg.h>
+#include <stdio.h>
+
+Journal journal;
+
+static const char kLettreNiveau[] = { 'E', 'A', 'I', 'D' };
+
+Journal::Journal()
+: _tete(0)
+, _queue(0)
+, _messages(0)
+, _perdus(0)
+, _perdusSignales(0)
+{
+}
+
+uint16_t Journal::enAttente() const
+{
+    return (uint16_t)((_tete + TAILLE - _queue) % TAILLE);
+}
+
+// Message entier ou rien : une ligne coupée serait illisible
+bool Journal::ajoute(const char* s, uint16_t n)
+{
+    bool ok = false;
+
+    // Appelable depuis le contexte différé de l'ISR fuite : section critique
+    // courte (copie d'au plus TAILLE_MESSAGE octets)
+    noInterrupts();
+    uint16_t libre = TAILLE - 1 - enAttente();
+    if (n <= libre) {
+        uint16_t t = _tete;
+        uint16_t jusquFin = TAILLE - t;
+        if (n <= jusquFin) {
+            memcpy(_anneau + t, s, n);
+        } else {
+            memcpy(_anneau + t, s, jusquFin);
+            memcpy(_anneau, s + jusquFin, n - jusquFin);
+        }
+        _tete = (t + n) % TAILLE;
+        ok = true;
+    }
+    interrupts();
+
+    return ok;
+}
+
+void Journal::ecrit(uint8_t niveau, const char* module, const char* format, ...)
+{
+    char ligne[TAILLE_MESSAGE];
+
+    int n = snprintf(ligne, sizeof(ligne), "%lu %c [%s] ",
+                     (unsigned long)horloge_ms(),
+                     kLettreNiveau[niveau <= JOURNAL_DEBUG ? niveau : JOURNAL_DEBUG],
+                     module);
+    if (n < 0) return;
+    if (n > (int)sizeof(ligne) - 2) n = sizeof(ligne) - 2;
+
+    va_list args;
+    va_start(args, format);
+    int m = vsnprintf(ligne + n, sizeof(ligne) - 1 - n, format, args);
+    va_end(args);
+
+    // Tronqué : vsnprintf rend la longueur voulue, pas celle écrite
+    if (m > 0) n += (m < (int)sizeof(ligne) - 1 - n) ? m : (int)sizeof(ligne) - 2 - n;
+    ligne[n++] = '\n';
+
+    if (ajoute(ligne, n)) _messages++;
+    else                  _perdus++;
+}
+
+void Journal::vidange()
+{
+    // Pertes pas encore signalées : une ligne dès qu'il y a la place
+    if (_perdus != _perdusSignales) {
+        char ligne[48];
+        int n = snprintf(ligne, sizeof(ligne), "%lu A [Journal] %lu messages perdus\n",
+                         (unsigned long)horloge_ms(), (unsigned long)(_perdus - _perdusSignales));
+        if (n > 0 && n < (int)sizeof(ligne) && ajoute(ligne, n)) _perdusSignales = _perdus;
+    }
+
+    uint16_t attente = enAttente();
+    if (attente == 0) return;
+
+    int place = Serial.availableForWrite();
+    if (place <= 0) return;
+
+    // Segment contigu seulement : le reste partira au prochain appel
+    uint16_t q = _queue;
+    uint16_t n = TAILLE - q;
+    if (n > attente)        n = attente;
+    if (n > (uint16_t)place) n = (uint16_t)place;
+
+    Serial.write((const uint8_t*)_anneau + q, n);
+    _queue = (q + n) % TAILLE;
+}
@@ -0,0 +1,91 @@
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <Arduino.h>
+
+// =====================
+//   Journal asynchrone
+// =====================
+//
+// Les messages sont formatés dans un anneau en RAM puis vidés sur Serial
+// par vidange(), seulement autant que Serial.availableForWrite() le permet :
+// un PC qui ne lit pas (ou pas de PC) ne bloque plus la boucle. Anneau
+// plein : le message est perdu et compté, la perte est signalée dans le
+// journal dès qu'il y a de la place.
+//
+// Format printf sans flottants (%f absent de newlib-nano) : passer les
+// valeurs en entiers mis à l'échelle (mm, dixièmes de degré...).
+//
+// Les messages moins graves que JOURNAL_NIVEAU ne sont pas compilés du tout
+// (le "if (0)" garde juste la vérification du format), ex :
+//   -DJOURNAL_NIVEAU=JOURNAL_ALERTE   (build de mission)
+//   -DJOURNAL_NIVEAU=-1               (aucun message)
+//
+// Les sorties interactives (touches 't', 'p', 'u'...) restent sur Serial.
+
+#define JOURNAL_ERREUR  0
+#define JOURNAL_ALERTE  1
+#define JOURNAL_INFO    2
+#define JOURNAL_DEBUG   3
+
+#ifndef JOURNAL_NIVEAU
+#define JOURNAL_NIVEAU JOURNAL_INFO
+#endif
+
+class Journal
+{
+public:
+    static const uint16_t TAILLE         = 1024;  // anneau (octets)
+    static const uint8_t  TAILLE_MESSAGE = 96;    // ligne formatée max (tronquée au-delà)
+
+    Journal();
+
+    // "<ms> <E|A|I|D> [module] message\n" ajouté à l'anneau, ou perdu
+    void ecrit(uint8_t niveau, const char* module, const char* format, ...)
+        __attribute__((format(printf, 4, 5)));
+
+    // Ecrit sur Serial ce que le tampon USB accepte sans attendre
+    void vidange();
+
+    uint32_t messages() const { return _messages; }
+    uint32_t perdus()   const { return _perdus; }
+    uint16_t enAttente() const;
+
+private:
+    char              _anneau[TAILLE];
+    volatile uint16_t _tete;     // prochain octet écrit
+    volatile uint16_t _queue;    // prochain octet vidé
+    uint32_t          _messages;
+    uint32_t          _perdus;
+    uint32_t          _perdusSignales;
+
+    bool ajoute(const char* s, uint16_t n);
+};
+
+extern Journal journal;
+
+#if JOURNAL_NIVEAU >= JOURNAL_ERREUR
+#define LOG_ERREUR(module, ...) journal.ecrit(JOURNAL_ERREUR, module, __VA_ARGS__)
+#else
+#define LOG_ERREUR(module, ...) do { if (0) journal.ecrit(0, module, __VA_ARGS__); } while (0)
+#endif
+
+#if JOURNAL_NIVEAU >= JOURNAL_ALERTE
+#define LOG_ALERTE(module, ...) journal.ecrit(JOURNAL_ALERTE, module, __VA_ARGS__)
+#else
+#define LOG_ALERTE(module, ...) do { if (0) journal.ecrit(0, module, __VA_ARGS__); } while (0)
+#endif
+
+#if JOURNAL_NIVEAU >= JOURNAL_INFO
+#define LOG_INFO(module, ...)   journal.ecrit(JOURNAL_INFO, module, __VA_ARGS__)
+#else
+#define LOG_INFO(module, ...)   do { if (0) journal.ecrit(0, module, __VA_ARGS__); } while (0)
+#endif
+
+#if JOURNAL_NIVEAU >= JOURNAL_DEBUG
+#define LOG_DEBUG(module, ...)  journal.ecrit(JOURNAL_DEBUG, module, __VA_ARGS__)
+#else
+#define LOG_DEBUG(module, ...)  do { if (0) journal.ecrit(0, module, __VA_ARGS__); } while (0)
+#endif
+
+#endif
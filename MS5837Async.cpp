@@ -0,0 +1,220 @@
+#include "MS5837Async.h"
+
+// Commandes MS5837 (datasheet)
+static const uint8_t MS5837_RESET     = 0x1E;
+static const uint8_t MS5837_ADC_READ  = 0x00;
+static const uint8_t MS5837_PROM_READ = 0xA0;
+static const uint8_t MS5837_CONVERT_D1_8192 = 0x4A;
+static const uint8_t MS5837_CONVERT_D2_8192 = 0x5A;
+
+// Temps de conversion OSR 8192 : 17.2 ms max (datasheet) -> marge à 20 ms,
+// même valeur que le delay() de la librairie BlueRobotics
+static const uint32_t CONVERSION_US = 20000;
+
+MS5837Async::MS5837Async(TwoWire& wire, uint8_t address)
+: _wire(wire)
+, _address(address)
+, _model(MODEL_30BA)
+, _fluidDensity(1029.0f)
+, _rhoG(10091)
+, _D1(0)
+, _phase(PHASE_IDLE)
+, _phaseStart_us(0)
+, _cycleStart_us(0)
+, _pressure_mbar(0.0f)
+, _temperature_C(0.0f)
+, _samples(0)
+, _lastCycle_us(0)
+{
+    memset(_C, 0, sizeof(_C));
+}
+
+// =====================
+//   Initialisation
+// =====================
+
+bool MS5837Async::init()
+{
+    if (!sendCommand(MS5837_RESET)) return false;
+
+    // Le reset recharge la PROM : 10 ms max
+    delay(10);
+
+    for (uint8_t i = 0; i < 7; i++) {
+        if (!sendCommand(MS5837_PROM_READ + i * 2)) return false;
+        if (_wire.requestFrom(_address, (uint8_t)2) != 2) return false;
+        _C[i] = ((uint16_t)_wire.read() << 8) | _wire.read();
+    }
+
+    uint8_t crcRead = _C[0] >> 12;
+    uint8_t crcCalc = crc4(_C);
+
+    _phase = PHASE_IDLE;
+    return crcRead == crcCalc;
+}
+
+// =====================
+//   Machine d'état
+// =====================
+
+bool MS5837Async::startConversion(uint32_t now_us)
+{
+    if (_phase != PHASE_IDLE) return false;
+    if (!sendCommand(MS5837_CONVERT_D1_8192)) return false;
+
+    _phase         = PHASE_CONV_D1;
+    _phaseStart_us = now_us;
+    _cycleStart_us = now_us;
+    return true;
+}
+
+bool MS5837Async::poll(uint32_t now_us)
+{
+    if (_phase == PHASE_IDLE) return false;
+    if (now_us - _phaseStart_us < CONVERSION_US) return false;
+
+    if (_phase == PHASE_CONV_D1) {
+        // D1 prêt : on le lit et on enchaîne la conversion D2
+        if (!readADC(_D1) || !sendCommand(MS5837_CONVERT_D2_8192)) {
+            _phase = PHASE_IDLE;
+            return false;
+        }
+        _phase         = PHASE_CONV_D2;
+        _phaseStart_us = now_us;
+        return false;
+    }
+
+    // PHASE_CONV_D2
+    uint32_t D2 = 0;
+    _phase = PHASE_IDLE;
+    if (!readADC(D2)) return false;
+
+    calculate(_D1, D2);
+    _samples++;
+    _lastCycle_us = now_us - _cycleStart_us;
+    return true;
+}
+
+void MS5837Async::setFluidDensity(float density)
+{
+    _fluidDensity = density;
+    _rhoG = (int32_t)(density * 9.80665f + 0.5f);
+}
+
+float MS5837Async::depth_m() const
+{
+    // Pression en Pa, référence atmosphérique 101300 Pa (comme la librairie)
+    return (_pressure_mbar * 100.0f - 101300.0f) / (_fluidDensity * 9.80665f);
+}
+
+// =====================
+//   I2C
+// =====================
+
+bool MS5837Async::sendCommand(uint8_t cmd)
+{
+    _wire.beginTransmission(_address);
+    _wire.write(cmd);
+    return _wire.endTransmission() == 0;
+}
+
+bool MS5837Async::readADC(uint32_t& value)
+{
+    if (!sendCommand(MS5837_ADC_READ)) return false;
+    if (_wire.requestFrom(_address, (uint8_t)3) != 3) return false;
+
+    value  = (uint32_t)_wire.read() << 16;
+    value |= (uint32_t)_wire.read() << 8;
+    value |= (uint32_t)_wire.read();
+    return true;
+}
+
+// =====================
+//   Compensation (datasheet, 1er + 2nd ordre)
+// =====================
+
+void MS5837Async::calculate(uint32_t D1, uint32_t D2)
+{
+    int32_t dT = 0;
+    int64_t SENS = 0, OFF = 0;
+    int32_t SENSi = 0, OFFi = 0, Ti = 0;
+    int64_t OFF2 = 0, SENS2 = 0;
+    int32_t TEMP = 0, P = 0;
+
+    dT = D2 - (uint32_t)_C[5] * 256L;
+
+    if (_model == MODEL_02BA) {
+        SENS = (int64_t)_C[1] * 65536L + ((int64_t)_C[3] * dT) / 128L;
+        OFF  = (int64_t)_C[2] * 131072L + ((int64_t)_C[4] * dT) / 64L;
+    } else {
+        SENS = (int64_t)_C[1] * 32768L + ((int64_t)_C[3] * dT) / 256L;
+        OFF  = (int64_t)_C[2] * 65536L + ((int64_t)_C[4] * dT) / 128L;
+    }
+
+    TEMP = 2000L + (int64_t)dT * _C[6] / 8388608LL;
+
+    // Second ordre
+    if (_model == MODEL_02BA) {
+        if ((TEMP / 100) < 20) {
+            Ti    = (11 * (int64_t)dT * (int64_t)dT) / 34359738368LL;
+            OFFi  = (31 * (TEMP - 2000) * (TEMP - 2000)) / 8;
+            SENSi = (63 * (TEMP - 2000) * (TEMP - 2000)) / 32;
+        }
+    } else {
+        if ((TEMP / 100) < 20) {
+            Ti    = (3 * (int64_t)dT * (int64_t)dT) / 8589934592LL;
+            OFFi  = (3 * (TEMP - 2000) * (TEMP - 2000)) / 2;
+            SENSi = (5 * (TEMP - 2000) * (TEMP - 2000)) / 8;
+            if ((TEMP / 100) < -15) {
+                OFFi  = OFFi + 7 * (TEMP + 1500L) * (TEMP + 1500L);
+                SENSi = SENSi + 4 * (TEMP + 1500L) * (TEMP + 1500L);
+            }
+        } else {
+            Ti    = 2 * ((int64_t)dT * dT) / 137438953472LL;
+            OFFi  = ((TEMP - 2000) * (TEMP - 2000)) / 16;
+            SENSi = 0;
+        }
+    }
+
+    OFF2  = OFF - OFFi;
+    SENS2 = SENS - SENSi;
+    TEMP  = TEMP - Ti;
+
+    int32_t P_Pa;
+    if (_model == MODEL_02BA) {
+        P = (((D1 * SENS2) / 2097152L - OFF2) / 32768L);
+        _pressure_mbar = P / 100.0f;
+        P_Pa = P;
+    } else {
+        P = (((D1 * SENS2) / 2097152L - OFF2) / 8192L);
+        _pressure_mbar = P / 10.0f;
+        P_Pa = P * 10;
+    }
+
+    // Une division par échantillon, ici plutôt qu'à chaque lecture
+    _profondeur = fraction<Q16_16>(P_Pa - 101300L, _rhoG);
+
+    _temperature_C = TEMP / 100.0f;
+}
+
+uint8_t MS5837Async::crc4(uint16_t n_prom[8])
+{
+    uint16_t prom[8];
+    memcpy(prom, n_prom, sizeof(prom));
+
+    uint16_t n_rem = 0;
+    prom[0] = prom[0] & 0x0FFF;
+    prom[7] = 0;
+
+    for (uint8_t i = 0; i < 16; i++) {
+        if (i % 2 == 1) n_rem ^= (uint16_t)(prom[i >> 1] & 0x00FF);
+        else            n_rem ^= (uint16_t)(prom[i >> 1] >> 8);
+
+        for (uint8_t bit = 8; bit > 0; bit--) {
+            if (n_rem & 0x8000) n_rem = (n_rem << 1) ^ 0x3000;
+            else                n_rem = (n_rem << 1);
+        }
+    }
+
+    return (n_rem >> 12) & 0x000F;
+}
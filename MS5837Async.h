@@ -0,0 +1,85 @@
+#ifndef MS5837_ASYNC_H
+#define MS5837_ASYNC_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include "PointFixe.h"
+
+// =====================
+//   MS5837 en deux phases (non bloquant)
+// =====================
+//
+// La librairie BlueRobotics fait D1 puis D2 avec un delay(20) chacun
+// (~40 ms bloqués par lecture). Ici chaque conversion est lancée puis
+// relue à un tick ultérieur, une fois le temps de conversion écoulé :
+//
+//   IDLE -> (start D1) -> CONV_D1 -> (lit D1, start D2) -> CONV_D2 -> (lit D2, calcul) -> IDLE
+//
+// poll() ne fait jamais plus d'une transaction I2C et ne bloque jamais.
+
+class MS5837Async
+{
+public:
+    static const uint8_t MODEL_30BA = 0;
+    static const uint8_t MODEL_02BA = 1;
+
+    explicit MS5837Async(TwoWire& wire = Wire, uint8_t address = 0x76);
+
+    // Reset + lecture PROM + CRC (bloquant, à l'init uniquement)
+    bool init();
+
+    void setModel(uint8_t model)        { _model = model; }
+    void setFluidDensity(float density);
+
+    // Lance un nouveau cycle D1/D2 si aucun n'est en cours
+    bool startConversion(uint32_t now_us);
+
+    // Avance la machine d'état. Retourne true quand un échantillon
+    // complet (pression + température) vient d'être calculé.
+    bool poll(uint32_t now_us);
+
+    bool busy() const { return _phase != PHASE_IDLE; }
+
+    float pressure_mbar() const { return _pressure_mbar; }
+    float temperature_C() const { return _temperature_C; }
+    float depth_m() const;
+    // Même profondeur calculée depuis la pression entière, sans flottant
+    // (chemin par tick, cf. PointFixe.h)
+    Q16_16 profondeur() const { return _profondeur; }
+
+    // Nombre d'échantillons complets depuis le boot
+    uint32_t sampleCount() const { return _samples; }
+
+    // Durée du dernier cycle complet (start D1 -> calcul)
+    uint32_t lastCycle_us() const { return _lastCycle_us; }
+
+private:
+    enum Phase : uint8_t { PHASE_IDLE, PHASE_CONV_D1, PHASE_CONV_D2 };
+
+    TwoWire& _wire;
+    uint8_t  _address;
+    uint8_t  _model;
+    float    _fluidDensity;
+    int32_t  _rhoG;            // densité x g, en Pa/m
+
+    uint16_t _C[8];
+    uint32_t _D1;
+
+    Phase    _phase;
+    uint32_t _phaseStart_us;
+    uint32_t _cycleStart_us;
+
+    float    _pressure_mbar;
+    float    _temperature_C;
+    Q16_16   _profondeur;
+    uint32_t _samples;
+    uint32_t _lastCycle_us;
+
+    bool     sendCommand(uint8_t cmd);
+    bool     readADC(uint32_t& value);
+    void     calculate(uint32_t D1, uint32_t D2);
+
+    static uint8_t crc4(uint16_t n_prom[8]);
+};
+
+#endif
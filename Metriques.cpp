@@ -0,0 +1,123 @@
+#include "Metriques.h"
+#include "Scheduler.h"
+#include "ReponseHttp.h"
+
+Metriques metriques;
+
+Metriques::Metriques()
+: _scheduler(nullptr)
+{
+}
+
+const char* Metriques::nom(Etape e)
+{
+    switch (e) {
+        case Etape::CAPT_FUITE:      return "capt_fuite";
+        case Etape::CAPT_ALERTES:    return "capt_alertes";
+        case Etape::CAPT_IMU:        return "capt_imu";
+        case Etape::CAPT_BATT:       return "capt_batt";
+        case Etape::CAPT_MESURE:     return "capt_mesure";
+        case Etape::CAPT_PROFONDEUR: return "capt_profondeur";
+        case Etape::CAPT_PUBLIE:     return "capt_publie";
+        case Etape::SAFETY:          return "safety";
+        case Etape::CONTROLEUR:      return "controleur";
+        case Etape::MACHINE_ETAT:    return "machine_etat";
+        case Etape::TELEMETRIE:      return "telemetrie";
+        default:                     return "?";
+    }
+}
+
+void Metriques::reset()
+{
+    for (uint8_t i = 0; i < (uint8_t)Etape::COUNT; i++) _etapes[i].reset();
+    if (_scheduler) _scheduler->resetStats();
+}
+
+// =====================
+//   Dump série
+// =====================
+
+void Metriques::print(Print& out) const
+{
+    out.println("=== Metriques (us) ===");
+
+    if (_scheduler) {
+        out.print("boucle ");
+        _scheduler->statBoucle().print(out);
+
+        for (uint8_t i = 0; i < _scheduler->taskCount(); i++) {
+            const Task& t = _scheduler->task(i);
+            out.print(t.nom);
+            out.print(" duree ");
+            t.duree.print(out);
+            if (t.periode_us) {
+                out.print(t.nom);
+                out.print(" retard ");
+                t.retard.print(out);
+            }
+        }
+    }
+
+    for (uint8_t i = 0; i < (uint8_t)Etape::COUNT; i++) {
+        out.print(nom((Etape)i));
+        out.print(' ');
+        _etapes[i].print(out);
+    }
+}
+
+// =====================
+//   JSON (/metrics)
+// =====================
+
+static void ecritStat(ReponseHttp& rep, const StatTemps& s)
+{
+    rep.ajoute("{\"n\":");    rep.ajouteNaturel(s.n());
+    rep.ajoute(",\"min\":");  rep.ajouteNaturel(s.min_us());
+    rep.ajoute(",\"moy\":");  rep.ajouteNaturel(s.moyenne_us());
+    rep.ajoute(",\"max\":");  rep.ajouteNaturel(s.max_us());
+    rep.ajoute(",\"h\":[");
+    for (uint8_t i = 0; i < StatTemps::NB_CLASSES; i++) {
+        if (i) rep.ajoute(',');
+        rep.ajouteNaturel(s.classe(i));
+    }
+    rep.ajoute("]}");
+}
+
+void Metriques::ecritJson(ReponseHttp& rep) const
+{
+    rep.ajoute("{\"bornes\":[");
+    for (uint8_t i = 0; i < StatTemps::NB_CLASSES - 1; i++) {
+        if (i) rep.ajoute(',');
+        rep.ajouteNaturel(StatTemps::BORNES_US[i]);
+    }
+    rep.ajoute(']');
+
+    if (_scheduler) {
+        rep.ajoute(",\"boucle\":");
+        ecritStat(rep, _scheduler->statBoucle());
+
+        rep.ajoute(",\"taches\":{");
+        for (uint8_t i = 0; i < _scheduler->taskCount(); i++) {
+            const Task& t = _scheduler->task(i);
+            if (i) rep.ajoute(',');
+            rep.ajoute('"'); rep.ajoute(t.nom); rep.ajoute("\":{\"T\":");
+            rep.ajouteNaturel(t.periode_us);
+            rep.ajoute(",\"overrun\":"); rep.ajouteNaturel(t.overruns);
+            rep.ajoute(",\"duree\":");   ecritStat(rep, t.duree);
+            if (t.periode_us) {
+                rep.ajoute(",\"retard\":");
+                ecritStat(rep, t.retard);
+            }
+            rep.ajoute('}');
+        }
+        rep.ajoute('}');
+    }
+
+    rep.ajoute(",\"etapes\":{");
+    for (uint8_t i = 0; i < (uint8_t)Etape::COUNT; i++) {
+        if (i) rep.ajoute(',');
+        rep.ajoute('"'); rep.ajoute(nom((Etape)i)); rep.ajoute("\":");
+        ecritStat(rep, _etapes[i]);
+    }
+    rep.ajoute("}}");
+}
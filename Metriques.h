@@ -0,0 +1,76 @@
+#ifndef METRIQUES_H
+#define METRIQUES_H
+
+#include <Arduino.h>
+#include "StatTemps.h"
+
+class Scheduler;
+class ReponseHttp;
+
+// =====================
+//   Métriques de temps d'exécution
+// =====================
+//
+// Une StatTemps (min / moyenne / max + histogramme) par étape instrumentée,
+// en mémoire statique. Les tâches de l'ordonnanceur ont déjà leurs propres
+// stats (durée, retard au démarrage), la boucle aussi (intervalle entre
+// deux passages) : Metriques les regroupe pour le dump série et /metrics.
+//
+// Mesure par micros() : le Cortex-M0+ du SAMD21 n'a pas de compteur de
+// cycles (DWT) ; résolution 1 µs, coût ~2 µs par ChronoPortee.
+
+enum class Etape : uint8_t
+{
+    CAPT_FUITE,
+    CAPT_ALERTES,
+    CAPT_IMU,
+    CAPT_BATT,
+    CAPT_MESURE,
+    CAPT_PROFONDEUR,
+    CAPT_PUBLIE,
+    SAFETY,
+    CONTROLEUR,
+    MACHINE_ETAT,
+    TELEMETRIE,
+    COUNT
+};
+
+class Metriques
+{
+public:
+    Metriques();
+
+    // Stats des tâches et de la boucle incluses dans print / JSON / reset
+    void attache(Scheduler* scheduler) { _scheduler = scheduler; }
+
+    StatTemps&       etape(Etape e)       { return _etapes[(uint8_t)e]; }
+    const StatTemps& etape(Etape e) const { return _etapes[(uint8_t)e]; }
+    static const char* nom(Etape e);
+
+    void print(Print& out) const;
+    void reset();
+
+    // {"bornes":[..],"boucle":{..},"taches":{..},"etapes":{..}}
+    void ecritJson(ReponseHttp& rep) const;
+
+private:
+    StatTemps  _etapes[(uint8_t)Etape::COUNT];
+    Scheduler* _scheduler;
+};
+
+extern Metriques metriques;
+
+// Chronomètre de portée : la durée du bloc est ajoutée à l'étape à la sortie
+//   { ChronoPortee c(Etape::CAPT_IMU); updateIMU(); }
+class ChronoPortee
+{
+public:
+    explicit ChronoPortee(Etape e) : _stat(metriques.etape(e)), _debut(micros()) {}
+    ~ChronoPortee() { _stat.ajoute(micros() - _debut); }
+
+private:
+    StatTemps& _stat;
+    uint32_t   _debut;
+};
+
+#endif
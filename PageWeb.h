@@ -0,0 +1,430 @@
+#ifndef PAGE_WEB_H
+#define PAGE_WEB_H
+
+// Fichier généré par outils/genere_page_web.py depuis web/index.html,
+// ne pas modifier à la main.
+// 5388 octets -> 4736 minifiés -> 1795 octets gzip, zlib -9 (-67%)
+
+#include <Arduino.h>
+
+#define PAGE_WEB_ETAG "\"c817e7be50204ca9\""
+#define PAGE_WEB_ETAG_HTML "\"bcb974902c4fda41\""
+
+static const uint32_t PAGE_WEB_TAILLE_SOURCE = 5388;
+
+static const uint8_t PAGE_WEB_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x58, 0xeb, 0x73, 0xda, 0x46,
+    0x10, 0xff, 0xde, 0xbf, 0x42, 0x4e, 0x66, 0x2a, 0x69, 0x2c, 0x84, 0xc4, 0xc3, 0xc5, 0x12, 0x22,
+    0x43, 0x80, 0x74, 0x3c, 0xb5, 0x83, 0xe3, 0x47, 0x5b, 0xbb, 0xd3, 0x0f, 0x87, 0x74, 0x12, 0x57,
+    0xf4, 0x9a, 0xd3, 0x09, 0x43, 0x18, 0xfe, 0xf7, 0xee, 0x9d, 0x78, 0x48, 0x06, 0x9c, 0xa4, 0x33,
+    0x75, 0xc6, 0x04, 0xed, 0xe3, 0xb7, 0x7b, 0x7b, 0x7b, 0xbf, 0x5b, 0xb9, 0x7b, 0x36, 0x1c, 0x0f,
+    0x1e, 0x9e, 0x6e, 0x47, 0xd2, 0x94, 0x45, 0x61, 0xaf, 0xbb, 0xf9, 0xc4, 0xc8, 0xeb, 0x75, 0x23,
+    0xcc, 0x90, 0xe4, 0x4e, 0x11, 0xcd, 0x30, 0x73, 0xe4, 0xc7, 0x87, 0x4f, 0xb5, 0x8e, 0xbc, 0x91,
+    0xc6, 0x28, 0xc2, 0x8e, 0x3c, 0x27, 0xf8, 0x25, 0x4d, 0x28, 0x93, 0x25, 0x37, 0x89, 0x19, 0x8e,
+    0xc1, 0xea, 0x85, 0x78, 0x6c, 0xea, 0x78, 0x78, 0x4e, 0x5c, 0x5c, 0x13, 0x0f, 0x9a, 0x44, 0x62,
+    0xc2, 0x08, 0x0a, 0x6b, 0x99, 0x8b, 0x42, 0xec, 0x98, 0x80, 0xc1, 0x08, 0x0b, 0x71, 0xef, 0x2e,
+    0x99, 0x24, 0x4c, 0xba, 0x4d, 0x48, 0x96, 0x25, 0xb1, 0x74, 0xf3, 0xdb, 0x5d, 0xb7, 0x5e, 0x28,
+    0xba, 0x19, 0x5b, 0xc2, 0x7f, 0x93, 0xc4, 0x5b, 0xae, 0x26, 0xc8, 0x9d, 0x05, 0x34, 0xc9, 0x63,
+    0xcf, 0x7a, 0x6f, 0xf8, 0xe6, 0x2f, 0x0d, 0x64, 0xbb, 0x49, 0x98, 0x50, 0xeb, 0x3d, 0x6e, 0xe0,
+    0x8e, 0x6f, 0xd8, 0x3e, 0x84, 0xae, 0xf9, 0x28, 0x22, 0xe1, 0xd2, 0xca, 0x50, 0x9c, 0xd5, 0x32,
+    0x4c, 0x89, 0x6f, 0x33, 0xbc, 0x60, 0x35, 0x14, 0x92, 0x20, 0xb6, 0x5c, 0xc8, 0x0c, 0x53, 0x3b,
+    0x42, 0x34, 0x20, 0xb1, 0x65, 0xd8, 0x29, 0xf2, 0x3c, 0x12, 0x07, 0x56, 0xc3, 0x48, 0x17, 0x6b,
+    0x9d, 0xa7, 0x8e, 0x48, 0x8c, 0xe9, 0x2a, 0x42, 0x8b, 0x22, 0x65, 0xab, 0x63, 0x80, 0x6a, 0xeb,
+    0x80, 0x72, 0x96, 0xac, 0xa7, 0xe6, 0x6a, 0x13, 0xb6, 0xd9, 0x99, 0x78, 0x7e, 0x67, 0xad, 0x7b,
+    0x28, 0x9b, 0x4e, 0x12, 0x44, 0xbd, 0x95, 0x47, 0xb2, 0x34, 0x44, 0x4b, 0x2b, 0xa0, 0xc4, 0xb3,
+    0xf9, 0x47, 0x8d, 0xe1, 0x08, 0x24, 0x0c, 0xd7, 0xc0, 0x27, 0x8f, 0xe2, 0xcc, 0xa2, 0x38, 0xc5,
+    0x88, 0x29, 0x1c, 0xaa, 0xe6, 0x13, 0xa6, 0x45, 0x24, 0x86, 0x68, 0x8a, 0xd9, 0x86, 0x38, 0x9a,
+    0xe9, 0x53, 0x55, 0xb5, 0x03, 0x94, 0x5a, 0x66, 0x7b, 0x17, 0xb6, 0x06, 0xb5, 0x61, 0x49, 0xb4,
+    0x4d, 0x92, 0xc7, 0x29, 0x97, 0xc2, 0xc4, 0x8d, 0xcb, 0xe6, 0x64, 0xb7, 0x14, 0xe1, 0x38, 0x49,
+    0xa8, 0x87, 0x69, 0x8d, 0x22, 0x8f, 0xe4, 0x99, 0x65, 0x1a, 0x42, 0xb4, 0xa8, 0x65, 0x53, 0xe4,
+    0x25, 0x2f, 0x96, 0x21, 0xb5, 0xd2, 0x85, 0x74, 0x01, 0xbf, 0x34, 0x98, 0x20, 0xc5, 0xd0, 0xc4,
+    0x3f, 0xbd, 0xa9, 0xae, 0xf5, 0x39, 0x0a, 0x57, 0xa2, 0x8c, 0x19, 0xf9, 0x8a, 0x2d, 0x53, 0x6f,
+    0xe0, 0xa8, 0x28, 0xeb, 0x0b, 0x26, 0xc1, 0x94, 0x59, 0x93, 0x24, 0xf4, 0xb6, 0x55, 0x6f, 0xb6,
+    0xbc, 0xe6, 0xe5, 0xe5, 0x5a, 0x0f, 0xd1, 0x04, 0x97, 0xbd, 0x0c, 0xbd, 0x03, 0x5e, 0x1b, 0xa3,
+    0xcb, 0x16, 0x6a, 0x4e, 0x3a, 0x45, 0x6d, 0x69, 0x12, 0x66, 0x6f, 0xa5, 0xde, 0x30, 0x0e, 0x53,
+    0x2f, 0x95, 0x81, 0x25, 0xa9, 0x58, 0xca, 0x5a, 0x9f, 0xe1, 0x65, 0x8d, 0x26, 0x2f, 0xbb, 0x72,
+    0xfb, 0x21, 0x5e, 0xd8, 0xff, 0xe4, 0x19, 0x23, 0xfe, 0xb2, 0xb6, 0x69, 0xc0, 0xed, 0x5e, 0x8b,
+    0x62, 0x96, 0xf6, 0x90, 0x7f, 0x97, 0x0c, 0x81, 0x51, 0xc9, 0xa5, 0xd9, 0x6c, 0x99, 0xed, 0x76,
+    0xa5, 0x8c, 0x52, 0xe3, 0xb0, 0x96, 0x1d, 0x90, 0x1c, 0x14, 0xa4, 0x30, 0xb1, 0x1a, 0xe0, 0x92,
+    0x25, 0x21, 0xf1, 0xa4, 0xf7, 0xad, 0x5f, 0xda, 0xed, 0x8b, 0x4b, 0xdb, 0xcd, 0x69, 0x06, 0x55,
+    0x48, 0x13, 0x22, 0x72, 0xc9, 0xa1, 0x21, 0xa1, 0x29, 0x43, 0xec, 0x32, 0x2b, 0x4e, 0x62, 0xfc,
+    0xaa, 0x7f, 0x19, 0x85, 0xa6, 0x85, 0x03, 0x92, 0xc4, 0xd6, 0x3e, 0x33, 0xc9, 0xd0, 0xcd, 0x4c,
+    0x13, 0x2a, 0x3f, 0xa1, 0x11, 0x3c, 0x1a, 0xed, 0x4c, 0xa4, 0x6f, 0x21, 0x97, 0x91, 0x39, 0xae,
+    0xac, 0xa2, 0xd1, 0x70, 0xdb, 0xed, 0x1d, 0xae, 0x61, 0x18, 0xdb, 0xf4, 0x37, 0x12, 0x5f, 0xfc,
+    0xd8, 0x3b, 0x38, 0x4b, 0x7c, 0xe3, 0x0d, 0xfa, 0xa4, 0x40, 0xfa, 0xaa, 0x00, 0xd6, 0xff, 0x0f,
+    0xe0, 0x6e, 0xbd, 0x38, 0xca, 0xdd, 0x7a, 0x41, 0x29, 0xfc, 0x48, 0xf7, 0xba, 0x1e, 0x99, 0x4b,
+    0x6e, 0x88, 0xb2, 0xcc, 0x91, 0x77, 0xa7, 0x0f, 0x58, 0x61, 0x6a, 0xf6, 0x06, 0xe3, 0x9b, 0x9b,
+    0xfe, 0xe7, 0xe1, 0xe8, 0x4e, 0x1a, 0x8c, 0x3e, 0x3f, 0x8c, 0x80, 0x11, 0x40, 0x58, 0xb6, 0xdf,
+    0x9d, 0x3a, 0xb9, 0x0a, 0x73, 0x20, 0x11, 0xfd, 0x29, 0xf7, 0x6e, 0xc6, 0xc3, 0x51, 0xb7, 0x0e,
+    0xf2, 0x8a, 0x12, 0x1a, 0x5e, 0x96, 0x88, 0xe7, 0xc8, 0x51, 0xe2, 0x61, 0x30, 0xea, 0x7f, 0x7e,
+    0x1c, 0x5d, 0x6f, 0xcc, 0x0e, 0x8c, 0x4f, 0x62, 0x7f, 0xec, 0x3f, 0x40, 0x8a, 0x57, 0x27, 0xf0,
+    0x81, 0xc5, 0x52, 0x14, 0x8b, 0x28, 0xf3, 0x09, 0x62, 0x72, 0xaf, 0x56, 0x83, 0x6a, 0x80, 0xa8,
+    0x27, 0xfd, 0xfe, 0xc3, 0xa1, 0x6e, 0xef, 0xc6, 0x9f, 0xc6, 0x50, 0x97, 0xc7, 0xbb, 0x6f, 0x06,
+    0x4b, 0x69, 0xe2, 0x97, 0x83, 0x45, 0x3f, 0x1c, 0x6c, 0xd0, 0xbf, 0x95, 0x94, 0xa7, 0xfe, 0x1f,
+    0xea, 0x37, 0x63, 0x2d, 0xd1, 0x4b, 0x39, 0x94, 0x87, 0x83, 0x4a, 0xb0, 0x03, 0xf7, 0xfd, 0xee,
+    0x49, 0xa2, 0x2f, 0x1c, 0xf9, 0x15, 0x81, 0x7c, 0xe7, 0xae, 0xf6, 0x07, 0x83, 0xd1, 0xb5, 0xa4,
+    0xfc, 0x59, 0x7f, 0xaa, 0x3f, 0x97, 0xb3, 0xe4, 0x39, 0x21, 0xd7, 0x2d, 0x72, 0xfa, 0xc1, 0x55,
+    0xff, 0xfa, 0x74, 0x37, 0x3e, 0x01, 0x19, 0x2c, 0xe9, 0x7f, 0x82, 0x84, 0xfe, 0xb8, 0x7a, 0x78,
+    0x1c, 0x8e, 0x24, 0xe5, 0xb6, 0x7e, 0x77, 0x90, 0x27, 0x63, 0x07, 0xa0, 0x87, 0xd0, 0x1b, 0x02,
+    0xe5, 0xa7, 0xa3, 0xd9, 0xbb, 0xbd, 0xba, 0x1e, 0x3f, 0xf4, 0x7f, 0x05, 0xbc, 0x41, 0x88, 0xe0,
+    0xf2, 0xa5, 0xd2, 0xf3, 0x97, 0xfb, 0xa1, 0x74, 0x2e, 0xf5, 0x01, 0x1c, 0xf4, 0x65, 0xcf, 0x0d,
+    0x5b, 0xca, 0xaf, 0x85, 0x45, 0xdf, 0xcf, 0x9e, 0x65, 0x29, 0x89, 0xdd, 0x90, 0xb8, 0x33, 0xe7,
+    0x5d, 0x86, 0x63, 0x6f, 0x10, 0x79, 0x8a, 0xfc, 0x2c, 0xab, 0xef, 0x7a, 0xcf, 0xa7, 0x72, 0xf9,
+    0x06, 0xe2, 0x97, 0x63, 0x88, 0x5f, 0x38, 0xe2, 0x97, 0xa3, 0x58, 0x1b, 0xb7, 0xfb, 0x63, 0x6e,
+    0xf7, 0xdc, 0xed, 0xfe, 0x2d, 0xb7, 0xe1, 0x31, 0xb7, 0x21, 0x77, 0x1b, 0xfe, 0xc7, 0xfc, 0xfb,
+    0xc7, 0x10, 0xfb, 0x1c, 0xb1, 0x2f, 0x29, 0xfd, 0xc7, 0x87, 0xb1, 0x7a, 0x64, 0xab, 0x8a, 0xcf,
+    0xcc, 0xa5, 0x24, 0x65, 0x3d, 0x3f, 0x8f, 0x5d, 0xce, 0xe3, 0xd2, 0xd6, 0x7d, 0xa6, 0xae, 0x7c,
+    0xcc, 0xdc, 0xa9, 0x22, 0xd7, 0xdd, 0xc8, 0xfb, 0x00, 0xb1, 0x1c, 0xf9, 0x7c, 0xa6, 0xda, 0xeb,
+    0x9f, 0x4a, 0xa6, 0xec, 0x37, 0xbc, 0xec, 0x0b, 0xea, 0x55, 0x66, 0x1a, 0x52, 0x57, 0x33, 0x67,
+    0xa6, 0xb3, 0xe4, 0x31, 0x4d, 0x31, 0x1d, 0xa0, 0x0c, 0x2b, 0xaa, 0x3d, 0x47, 0x54, 0xc2, 0xa1,
+    0xe3, 0x25, 0x6e, 0x1e, 0xc1, 0xf5, 0xa6, 0x07, 0x98, 0x8d, 0x42, 0xcc, 0xbf, 0x7e, 0x5c, 0x5e,
+    0x41, 0x92, 0x33, 0x01, 0x4a, 0x7c, 0xe5, 0x0c, 0x87, 0x2a, 0xc5, 0x2c, 0xa7, 0x31, 0x7f, 0x42,
+    0x2a, 0x0e, 0x75, 0xb1, 0xcc, 0x6b, 0x92, 0x31, 0x1d, 0xae, 0x38, 0x45, 0x2e, 0x38, 0x5e, 0x56,
+    0x6d, 0x1c, 0x66, 0x58, 0xaa, 0xe8, 0x29, 0x8e, 0x12, 0xc8, 0x61, 0x6f, 0xb2, 0xfe, 0xe9, 0x85,
+    0xc4, 0x30, 0x39, 0x70, 0xcf, 0xd1, 0x1c, 0xa2, 0x71, 0x33, 0x0c, 0x54, 0xad, 0xf0, 0xaa, 0x81,
+    0x22, 0x96, 0xb5, 0xed, 0x3a, 0x14, 0xac, 0xae, 0x78, 0x9a, 0x33, 0x07, 0xf3, 0xbb, 0x44, 0x24,
+    0x33, 0xdb, 0xe6, 0x72, 0xb8, 0x22, 0x50, 0xff, 0x05, 0xdd, 0xa6, 0x41, 0x7f, 0x68, 0xb0, 0xd9,
+    0x1a, 0xec, 0x9c, 0x06, 0xb5, 0xfe, 0x5b, 0x27, 0xb0, 0x03, 0xb9, 0x87, 0x33, 0x28, 0x9d, 0xba,
+    0x02, 0x2b, 0xac, 0x17, 0x93, 0xd3, 0x16, 0x0a, 0xeb, 0x29, 0xc5, 0x3c, 0x97, 0x21, 0xf6, 0x51,
+    0x1e, 0x32, 0xc0, 0x7a, 0x55, 0x41, 0x46, 0x73, 0xcc, 0x85, 0xdb, 0x1d, 0xb0, 0xd7, 0x6b, 0xd5,
+    0x7e, 0x6b, 0x21, 0x79, 0xfa, 0x3f, 0x2f, 0xe3, 0xdb, 0x39, 0xfb, 0x08, 0x76, 0xe3, 0x28, 0xdc,
+    0x2b, 0xa8, 0xf2, 0x01, 0x81, 0x85, 0xc1, 0xca, 0x76, 0x8d, 0xe4, 0x61, 0x17, 0xee, 0xb2, 0x07,
+    0x0a, 0x83, 0xb9, 0x32, 0x29, 0x56, 0x31, 0x77, 0x62, 0xfc, 0x22, 0x0d, 0x11, 0x43, 0xbf, 0xc3,
+    0xa0, 0x0e, 0x52, 0x1e, 0x61, 0xce, 0xdb, 0xe7, 0x11, 0x26, 0x93, 0x8e, 0x62, 0xa8, 0x67, 0x8e,
+    0x63, 0x6e, 0x96, 0x27, 0xc5, 0x79, 0x18, 0x8a, 0x56, 0xf3, 0x9d, 0x92, 0x8d, 0xa9, 0xda, 0x85,
+    0x7e, 0x95, 0x5a, 0x42, 0x7c, 0x15, 0x33, 0xf3, 0x42, 0x69, 0x14, 0x75, 0xae, 0x9b, 0x30, 0x13,
+    0x68, 0x3e, 0x0f, 0x6a, 0xed, 0x9c, 0x9a, 0x0d, 0xa5, 0x55, 0xa8, 0x35, 0xb8, 0x1f, 0xca, 0x5e,
+    0xe6, 0xde, 0x4d, 0x4b, 0x09, 0xab, 0xa8, 0x5a, 0x7b, 0x15, 0x10, 0x5e, 0x45, 0x75, 0xb1, 0x57,
+    0xa1, 0x45, 0x45, 0xd3, 0xd9, 0xa7, 0xa1, 0xc1, 0x44, 0x58, 0x4e, 0xd0, 0x28, 0xab, 0xbe, 0x56,
+    0x54, 0xa5, 0xe4, 0xb5, 0xa0, 0x02, 0xd8, 0x68, 0x95, 0xd7, 0x15, 0x54, 0x11, 0x2f, 0x2a, 0xba,
+    0x2a, 0x64, 0xa7, 0xac, 0x9b, 0xef, 0x6b, 0x01, 0xba, 0xa6, 0x51, 0xd6, 0x91, 0xb2, 0x5b, 0x73,
+    0x93, 0x89, 0x96, 0xf6, 0x03, 0x5c, 0x75, 0xda, 0x56, 0x30, 0xc4, 0x68, 0x66, 0x9d, 0x9d, 0x29,
+    0xfe, 0xcf, 0x66, 0xf1, 0x70, 0x8d, 0x80, 0x50, 0xb0, 0x57, 0xc8, 0x1a, 0xaa, 0xc6, 0x5f, 0x29,
+    0x8a, 0x87, 0x96, 0xba, 0x2e, 0x33, 0x0b, 0xf2, 0x7d, 0x02, 0x96, 0x8a, 0x27, 0x0e, 0xd2, 0x99,
+    0xb7, 0x6d, 0xe3, 0x82, 0x4d, 0xec, 0xb7, 0x08, 0x45, 0xcc, 0x2b, 0xa2, 0x5b, 0x80, 0x50, 0x80,
+    0x24, 0x48, 0x0c, 0x87, 0xe5, 0x01, 0x5e, 0xa8, 0x1c, 0x4f, 0x9f, 0xc3, 0x19, 0xf8, 0x44, 0x16,
+    0xd8, 0x53, 0x1a, 0xea, 0x9b, 0x20, 0x62, 0x0e, 0x39, 0x01, 0x92, 0x7e, 0x2f, 0x08, 0x1f, 0x30,
+    0x4e, 0x60, 0x80, 0x6a, 0x87, 0x62, 0xbc, 0x8d, 0xc2, 0x47, 0x82, 0x13, 0x28, 0x68, 0xb1, 0x03,
+    0x31, 0xd5, 0x73, 0xb9, 0x2e, 0x9f, 0x83, 0x6c, 0x79, 0x44, 0xf6, 0xb5, 0x24, 0x7b, 0x33, 0x18,
+    0x1f, 0x16, 0x4e, 0x04, 0x0b, 0x8e, 0x04, 0x0b, 0x8e, 0x04, 0x0b, 0xbe, 0x3b, 0x18, 0x1f, 0x22,
+    0x4e, 0xd5, 0x98, 0xb0, 0x52, 0x7d, 0x36, 0xc8, 0x70, 0xb4, 0xbe, 0xb7, 0x68, 0x62, 0x34, 0x3e,
+    0x55, 0x35, 0x68, 0xba, 0x0f, 0x32, 0xbf, 0x14, 0x3f, 0x8f, 0x6f, 0x46, 0xb2, 0x25, 0x17, 0x13,
+    0xb4, 0x0c, 0xfd, 0xc7, 0xdb, 0x0b, 0xee, 0xc3, 0x9c, 0x61, 0x47, 0x30, 0x4a, 0x89, 0xa0, 0xe0,
+    0x5d, 0x8c, 0xe2, 0x7b, 0xae, 0x43, 0x82, 0x6c, 0x45, 0x63, 0x16, 0xb6, 0xdb, 0xe6, 0xdc, 0x78,
+    0x66, 0xe2, 0x84, 0x60, 0x0a, 0xe3, 0xa6, 0xb2, 0xe3, 0xe6, 0xfd, 0x65, 0xea, 0x01, 0xa5, 0xe9,
+    0x13, 0x12, 0xcb, 0xaa, 0xce, 0xa6, 0x38, 0xde, 0x9b, 0x50, 0x75, 0xb5, 0x61, 0x33, 0xaa, 0x43,
+    0x30, 0xb4, 0xfc, 0x98, 0xfb, 0x3e, 0xf0, 0x3c, 0x90, 0xe5, 0x6b, 0x53, 0xe0, 0xc8, 0xdd, 0x09,
+    0xa9, 0x50, 0x27, 0xb7, 0xb5, 0xd7, 0x5a, 0xc3, 0x30, 0x2a, 0x17, 0xf5, 0xe4, 0xa2, 0xa5, 0x64,
+    0x05, 0xaf, 0x32, 0x07, 0xb1, 0x64, 0x02, 0x4f, 0x5a, 0x2e, 0x18, 0x56, 0x30, 0x65, 0x9f, 0x87,
+    0x53, 0x98, 0x1e, 0xe2, 0x38, 0x60, 0x53, 0x20, 0xe6, 0x84, 0x2a, 0xdc, 0x98, 0x38, 0x86, 0x4d,
+    0xba, 0x5b, 0xb9, 0x4d, 0xce, 0xcf, 0xd5, 0xfc, 0x2f, 0xf2, 0xb7, 0xc3, 0x74, 0xfe, 0x97, 0x95,
+    0x01, 0x04, 0xee, 0x33, 0x85, 0x6c, 0x59, 0x56, 0xca, 0xf5, 0x89, 0x48, 0x19, 0x42, 0x43, 0x71,
+    0x36, 0xf7, 0x96, 0xb8, 0xb4, 0xee, 0x93, 0x9c, 0xba, 0x9b, 0xfb, 0x09, 0x67, 0x22, 0x70, 0x49,
+    0x0e, 0x55, 0xc9, 0x18, 0xc5, 0x28, 0xfa, 0x30, 0xfd, 0xea, 0x34, 0x0c, 0x7e, 0xc3, 0x67, 0x7a,
+    0x12, 0x47, 0x38, 0xcb, 0x50, 0x80, 0x9d, 0xf2, 0x05, 0x77, 0x74, 0xd9, 0xb0, 0x3a, 0xac, 0xf3,
+    0xba, 0xaa, 0xbc, 0x00, 0x85, 0x33, 0xa6, 0x34, 0xa1, 0x4e, 0xa9, 0xfe, 0x20, 0x75, 0xc3, 0x44,
+    0x5c, 0x7d, 0x47, 0x76, 0x13, 0xdc, 0xd6, 0x7c, 0xac, 0x58, 0x1d, 0xd5, 0xc1, 0x3b, 0x42, 0x31,
+    0x25, 0x75, 0xeb, 0xc5, 0x4b, 0x60, 0x5d, 0xfc, 0xa9, 0xe9, 0x5f, 0xf2, 0x06, 0x23, 0x8a, 0x80,
+    0x12, 0x00, 0x00,
+};
+
+static const uint8_t PAGE_WEB_HTML[] PROGMEM = {
+    0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x3c,
+    0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x3c, 0x6d, 0x65, 0x74, 0x61,
+    0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3d, 0x27, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x27,
+    0x3e, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x27, 0x76, 0x69, 0x65,
+    0x77, 0x70, 0x6f, 0x72, 0x74, 0x27, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x27,
+    0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2d, 0x77, 0x69, 0x64,
+    0x74, 0x68, 0x2c, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x2d, 0x73, 0x63, 0x61, 0x6c,
+    0x65, 0x3d, 0x31, 0x27, 0x3e, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x52, 0x6f, 0x62, 0x6f,
+    0x74, 0x20, 0x50, 0x6f, 0x69, 0x73, 0x73, 0x6f, 0x6e, 0x20, 0x4d, 0x4b, 0x52, 0x3c, 0x2f, 0x74,
+    0x69, 0x74, 0x6c, 0x65, 0x3e, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e, 0x62, 0x6f, 0x64, 0x79,
+    0x7b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x23, 0x30, 0x66, 0x31,
+    0x37, 0x32, 0x61, 0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x65, 0x32, 0x65, 0x38, 0x66,
+    0x30, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x73, 0x61,
+    0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c,
+    0x69, 0x67, 0x6e, 0x3a, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69,
+    0x6e, 0x3a, 0x30, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x32, 0x30, 0x70, 0x78,
+    0x7d, 0x2e, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x7b, 0x6d, 0x61, 0x78, 0x2d,
+    0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x38, 0x30, 0x30, 0x70, 0x78, 0x3b, 0x6d, 0x61, 0x72, 0x67,
+    0x69, 0x6e, 0x3a, 0x61, 0x75, 0x74, 0x6f, 0x7d, 0x68, 0x31, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+    0x3a, 0x23, 0x33, 0x38, 0x62, 0x64, 0x66, 0x38, 0x7d, 0x2e, 0x64, 0x61, 0x73, 0x68, 0x62, 0x6f,
+    0x61, 0x72, 0x64, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x67, 0x72, 0x69, 0x64,
+    0x3b, 0x67, 0x72, 0x69, 0x64, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x2d, 0x63,
+    0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x73, 0x3a, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x28, 0x61, 0x75,
+    0x74, 0x6f, 0x2d, 0x66, 0x69, 0x74, 0x2c, 0x6d, 0x69, 0x6e, 0x6d, 0x61, 0x78, 0x28, 0x31, 0x35,
+    0x30, 0x70, 0x78, 0x2c, 0x31, 0x66, 0x72, 0x29, 0x29, 0x3b, 0x67, 0x61, 0x70, 0x3a, 0x31, 0x35,
+    0x70, 0x78, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d,
+    0x3a, 0x32, 0x30, 0x70, 0x78, 0x7d, 0x2e, 0x63, 0x61, 0x72, 0x64, 0x7b, 0x62, 0x61, 0x63, 0x6b,
+    0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x23, 0x31, 0x65, 0x32, 0x39, 0x33, 0x62, 0x3b, 0x70,
+    0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x35, 0x70, 0x78, 0x3b, 0x62, 0x6f, 0x72, 0x64,
+    0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x31, 0x30, 0x70, 0x78, 0x3b, 0x62,
+    0x6f, 0x78, 0x2d, 0x73, 0x68, 0x61, 0x64, 0x6f, 0x77, 0x3a, 0x30, 0x20, 0x34, 0x70, 0x78, 0x20,
+    0x36, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30,
+    0x2e, 0x33, 0x29, 0x7d, 0x2e, 0x76, 0x61, 0x6c, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69,
+    0x7a, 0x65, 0x3a, 0x31, 0x2e, 0x32, 0x65, 0x6d, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65,
+    0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x6f, 0x6c, 0x64, 0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+    0x23, 0x33, 0x34, 0x64, 0x33, 0x39, 0x39, 0x7d, 0x2e, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x7b, 0x66,
+    0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x30, 0x2e, 0x38, 0x65, 0x6d, 0x3b, 0x63,
+    0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x39, 0x34, 0x61, 0x33, 0x62, 0x38, 0x7d, 0x2e, 0x63, 0x6f,
+    0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x73, 0x7b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e,
+    0x64, 0x3a, 0x23, 0x31, 0x65, 0x32, 0x39, 0x33, 0x62, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e,
+    0x67, 0x3a, 0x32, 0x30, 0x70, 0x78, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61,
+    0x64, 0x69, 0x75, 0x73, 0x3a, 0x31, 0x35, 0x70, 0x78, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e,
+    0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x31, 0x30, 0x70, 0x78, 0x7d, 0x2e, 0x6b, 0x65, 0x79, 0x2d, 0x72,
+    0x6f, 0x77, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x66, 0x6c, 0x65, 0x78, 0x3b,
+    0x6a, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
+    0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x67, 0x61, 0x70, 0x3a, 0x31, 0x30, 0x70, 0x78, 0x3b,
+    0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x31, 0x30, 0x70, 0x78, 0x20, 0x30, 0x7d, 0x2e, 0x6b,
+    0x65, 0x79, 0x7b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x23, 0x33,
+    0x33, 0x34, 0x31, 0x35, 0x35, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x35,
+    0x70, 0x78, 0x20, 0x32, 0x35, 0x70, 0x78, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72,
+    0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x38, 0x70, 0x78, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77,
+    0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x6f, 0x6c, 0x64, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65,
+    0x72, 0x3a, 0x32, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 0x34, 0x37, 0x35,
+    0x35, 0x36, 0x39, 0x3b, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, 0x70, 0x6f, 0x69, 0x6e, 0x74,
+    0x65, 0x72, 0x3b, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3a, 0x6e,
+    0x6f, 0x6e, 0x65, 0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x65, 0x32, 0x65, 0x38, 0x66,
+    0x30, 0x3b, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x62, 0x61, 0x63,
+    0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x30, 0x2e, 0x31, 0x73, 0x2c, 0x74, 0x72, 0x61,
+    0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x30, 0x2e, 0x30, 0x35, 0x73, 0x7d, 0x2e, 0x6b, 0x65,
+    0x79, 0x3a, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x7b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f,
+    0x75, 0x6e, 0x64, 0x3a, 0x23, 0x32, 0x32, 0x63, 0x35, 0x35, 0x65, 0x3b, 0x63, 0x6f, 0x6c, 0x6f,
+    0x72, 0x3a, 0x23, 0x30, 0x30, 0x30, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x63, 0x6f,
+    0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3b, 0x74, 0x72, 0x61, 0x6e,
+    0x73, 0x66, 0x6f, 0x72, 0x6d, 0x3a, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x6c, 0x61, 0x74, 0x65, 0x59,
+    0x28, 0x32, 0x70, 0x78, 0x29, 0x7d, 0x2e, 0x6b, 0x65, 0x79, 0x2e, 0x61, 0x63, 0x74, 0x69, 0x76,
+    0x65, 0x7b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x23, 0x32, 0x32,
+    0x63, 0x35, 0x35, 0x65, 0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x30, 0x30, 0x30, 0x3b,
+    0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x3b, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x3a, 0x74,
+    0x72, 0x61, 0x6e, 0x73, 0x6c, 0x61, 0x74, 0x65, 0x59, 0x28, 0x32, 0x70, 0x78, 0x29, 0x7d, 0x3c,
+    0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x3c, 0x62,
+    0x6f, 0x64, 0x79, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27,
+    0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x27, 0x3e, 0x3c, 0x68, 0x31, 0x3e, 0x43,
+    0x4f, 0x4d, 0x4d, 0x41, 0x4e, 0x44, 0x45, 0x52, 0x20, 0x43, 0x45, 0x4e, 0x54, 0x45, 0x52, 0x3c,
+    0x2f, 0x68, 0x31, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27,
+    0x64, 0x61, 0x73, 0x68, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x27, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20,
+    0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27, 0x63, 0x61, 0x72, 0x64, 0x27, 0x3e, 0x3c, 0x64, 0x69,
+    0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x27, 0x3e,
+    0x4d, 0x4f, 0x44, 0x45, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63,
+    0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27, 0x76, 0x61, 0x6c, 0x27, 0x20, 0x69, 0x64, 0x3d, 0x27, 0x6d,
+    0x6f, 0x64, 0x65, 0x27, 0x3e, 0x4d, 0x41, 0x4e, 0x55, 0x45, 0x4c, 0x3c, 0x2f, 0x64, 0x69, 0x76,
+    0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73,
+    0x73, 0x3d, 0x27, 0x63, 0x61, 0x72, 0x64, 0x27, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c,
+    0x61, 0x73, 0x73, 0x3d, 0x27, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x27, 0x3e, 0x42, 0x41, 0x54, 0x54,
+    0x45, 0x52, 0x49, 0x45, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63,
+    0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27, 0x76, 0x61, 0x6c, 0x27, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e,
+    0x20, 0x69, 0x64, 0x3d, 0x27, 0x76, 0x62, 0x61, 0x74, 0x27, 0x3e, 0x2d, 0x2d, 0x3c, 0x2f, 0x73,
+    0x70, 0x61, 0x6e, 0x3e, 0x20, 0x56, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x64, 0x69,
+    0x76, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27, 0x63, 0x61,
+    0x72, 0x64, 0x27, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27,
+    0x6c, 0x61, 0x62, 0x65, 0x6c, 0x27, 0x3e, 0x50, 0x52, 0x4f, 0x46, 0x4f, 0x4e, 0x44, 0x45, 0x55,
+    0x52, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73,
+    0x73, 0x3d, 0x27, 0x76, 0x61, 0x6c, 0x27, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x69, 0x64,
+    0x3d, 0x27, 0x70, 0x72, 0x6f, 0x66, 0x27, 0x3e, 0x2d, 0x2d, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e,
+    0x3e, 0x20, 0x6d, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c,
+    0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27, 0x63, 0x61, 0x72, 0x64, 0x27,
+    0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27, 0x6c, 0x61, 0x62,
+    0x65, 0x6c, 0x27, 0x3e, 0x43, 0x41, 0x50, 0x20, 0x28, 0x59, 0x41, 0x57, 0x29, 0x3c, 0x2f, 0x64,
+    0x69, 0x76, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27, 0x76,
+    0x61, 0x6c, 0x27, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x69, 0x64, 0x3d, 0x27, 0x79, 0x61,
+    0x77, 0x27, 0x3e, 0x2d, 0x2d, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x20, 0x64, 0x65, 0x67,
+    0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x64, 0x69,
+    0x76, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27, 0x64, 0x61,
+    0x73, 0x68, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x27, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x27,
+    0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x30, 0x2e, 0x38, 0x65, 0x6d, 0x27,
+    0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27, 0x63, 0x61, 0x72,
+    0x64, 0x27, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27, 0x6c,
+    0x61, 0x62, 0x65, 0x6c, 0x27, 0x3e, 0x41, 0x43, 0x43, 0x45, 0x4c, 0x20, 0x28, 0x58, 0x2f, 0x59,
+    0x2f, 0x5a, 0x29, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64,
+    0x3d, 0x27, 0x61, 0x63, 0x63, 0x27, 0x3e, 0x2d, 0x2d, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c,
+    0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+    0x27, 0x63, 0x61, 0x72, 0x64, 0x27, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73,
+    0x73, 0x3d, 0x27, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x27, 0x3e, 0x47, 0x59, 0x52, 0x4f, 0x20, 0x28,
+    0x58, 0x2f, 0x59, 0x2f, 0x5a, 0x29, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x64, 0x69, 0x76,
+    0x20, 0x69, 0x64, 0x3d, 0x27, 0x67, 0x79, 0x72, 0x27, 0x3e, 0x2d, 0x2d, 0x3c, 0x2f, 0x64, 0x69,
+    0x76, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61,
+    0x73, 0x73, 0x3d, 0x27, 0x63, 0x61, 0x72, 0x64, 0x27, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63,
+    0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x27, 0x3e, 0x41, 0x54, 0x54,
+    0x49, 0x54, 0x55, 0x44, 0x45, 0x20, 0x28, 0x50, 0x2f, 0x52, 0x29, 0x3c, 0x2f, 0x64, 0x69, 0x76,
+    0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x27, 0x61, 0x74, 0x74, 0x27, 0x3e, 0x2d,
+    0x2d, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x64,
+    0x69, 0x76, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27, 0x63,
+    0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x73, 0x27, 0x3e, 0x3c, 0x68, 0x33, 0x3e, 0x50, 0x49, 0x4c,
+    0x4f, 0x54, 0x41, 0x47, 0x45, 0x20, 0x28, 0x43, 0x6c, 0x61, 0x76, 0x69, 0x65, 0x72, 0x20, 0x5a,
+    0x51, 0x53, 0x44, 0x20, 0x2b, 0x20, 0x41, 0x29, 0x3c, 0x2f, 0x68, 0x33, 0x3e, 0x3c, 0x64, 0x69,
+    0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27, 0x6b, 0x65, 0x79, 0x2d, 0x72, 0x6f, 0x77,
+    0x27, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27, 0x6b, 0x65,
+    0x79, 0x27, 0x20, 0x69, 0x64, 0x3d, 0x27, 0x6b, 0x5a, 0x27, 0x20, 0x6f, 0x6e, 0x63, 0x6c, 0x69,
+    0x63, 0x6b, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x64, 0x43, 0x6d, 0x64, 0x28, 0x27, 0x5a, 0x27, 0x29,
+    0x22, 0x3e, 0x5a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c,
+    0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27, 0x6b, 0x65, 0x79, 0x2d, 0x72,
+    0x6f, 0x77, 0x27, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27,
+    0x6b, 0x65, 0x79, 0x27, 0x20, 0x69, 0x64, 0x3d, 0x27, 0x6b, 0x51, 0x27, 0x20, 0x6f, 0x6e, 0x63,
+    0x6c, 0x69, 0x63, 0x6b, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x64, 0x43, 0x6d, 0x64, 0x28, 0x27, 0x51,
+    0x27, 0x29, 0x22, 0x3e, 0x51, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20,
+    0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27, 0x6b, 0x65, 0x79, 0x27, 0x20, 0x69, 0x64, 0x3d, 0x27,
+    0x6b, 0x53, 0x27, 0x20, 0x6f, 0x6e, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x3d, 0x22, 0x73, 0x65, 0x6e,
+    0x64, 0x43, 0x6d, 0x64, 0x28, 0x27, 0x53, 0x27, 0x29, 0x22, 0x3e, 0x53, 0x3c, 0x2f, 0x64, 0x69,
+    0x76, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27, 0x6b, 0x65,
+    0x79, 0x27, 0x20, 0x69, 0x64, 0x3d, 0x27, 0x6b, 0x44, 0x27, 0x20, 0x6f, 0x6e, 0x63, 0x6c, 0x69,
+    0x63, 0x6b, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x64, 0x43, 0x6d, 0x64, 0x28, 0x27, 0x44, 0x27, 0x29,
+    0x22, 0x3e, 0x44, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c,
+    0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27, 0x6b, 0x65, 0x79, 0x2d, 0x72,
+    0x6f, 0x77, 0x27, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27,
+    0x6b, 0x65, 0x79, 0x27, 0x20, 0x69, 0x64, 0x3d, 0x27, 0x6b, 0x41, 0x27, 0x20, 0x6f, 0x6e, 0x63,
+    0x6c, 0x69, 0x63, 0x6b, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x64, 0x43, 0x6d, 0x64, 0x28, 0x27, 0x41,
+    0x27, 0x29, 0x22, 0x3e, 0x41, 0x20, 0x28, 0x41, 0x55, 0x54, 0x4f, 0x29, 0x3c, 0x2f, 0x64, 0x69,
+    0x76, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f,
+    0x64, 0x69, 0x76, 0x3e, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x66, 0x75, 0x6e, 0x63,
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x43, 0x6d, 0x64, 0x28, 0x6b, 0x29, 0x7b,
+    0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2f, 0x63, 0x6d, 0x64, 0x3f, 0x6b, 0x65, 0x79, 0x3d,
+    0x27, 0x2b, 0x6b, 0x29, 0x3b, 0x7d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+    0x73, 0x65, 0x74, 0x4b, 0x65, 0x79, 0x41, 0x63, 0x74, 0x69, 0x76, 0x65, 0x28, 0x6b, 0x2c, 0x61,
+    0x29, 0x7b, 0x6b, 0x3d, 0x6b, 0x2e, 0x74, 0x6f, 0x55, 0x70, 0x70, 0x65, 0x72, 0x43, 0x61, 0x73,
+    0x65, 0x28, 0x29, 0x3b, 0x76, 0x61, 0x72, 0x20, 0x65, 0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d,
+    0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79,
+    0x49, 0x64, 0x28, 0x27, 0x6b, 0x27, 0x2b, 0x6b, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x21, 0x65, 0x6c,
+    0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x69, 0x66, 0x28, 0x61, 0x29, 0x65, 0x6c, 0x2e,
+    0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x28, 0x27, 0x61,
+    0x63, 0x74, 0x69, 0x76, 0x65, 0x27, 0x29, 0x3b, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x65, 0x6c, 0x2e,
+    0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65,
+    0x28, 0x27, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x27, 0x29, 0x3b, 0x7d, 0x0a, 0x77, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74,
+    0x65, 0x6e, 0x65, 0x72, 0x28, 0x27, 0x6b, 0x65, 0x79, 0x64, 0x6f, 0x77, 0x6e, 0x27, 0x2c, 0x66,
+    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x65, 0x29, 0x7b, 0x76, 0x61, 0x72, 0x20, 0x6b,
+    0x3d, 0x65, 0x2e, 0x6b, 0x65, 0x79, 0x3b, 0x69, 0x66, 0x28, 0x21, 0x6b, 0x29, 0x72, 0x65, 0x74,
+    0x75, 0x72, 0x6e, 0x3b, 0x6b, 0x3d, 0x6b, 0x2e, 0x74, 0x6f, 0x55, 0x70, 0x70, 0x65, 0x72, 0x43,
+    0x61, 0x73, 0x65, 0x28, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x5b, 0x27, 0x5a, 0x27, 0x2c, 0x27, 0x51,
+    0x27, 0x2c, 0x27, 0x53, 0x27, 0x2c, 0x27, 0x44, 0x27, 0x2c, 0x27, 0x41, 0x27, 0x5d, 0x2e, 0x69,
+    0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x28, 0x6b, 0x29, 0x29, 0x7b, 0x69, 0x66, 0x28, 0x65,
+    0x2e, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x65,
+    0x2e, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x28,
+    0x29, 0x3b, 0x73, 0x65, 0x74, 0x4b, 0x65, 0x79, 0x41, 0x63, 0x74, 0x69, 0x76, 0x65, 0x28, 0x6b,
+    0x2c, 0x74, 0x72, 0x75, 0x65, 0x29, 0x3b, 0x73, 0x65, 0x6e, 0x64, 0x43, 0x6d, 0x64, 0x28, 0x6b,
+    0x29, 0x3b, 0x7d, 0x7d, 0x29, 0x3b, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x61, 0x64, 0x64,
+    0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27, 0x6b,
+    0x65, 0x79, 0x75, 0x70, 0x27, 0x2c, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x65,
+    0x29, 0x7b, 0x76, 0x61, 0x72, 0x20, 0x6b, 0x3d, 0x65, 0x2e, 0x6b, 0x65, 0x79, 0x3b, 0x69, 0x66,
+    0x28, 0x21, 0x6b, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x6b, 0x3d, 0x6b, 0x2e, 0x74,
+    0x6f, 0x55, 0x70, 0x70, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x3b, 0x69, 0x66, 0x28,
+    0x5b, 0x27, 0x5a, 0x27, 0x2c, 0x27, 0x51, 0x27, 0x2c, 0x27, 0x53, 0x27, 0x2c, 0x27, 0x44, 0x27,
+    0x2c, 0x27, 0x41, 0x27, 0x5d, 0x2e, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x28, 0x6b,
+    0x29, 0x29, 0x7b, 0x65, 0x2e, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x44, 0x65, 0x66, 0x61,
+    0x75, 0x6c, 0x74, 0x28, 0x29, 0x3b, 0x73, 0x65, 0x74, 0x4b, 0x65, 0x79, 0x41, 0x63, 0x74, 0x69,
+    0x76, 0x65, 0x28, 0x6b, 0x2c, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x5b,
+    0x27, 0x5a, 0x27, 0x2c, 0x27, 0x51, 0x27, 0x2c, 0x27, 0x53, 0x27, 0x2c, 0x27, 0x44, 0x27, 0x5d,
+    0x2e, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x28, 0x6b, 0x29, 0x29, 0x7b, 0x73, 0x65,
+    0x6e, 0x64, 0x43, 0x6d, 0x64, 0x28, 0x27, 0x53, 0x27, 0x29, 0x3b, 0x7d, 0x7d, 0x7d, 0x29, 0x3b,
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x64, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x54,
+    0x72, 0x61, 0x6d, 0x65, 0x28, 0x62, 0x29, 0x7b, 0x76, 0x61, 0x72, 0x20, 0x76, 0x3d, 0x6e, 0x65,
+    0x77, 0x20, 0x44, 0x61, 0x74, 0x61, 0x56, 0x69, 0x65, 0x77, 0x28, 0x62, 0x29, 0x3b, 0x69, 0x66,
+    0x28, 0x76, 0x2e, 0x67, 0x65, 0x74, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x28, 0x30, 0x29, 0x21, 0x3d,
+    0x3d, 0x31, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x3b, 0x76,
+    0x61, 0x72, 0x20, 0x66, 0x3d, 0x76, 0x2e, 0x67, 0x65, 0x74, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x28,
+    0x31, 0x29, 0x3b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x7b, 0x70, 0x3a, 0x76, 0x2e, 0x67, 0x65,
+    0x74, 0x49, 0x6e, 0x74, 0x31, 0x36, 0x28, 0x32, 0x2c, 0x74, 0x72, 0x75, 0x65, 0x29, 0x2f, 0x31,
+    0x30, 0x30, 0x30, 0x2c, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x3a, 0x76, 0x2e, 0x67, 0x65, 0x74, 0x55,
+    0x69, 0x6e, 0x74, 0x33, 0x32, 0x28, 0x34, 0x2c, 0x74, 0x72, 0x75, 0x65, 0x29, 0x2c, 0x79, 0x61,
+    0x77, 0x3a, 0x76, 0x2e, 0x67, 0x65, 0x74, 0x49, 0x6e, 0x74, 0x31, 0x36, 0x28, 0x31, 0x32, 0x2c,
+    0x74, 0x72, 0x75, 0x65, 0x29, 0x2f, 0x31, 0x30, 0x2c, 0x70, 0x69, 0x74, 0x3a, 0x76, 0x2e, 0x67,
+    0x65, 0x74, 0x49, 0x6e, 0x74, 0x31, 0x36, 0x28, 0x31, 0x34, 0x2c, 0x74, 0x72, 0x75, 0x65, 0x29,
+    0x2f, 0x31, 0x30, 0x2c, 0x72, 0x6f, 0x6c, 0x3a, 0x76, 0x2e, 0x67, 0x65, 0x74, 0x49, 0x6e, 0x74,
+    0x31, 0x36, 0x28, 0x31, 0x36, 0x2c, 0x74, 0x72, 0x75, 0x65, 0x29, 0x2f, 0x31, 0x30, 0x2c, 0x61,
+    0x78, 0x3a, 0x76, 0x2e, 0x67, 0x65, 0x74, 0x49, 0x6e, 0x74, 0x31, 0x36, 0x28, 0x31, 0x38, 0x2c,
+    0x74, 0x72, 0x75, 0x65, 0x29, 0x2f, 0x31, 0x30, 0x30, 0x2c, 0x61, 0x79, 0x3a, 0x76, 0x2e, 0x67,
+    0x65, 0x74, 0x49, 0x6e, 0x74, 0x31, 0x36, 0x28, 0x32, 0x30, 0x2c, 0x74, 0x72, 0x75, 0x65, 0x29,
+    0x2f, 0x31, 0x30, 0x30, 0x2c, 0x61, 0x7a, 0x3a, 0x76, 0x2e, 0x67, 0x65, 0x74, 0x49, 0x6e, 0x74,
+    0x31, 0x36, 0x28, 0x32, 0x32, 0x2c, 0x74, 0x72, 0x75, 0x65, 0x29, 0x2f, 0x31, 0x30, 0x30, 0x2c,
+    0x67, 0x78, 0x3a, 0x76, 0x2e, 0x67, 0x65, 0x74, 0x49, 0x6e, 0x74, 0x31, 0x36, 0x28, 0x32, 0x34,
+    0x2c, 0x74, 0x72, 0x75, 0x65, 0x29, 0x2f, 0x31, 0x30, 0x30, 0x30, 0x2c, 0x67, 0x79, 0x3a, 0x76,
+    0x2e, 0x67, 0x65, 0x74, 0x49, 0x6e, 0x74, 0x31, 0x36, 0x28, 0x32, 0x36, 0x2c, 0x74, 0x72, 0x75,
+    0x65, 0x29, 0x2f, 0x31, 0x30, 0x30, 0x30, 0x2c, 0x67, 0x7a, 0x3a, 0x76, 0x2e, 0x67, 0x65, 0x74,
+    0x49, 0x6e, 0x74, 0x31, 0x36, 0x28, 0x32, 0x38, 0x2c, 0x74, 0x72, 0x75, 0x65, 0x29, 0x2f, 0x31,
+    0x30, 0x30, 0x30, 0x2c, 0x76, 0x3a, 0x76, 0x2e, 0x67, 0x65, 0x74, 0x55, 0x69, 0x6e, 0x74, 0x31,
+    0x36, 0x28, 0x33, 0x30, 0x2c, 0x74, 0x72, 0x75, 0x65, 0x29, 0x2f, 0x31, 0x30, 0x30, 0x30, 0x2c,
+    0x69, 0x3a, 0x76, 0x2e, 0x67, 0x65, 0x74, 0x49, 0x6e, 0x74, 0x31, 0x36, 0x28, 0x33, 0x32, 0x2c,
+    0x74, 0x72, 0x75, 0x65, 0x29, 0x2c, 0x70, 0x41, 0x67, 0x65, 0x3a, 0x76, 0x2e, 0x67, 0x65, 0x74,
+    0x55, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x28, 0x33, 0x34, 0x2c, 0x74, 0x72, 0x75, 0x65, 0x29, 0x2c,
+    0x6c, 0x65, 0x61, 0x6b, 0x3a, 0x21, 0x21, 0x28, 0x66, 0x26, 0x31, 0x29, 0x2c, 0x6c, 0x65, 0x61,
+    0x6b, 0x4c, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x3a, 0x21, 0x21, 0x28, 0x66, 0x26, 0x32, 0x29,
+    0x2c, 0x61, 0x75, 0x74, 0x6f, 0x3a, 0x21, 0x21, 0x28, 0x66, 0x26, 0x34, 0x29, 0x7d, 0x3b, 0x7d,
+    0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x66, 0x66, 0x69, 0x63, 0x68,
+    0x65, 0x28, 0x64, 0x29, 0x7b, 0x69, 0x66, 0x28, 0x21, 0x64, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72,
+    0x6e, 0x3b, 0x76, 0x61, 0x72, 0x20, 0x65, 0x6c, 0x3b, 0x65, 0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75,
+    0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42,
+    0x79, 0x49, 0x64, 0x28, 0x27, 0x76, 0x62, 0x61, 0x74, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x65,
+    0x6c, 0x29, 0x65, 0x6c, 0x2e, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x64,
+    0x2e, 0x76, 0x2e, 0x74, 0x6f, 0x46, 0x69, 0x78, 0x65, 0x64, 0x28, 0x32, 0x29, 0x3b, 0x65, 0x6c,
+    0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65,
+    0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x72, 0x6f, 0x66, 0x27, 0x29,
+    0x3b, 0x69, 0x66, 0x28, 0x65, 0x6c, 0x29, 0x65, 0x6c, 0x2e, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x54,
+    0x65, 0x78, 0x74, 0x3d, 0x64, 0x2e, 0x70, 0x2e, 0x74, 0x6f, 0x46, 0x69, 0x78, 0x65, 0x64, 0x28,
+    0x32, 0x29, 0x3b, 0x65, 0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67,
+    0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x79,
+    0x61, 0x77, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x65, 0x6c, 0x29, 0x65, 0x6c, 0x2e, 0x69, 0x6e,
+    0x6e, 0x65, 0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x64, 0x2e, 0x79, 0x61, 0x77, 0x2e, 0x74, 0x6f,
+    0x46, 0x69, 0x78, 0x65, 0x64, 0x28, 0x30, 0x29, 0x3b, 0x65, 0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75,
+    0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42,
+    0x79, 0x49, 0x64, 0x28, 0x27, 0x61, 0x63, 0x63, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x65, 0x6c,
+    0x29, 0x65, 0x6c, 0x2e, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x64, 0x2e,
+    0x61, 0x78, 0x2e, 0x74, 0x6f, 0x46, 0x69, 0x78, 0x65, 0x64, 0x28, 0x31, 0x29, 0x2b, 0x27, 0x2f,
+    0x27, 0x2b, 0x64, 0x2e, 0x61, 0x79, 0x2e, 0x74, 0x6f, 0x46, 0x69, 0x78, 0x65, 0x64, 0x28, 0x31,
+    0x29, 0x2b, 0x27, 0x2f, 0x27, 0x2b, 0x64, 0x2e, 0x61, 0x7a, 0x2e, 0x74, 0x6f, 0x46, 0x69, 0x78,
+    0x65, 0x64, 0x28, 0x31, 0x29, 0x3b, 0x65, 0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e,
+    0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64,
+    0x28, 0x27, 0x67, 0x79, 0x72, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x65, 0x6c, 0x29, 0x65, 0x6c,
+    0x2e, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x64, 0x2e, 0x67, 0x78, 0x2e,
+    0x74, 0x6f, 0x46, 0x69, 0x78, 0x65, 0x64, 0x28, 0x31, 0x29, 0x2b, 0x27, 0x2f, 0x27, 0x2b, 0x64,
+    0x2e, 0x67, 0x79, 0x2e, 0x74, 0x6f, 0x46, 0x69, 0x78, 0x65, 0x64, 0x28, 0x31, 0x29, 0x2b, 0x27,
+    0x2f, 0x27, 0x2b, 0x64, 0x2e, 0x67, 0x7a, 0x2e, 0x74, 0x6f, 0x46, 0x69, 0x78, 0x65, 0x64, 0x28,
+    0x31, 0x29, 0x3b, 0x65, 0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67,
+    0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x61,
+    0x74, 0x74, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x65, 0x6c, 0x29, 0x65, 0x6c, 0x2e, 0x69, 0x6e,
+    0x6e, 0x65, 0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x64, 0x2e, 0x70, 0x69, 0x74, 0x2e, 0x74, 0x6f,
+    0x46, 0x69, 0x78, 0x65, 0x64, 0x28, 0x30, 0x29, 0x2b, 0x27, 0x2f, 0x27, 0x2b, 0x64, 0x2e, 0x72,
+    0x6f, 0x6c, 0x2e, 0x74, 0x6f, 0x46, 0x69, 0x78, 0x65, 0x64, 0x28, 0x30, 0x29, 0x3b, 0x65, 0x6c,
+    0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65,
+    0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x6d, 0x6f, 0x64, 0x65, 0x27, 0x29,
+    0x3b, 0x69, 0x66, 0x28, 0x65, 0x6c, 0x29, 0x65, 0x6c, 0x2e, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x54,
+    0x65, 0x78, 0x74, 0x3d, 0x64, 0x2e, 0x61, 0x75, 0x74, 0x6f, 0x3f, 0x27, 0x41, 0x55, 0x54, 0x4f,
+    0x4e, 0x4f, 0x4d, 0x45, 0x27, 0x3a, 0x27, 0x4d, 0x41, 0x4e, 0x55, 0x45, 0x4c, 0x27, 0x3b, 0x7d,
+    0x0a, 0x76, 0x61, 0x72, 0x20, 0x73, 0x63, 0x72, 0x75, 0x74, 0x65, 0x3d, 0x6e, 0x75, 0x6c, 0x6c,
+    0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x64, 0x65, 0x6d, 0x61, 0x72, 0x72,
+    0x65, 0x53, 0x63, 0x72, 0x75, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x7b, 0x69, 0x66,
+    0x28, 0x73, 0x63, 0x72, 0x75, 0x74, 0x65, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x73,
+    0x63, 0x72, 0x75, 0x74, 0x65, 0x3d, 0x73, 0x65, 0x74, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61,
+    0x6c, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x7b, 0x66, 0x65, 0x74,
+    0x63, 0x68, 0x28, 0x27, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x62, 0x69, 0x6e, 0x27, 0x29, 0x2e,
+    0x74, 0x68, 0x65, 0x6e, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x72, 0x29,
+    0x7b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x2e, 0x61, 0x72, 0x72, 0x61, 0x79, 0x42,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x29, 0x3b, 0x7d, 0x29, 0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28,
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x62, 0x29, 0x7b, 0x61, 0x66, 0x66, 0x69,
+    0x63, 0x68, 0x65, 0x28, 0x64, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x54, 0x72, 0x61, 0x6d, 0x65, 0x28,
+    0x62, 0x29, 0x29, 0x3b, 0x7d, 0x29, 0x3b, 0x7d, 0x2c, 0x32, 0x30, 0x30, 0x29, 0x3b, 0x7d, 0x0a,
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x36, 0x34, 0x28, 0x73, 0x29, 0x7b,
+    0x76, 0x61, 0x72, 0x20, 0x74, 0x3d, 0x61, 0x74, 0x6f, 0x62, 0x28, 0x73, 0x29, 0x2c, 0x75, 0x3d,
+    0x6e, 0x65, 0x77, 0x20, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x74,
+    0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x29, 0x3b, 0x66, 0x6f, 0x72, 0x28, 0x76, 0x61, 0x72,
+    0x20, 0x69, 0x3d, 0x30, 0x3b, 0x69, 0x3c, 0x74, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b,
+    0x69, 0x2b, 0x2b, 0x29, 0x75, 0x5b, 0x69, 0x5d, 0x3d, 0x74, 0x2e, 0x63, 0x68, 0x61, 0x72, 0x43,
+    0x6f, 0x64, 0x65, 0x41, 0x74, 0x28, 0x69, 0x29, 0x3b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
+    0x75, 0x2e, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x3b, 0x7d, 0x0a, 0x69, 0x66, 0x28, 0x77, 0x69,
+    0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65,
+    0x29, 0x7b, 0x76, 0x61, 0x72, 0x20, 0x65, 0x73, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x45, 0x76, 0x65,
+    0x6e, 0x74, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x28, 0x27, 0x2f, 0x73, 0x74, 0x72, 0x65, 0x61,
+    0x6d, 0x3f, 0x68, 0x7a, 0x3d, 0x32, 0x30, 0x27, 0x29, 0x3b, 0x65, 0x73, 0x2e, 0x6f, 0x6e, 0x6d,
+    0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x3d, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28,
+    0x65, 0x29, 0x7b, 0x61, 0x66, 0x66, 0x69, 0x63, 0x68, 0x65, 0x28, 0x64, 0x65, 0x63, 0x6f, 0x64,
+    0x65, 0x54, 0x72, 0x61, 0x6d, 0x65, 0x28, 0x62, 0x36, 0x34, 0x28, 0x65, 0x2e, 0x64, 0x61, 0x74,
+    0x61, 0x29, 0x29, 0x29, 0x3b, 0x7d, 0x3b, 0x65, 0x73, 0x2e, 0x6f, 0x6e, 0x65, 0x72, 0x72, 0x6f,
+    0x72, 0x3d, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x7b, 0x65, 0x73, 0x2e,
+    0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28, 0x29, 0x3b, 0x64, 0x65, 0x6d, 0x61, 0x72, 0x72, 0x65, 0x53,
+    0x63, 0x72, 0x75, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x3b, 0x7d, 0x3b, 0x7d, 0x65,
+    0x6c, 0x73, 0x65, 0x7b, 0x64, 0x65, 0x6d, 0x61, 0x72, 0x72, 0x65, 0x53, 0x63, 0x72, 0x75, 0x74,
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x3b, 0x7d, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70,
+    0x74, 0x3e, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e,
+};
+
+#endif
@@ -0,0 +1,213 @@
+#ifndef POINT_FIXE_H
+#define POINT_FIXE_H
+
+#include <Arduino.h>
+#include <string.h>
+
+// =====================
+//   Virgule fixe 32 bits
+// =====================
+//
+// Le Cortex-M0+ du SAMD21 n'a pas de FPU : chaque opération float est un
+// appel de routine logicielle (__aeabi_fadd, fmul, fdiv, fcmp...). Fixe<FRAC>
+// stocke v * 2^FRAC dans un int32 : addition et comparaison entières,
+// multiplication sur 64 bits puis décalage.
+//
+//   Q16_16 : +/- 32768, résolution 1.5e-5   (angles, gains, mAh, m)
+//   Q8_24  : +/- 128,   résolution 6e-8     (grandeurs normalisées [0 ; 1])
+//
+// Toutes les opérations saturent au lieu de reboucler (division par zéro
+// comprise) : une commande qui déborde reste en butée, du bon côté.
+//
+// POINT_FIXE choisit le chemin des calculs par tick (PID et étage servo,
+// compteur coulomb, seuils Safety, PWM, nombres JSON) :
+//   -DPOINT_FIXE=0   référence float (même code source que le chemin fixe
+//                    là où il est générique, cf. LoiPid, niveauBatterie)
+// Les deux chemins sont toujours compilés : la touche 'x' les compare sur la
+// cible (écart max et durée par appel).
+
+#ifndef POINT_FIXE
+#define POINT_FIXE 1
+#endif
+
+template <uint8_t FRAC>
+class Fixe
+{
+    static_assert(FRAC > 0 && FRAC < 31, "Fixe : 1 a 30 bits de fraction");
+
+public:
+    static const int32_t UN       = (int32_t)1 << FRAC;
+    static const int32_t BRUT_MAX = 0x7FFFFFFF;
+    static const int32_t BRUT_MIN = -BRUT_MAX - 1;
+    static const int32_t ENT_MAX  = BRUT_MAX >> FRAC;   // plus grand entier représentable
+
+    constexpr Fixe() : _brut(0) {}
+
+    // Entier : décalage seul, saturé
+    constexpr explicit Fixe(int v)
+    : _brut(v > ENT_MAX ? BRUT_MAX : v < -ENT_MAX - 1 ? BRUT_MIN : (int32_t)((uint32_t)v << FRAC)) {}
+
+    static constexpr Fixe depuisBrut(int32_t brut) { return Fixe(brut, 0); }
+
+    // Constante calculée à la compilation (static constexpr) : passe par des
+    // flottants, à ne pas appeler avec une valeur connue à l'exécution
+    static constexpr Fixe constante(float v)
+    {
+        return depuisBrut(v * UN >= 2147483647.0f ? BRUT_MAX
+                        : v * UN <= -2147483648.0f ? BRUT_MIN
+                        : (int32_t)(v * UN + (v < 0.0f ? -0.5f : 0.5f)));
+    }
+
+    // Conversion à l'exécution sans routine flottante : mantisse décalée
+    // selon l'exposant IEEE 754, arrondie. NaN -> 0, hors plage -> saturé.
+    static Fixe depuisFloat(float v)
+    {
+        uint32_t bits;
+        memcpy(&bits, &v, sizeof(bits));
+
+        bool    negatif  = (bits >> 31) != 0;
+        int32_t exposant = (int32_t)((bits >> 23) & 0xFF);
+        uint32_t mantisse = (bits & 0x7FFFFF) | 0x800000;
+
+        if (exposant == 0xFF) {
+            if (bits & 0x7FFFFF) return Fixe();                           // NaN
+            return depuisBrut(negatif ? BRUT_MIN : BRUT_MAX);             // +/- inf
+        }
+        if (exposant == 0) return Fixe();                                 // 0, dénormalisés
+
+        // |v| * 2^FRAC = mantisse * 2^decalage
+        int32_t decalage = exposant - 127 - 23 + FRAC;
+        uint32_t m;
+        if (decalage >= 0) {
+            if (decalage > 7) return depuisBrut(negatif ? BRUT_MIN : BRUT_MAX);
+            m = mantisse << decalage;                                     // < 2^31
+        } else if (decalage >= -24) {
+            m = (mantisse + (1UL << (-decalage - 1))) >> -decalage;
+        } else {
+            return Fixe();
+        }
+
+        if (negatif) return depuisBrut((int32_t)(0U - m));
+        return depuisBrut(m > (uint32_t)BRUT_MAX ? BRUT_MAX : (int32_t)m);
+    }
+
+    // Sortie vers l'API float (télémétrie, journal) : hors chemin par tick
+    float versFloat() const { return (float)_brut * (1.0f / UN); }
+
+    int32_t brut() const { return _brut; }
+
+    // Entier le plus proche (demi vers +inf)
+    int32_t arrondi() const
+    {
+        return (int32_t)(((int64_t)_brut + (UN >> 1)) >> FRAC);
+    }
+
+    // --- Arithmétique saturée ---
+
+    Fixe operator+(Fixe b) const
+    {
+        uint32_t r = (uint32_t)_brut + (uint32_t)b._brut;
+        // Débordement : opérandes de même signe, résultat de signe opposé
+        if ((int32_t)((_brut ^ r) & (b._brut ^ r)) < 0) return depuisBrut(_brut < 0 ? BRUT_MIN : BRUT_MAX);
+        return depuisBrut((int32_t)r);
+    }
+
+    Fixe operator-(Fixe b) const
+    {
+        uint32_t r = (uint32_t)_brut - (uint32_t)b._brut;
+        if ((int32_t)((_brut ^ b._brut) & (_brut ^ r)) < 0) return depuisBrut(_brut < 0 ? BRUT_MIN : BRUT_MAX);
+        return depuisBrut((int32_t)r);
+    }
+
+    Fixe operator-() const
+    {
+        return depuisBrut(_brut == BRUT_MIN ? BRUT_MAX : -_brut);
+    }
+
+    Fixe operator*(Fixe b) const
+    {
+        int64_t p = (int64_t)_brut * b._brut;
+        return depuisBrut(sature((p + (UN >> 1)) >> FRAC));
+    }
+
+    Fixe operator/(Fixe b) const
+    {
+        if (b._brut == 0) {
+            if (_brut == 0) return Fixe();
+            return depuisBrut(_brut < 0 ? BRUT_MIN : BRUT_MAX);
+        }
+        int64_t n = (int64_t)_brut * UN;
+        int64_t d = b._brut;
+        int64_t demi = ((d < 0) ? -d : d) / 2;
+        n += (n < 0) ? -demi : demi;
+        return depuisBrut(sature(n / d));
+    }
+
+    Fixe& operator+=(Fixe b) { return *this = *this + b; }
+    Fixe& operator-=(Fixe b) { return *this = *this - b; }
+    Fixe& operator*=(Fixe b) { return *this = *this * b; }
+    Fixe& operator/=(Fixe b) { return *this = *this / b; }
+
+    bool operator==(Fixe b) const { return _brut == b._brut; }
+    bool operator!=(Fixe b) const { return _brut != b._brut; }
+    bool operator< (Fixe b) const { return _brut <  b._brut; }
+    bool operator<=(Fixe b) const { return _brut <= b._brut; }
+    bool operator> (Fixe b) const { return _brut >  b._brut; }
+    bool operator>=(Fixe b) const { return _brut >= b._brut; }
+
+    static int32_t sature(int64_t v)
+    {
+        return (v > BRUT_MAX) ? BRUT_MAX : (v < BRUT_MIN) ? BRUT_MIN : (int32_t)v;
+    }
+
+private:
+    constexpr Fixe(int32_t brut, int) : _brut(brut) {}
+
+    int32_t _brut;
+};
+
+typedef Fixe<16> Q16_16;
+typedef Fixe<24> Q8_24;
+
+// Type du chemin par tick, de l'instantané capteurs à la commande servo
+#if POINT_FIXE
+typedef Q16_16 ReelAsserv;
+#else
+typedef float  ReelAsserv;
+#endif
+
+// =====================
+//   Code générique float / Fixe
+// =====================
+//
+// Un même algorithme écrit une fois (template <typename T>) donne la
+// référence float et la version virgule fixe.
+
+// Entrée depuis l'API float (capteurs, consignes)
+template <typename T> inline T reel(float v)        { return T::depuisFloat(v); }
+template <>           inline float reel<float>(float v) { return v; }
+
+// num / den (den > 0) sans passer par un flottant pour Fixe (ex: ms -> s)
+template <typename T> inline T fraction(int32_t num, int32_t den)
+{
+    int64_t n = (int64_t)num * T::UN;
+    n += (n < 0) ? -(den / 2) : den / 2;
+    return T::depuisBrut(T::sature(n / den));
+}
+template <> inline float fraction<float>(int32_t num, int32_t den) { return (float)num / (float)den; }
+
+// Grandeur publiée sous les deux formes (API float, chemin par tick) :
+// prend celle du type de calcul, sans conversion
+template <typename T> inline T grandeur(float f, Q16_16 q);
+template <> inline float  grandeur<float>(float f, Q16_16)  { return f; }
+template <> inline Q16_16 grandeur<Q16_16>(float, Q16_16 q) { return q; }
+
+inline float versFloat(float v) { return v; }
+template <uint8_t FRAC> inline float versFloat(Fixe<FRAC> v) { return v.versFloat(); }
+
+template <typename T> inline T borneReel(T v, T mini, T maxi)
+{
+    return (v < mini) ? mini : (maxi < v) ? maxi : v;
+}
+
+#endif
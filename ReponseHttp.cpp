@@ -0,0 +1,272 @@
+#include "ReponseHttp.h"
+#include "PointFixe.h"
+#include <math.h>
+
+ReponseHttp::ReponseHttp(char* tampon, uint16_t taille)
+: _tampon(tampon)
+, _taille(taille)
+, _len(0)
+, _finEntetes(0)
+, _debordement(false)
+, _premierChamp(true)
+, _termine(false)
+{
+}
+
+const char* ReponseHttp::texteStatut(uint16_t code)
+{
+    switch (code) {
+        case 200: return "OK";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 405: return "Method Not Allowed";
+        case 406: return "Not Acceptable";
+        case 408: return "Request Timeout";
+        case 414: return "URI Too Long";
+        case 431: return "Request Header Fields Too Large";
+        case 500: return "Internal Server Error";
+        default:  return "Service Unavailable";
+    }
+}
+
+bool ReponseHttp::reserve(uint16_t n)
+{
+    if (_debordement) return false;
+    if ((uint32_t)_len + n > _taille) {
+        _debordement = true;
+        return false;
+    }
+    return true;
+}
+
+// =====================
+//   En-tête
+// =====================
+
+void ReponseHttp::statut(uint16_t code)
+{
+    ajoute("HTTP/1.1 ");
+    ajouteNaturel(code);
+    ajoute(' ');
+    ajoute(texteStatut(code));
+    ajoute("\r\n");
+}
+
+void ReponseHttp::entete(const char* nom, const char* valeur)
+{
+    ajoute(nom);
+    ajoute(": ");
+    ajoute(valeur);
+    ajoute("\r\n");
+}
+
+void ReponseHttp::finEntetes()
+{
+    _finEntetes   = _len;
+    _premierChamp = true;
+}
+
+void ReponseHttp::finEntetesFlux()
+{
+    ajoute("Connection: keep-alive\r\n\r\n");
+    _finEntetes   = 0;
+    _premierChamp = true;
+}
+
+// =====================
+//   Corps
+// =====================
+
+void ReponseHttp::ajoute(const char* s)
+{
+    ajouteOctets(s, strlen(s));
+}
+
+void ReponseHttp::ajoute(char c)
+{
+    if (!reserve(1)) return;
+    _tampon[_len++] = c;
+}
+
+void ReponseHttp::ajouteOctets(const void* p, uint16_t n)
+{
+    if (!reserve(n)) return;
+    memcpy(_tampon + _len, p, n);
+    _len += n;
+}
+
+void ReponseHttp::ajouteNaturel(uint32_t v)
+{
+    char chiffres[10];
+    uint8_t n = 0;
+    do {
+        chiffres[n++] = '0' + (v % 10);
+        v /= 10;
+    } while (v);
+
+    if (!reserve(n)) return;
+    while (n) _tampon[_len++] = chiffres[--n];
+}
+
+void ReponseHttp::ajouteEntier(int32_t v)
+{
+    if (v < 0) {
+        ajoute('-');
+        ajouteNaturel((uint32_t)0 - (uint32_t)v);
+    } else {
+        ajouteNaturel((uint32_t)v);
+    }
+}
+
+static const uint32_t puissances[] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+
+bool ReponseHttp::decoupeDecimalFlottant(float v, uint8_t decimales, bool& negatif, uint32_t& ent, uint32_t& frac)
+{
+    // Hors de portée d'un uint32 : pas une valeur de capteur
+    if (isnan(v) || isinf(v) || fabsf(v) >= 4.0e9f) return false;
+
+    uint32_t p = puissances[decimales];
+    negatif = v < 0.0f;
+    if (negatif) v = -v;
+
+    // Partie entière à part : la mise à l'échelle ne tient pas forcément sur 32 bits
+    ent  = (uint32_t)v;
+    frac = (uint32_t)((v - (float)ent) * (float)p + 0.5f);
+    if (frac >= p) { ent++; frac -= p; }
+    return true;
+}
+
+bool ReponseHttp::decoupeDecimal(float v, uint8_t decimales, bool& negatif, uint32_t& ent, uint32_t& frac)
+{
+    uint32_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+
+    negatif = (bits >> 31) != 0;
+    int32_t  exposant = (int32_t)((bits >> 23) & 0xFF);
+    uint32_t mantisse = (bits & 0x7FFFFF) | 0x800000;
+
+    if (exposant == 0xFF) return false;                  // NaN, inf
+    ent  = 0;
+    frac = 0;
+    if (exposant == 0) return true;                      // 0, dénormalisés
+
+    // |v| = mantisse * 2^decalage
+    int32_t decalage = exposant - 127 - 23;
+    if (decalage >= 0) {
+        if (decalage > 8) return false;                  // >= 2^32
+        uint64_t e = (uint64_t)mantisse << decalage;
+        if (e >= 4000000000ULL) return false;
+        ent = (uint32_t)e;
+        return true;
+    }
+    if (decalage < -63) return true;
+
+    // Partie fractionnaire : bits sous la virgule * 10^decimales, arrondi
+    // (mantisse < 2^24, 10^6 < 2^20 : le produit tient sur 64 bits)
+    uint32_t n = (uint32_t)-decalage;
+    uint32_t p = puissances[decimales];
+    uint64_t bitsFrac = (n >= 24) ? mantisse : (mantisse & ((1UL << n) - 1));
+    ent  = (n >= 24) ? 0 : (mantisse >> n);
+    frac = (uint32_t)((bitsFrac * p + ((uint64_t)1 << (n - 1))) >> n);
+    if (frac >= p) { ent++; frac -= p; }
+    return true;
+}
+
+void ReponseHttp::ajouteFixe(float v, uint8_t decimales)
+{
+    if (decimales > 6) decimales = 6;
+
+    bool     negatif;
+    uint32_t ent, frac;
+#if POINT_FIXE
+    bool ok = decoupeDecimal(v, decimales, negatif, ent, frac);
+#else
+    bool ok = decoupeDecimalFlottant(v, decimales, negatif, ent, frac);
+#endif
+
+    // JSON valide quand même
+    if (!ok) {
+        ajoute("null");
+        return;
+    }
+
+    if (negatif && (ent || frac)) ajoute('-');
+    ajouteNaturel(ent);
+    if (decimales == 0) return;
+
+    // Partie fractionnaire sur "decimales" chiffres, zéros de tête compris
+    char chiffres[7];
+    chiffres[0] = '.';
+    for (uint8_t i = decimales; i > 0; i--) {
+        chiffres[i] = '0' + (frac % 10);
+        frac /= 10;
+    }
+    ajouteOctets(chiffres, decimales + 1);
+}
+
+void ReponseHttp::cleJson(const char* nom)
+{
+    if (!_premierChamp) ajoute(',');
+    _premierChamp = false;
+
+    ajoute('"');
+    ajoute(nom);
+    ajoute("\":");
+}
+
+// =====================
+//   Envoi
+// =====================
+
+void ReponseHttp::ecritErreurInterne()
+{
+    static const char k500[] =
+        "HTTP/1.1 500 Internal Server Error\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+
+    _len = 0;
+    _finEntetes = 0;
+    if (sizeof(k500) - 1 <= _taille) {
+        memcpy(_tampon, k500, sizeof(k500) - 1);
+        _len = sizeof(k500) - 1;
+    }
+}
+
+uint16_t ReponseHttp::termine(uint32_t longueurExterne)
+{
+    if (_termine) return _len;
+    _termine = true;
+
+    if (_debordement) {
+        ecritErreurInterne();
+        return _len;
+    }
+    if (_finEntetes == 0) return _len;
+
+    uint16_t corps = _len - _finEntetes;
+
+    // "Content-Length: N\r\nConnection: close\r\n\r\n", construit à part puis inséré
+    char ligne[64];
+    ReponseHttp l(ligne, sizeof(ligne));
+    l.ajoute("Content-Length: ");
+    l.ajouteNaturel((uint32_t)corps + longueurExterne);
+    l.ajoute("\r\nConnection: close\r\n\r\n");
+
+    if (!reserve(l.taille())) {
+        ecritErreurInterne();
+        return _len;
+    }
+
+    memmove(_tampon + _finEntetes + l.taille(), _tampon + _finEntetes, corps);
+    memcpy(_tampon + _finEntetes, ligne, l.taille());
+    _len += l.taille();
+
+    return _len;
+}
+
+size_t ReponseHttp::envoie(Print& client, uint32_t longueurExterne)
+{
+    uint16_t n = termine(longueurExterne);
+    if (n == 0) return 0;
+    return client.write(donnees(), n);
+}
@@ -0,0 +1,80 @@
+#ifndef REPONSE_HTTP_H
+#define REPONSE_HTTP_H
+
+#include <Arduino.h>
+
+// =====================
+//   Construction de réponse HTTP en un seul tampon
+// =====================
+//
+// Ligne de statut, en-têtes et corps sont assemblés dans un tampon fourni
+// par l'appelant (en général sur la pile), puis envoyés en un seul write :
+// sur WiFiNINA chaque print() est une commande SPI et souvent un segment TCP.
+//
+// Content-Length est inséré à la fin (le corps est décalé d'autant), il
+// n'a donc pas à être connu d'avance. Formatage entier / virgule fixe
+// maison : pas de Print::print(float) ni de printf flottant.
+//
+// Tampon trop petit : rien ne déborde, la réponse devient un 500.
+
+class ReponseHttp
+{
+public:
+    ReponseHttp(char* tampon, uint16_t taille);
+
+    // --- En-tête ---
+    void statut(uint16_t code);                        // "HTTP/1.1 200 OK"
+    void entete(const char* nom, const char* valeur);
+
+    // Fin des en-têtes : Content-Length + Connection: close ajoutés par termine()
+    void finEntetes();
+    // Fin des en-têtes d'un flux gardé ouvert (SSE) : pas de Content-Length
+    void finEntetesFlux();
+
+    // --- Corps ---
+    void ajoute(const char* s);
+    void ajoute(char c);
+    void ajouteOctets(const void* p, uint16_t n);
+    void ajouteEntier(int32_t v);
+    void ajouteNaturel(uint32_t v);
+    void ajouteBool(bool b) { ajoute(b ? "true" : "false"); }
+    // v avec "decimales" chiffres après la virgule (arrondi) ; NaN/inf -> null
+    void ajouteFixe(float v, uint8_t decimales = 2);
+
+    // |v| = ent + frac / 10^decimales (decimales <= 6) ; false si NaN, inf
+    // ou |v| >= 4e9. Entière (bits IEEE 754, chemin POINT_FIXE) ou float
+    // (référence) : ajouteFixe() ne fait plus d'opération flottante.
+    static bool decoupeDecimal(float v, uint8_t decimales, bool& negatif, uint32_t& ent, uint32_t& frac);
+    static bool decoupeDecimalFlottant(float v, uint8_t decimales, bool& negatif, uint32_t& ent, uint32_t& frac);
+
+    // JSON : "nom": (avec la virgule si ce n'est pas le premier champ)
+    void cleJson(const char* nom);
+
+    // --- Envoi ---
+    // Insère Content-Length (corps du tampon + longueurExterne, ex: page en
+    // flash envoyée à part) ; retourne la taille totale du tampon.
+    uint16_t termine(uint32_t longueurExterne = 0);
+    const uint8_t* donnees() const { return (const uint8_t*)_tampon; }
+
+    // termine() puis un seul write ; retourne le nombre d'octets écrits
+    size_t envoie(Print& client, uint32_t longueurExterne = 0);
+
+    bool     debordement() const { return _debordement; }
+    uint16_t taille() const { return _len; }
+
+    static const char* texteStatut(uint16_t code);
+
+private:
+    char*    _tampon;
+    uint16_t _taille;
+    uint16_t _len;
+    uint16_t _finEntetes;    // position d'insertion de Content-Length (0 = aucune)
+    bool     _debordement;
+    bool     _premierChamp;
+    bool     _termine;
+
+    bool reserve(uint16_t n);
+    void ecritErreurInterne();
+};
+
+#endif
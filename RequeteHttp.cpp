@@ -0,0 +1,257 @@
+#include "RequeteHttp.h"
+#include <strings.h>
+#include <limits.h>
+
+void RequeteHttp::reset()
+{
+    _ligne[0]      = '\0';
+    _len           = 0;
+    _chemin        = 0;
+    _query         = 0;
+    _octetsEntetes = 0;
+    _finLigne      = 0;
+    _lenEntete     = 0;
+    _enteteTronque = false;
+    _ifNoneMatch[0] = '\0';
+    _accepteGzip    = false;
+    _refuseIdentite = false;
+    _etat          = LIGNE;
+    _code          = 0;
+}
+
+RequeteHttp::Etat RequeteHttp::feed(char c)
+{
+    if (_etat == LIGNE) {
+        if (c == '\r') return _etat;
+
+        if (c == '\n') {
+            _ligne[_len] = '\0';
+            if (!decoupeLigne()) return erreur(400);
+            _etat = ENTETES;
+            _finLigne = 1;
+            return _etat;
+        }
+
+        // -1 : place pour le '\0' final
+        if (_len >= TAILLE_LIGNE - 1) return erreur(414);
+        _ligne[_len++] = c;
+        return _etat;
+    }
+
+    if (_etat == ENTETES) {
+        if (++_octetsEntetes > MAX_ENTETES) return erreur(431);
+
+        if (c == '\r') return _etat;
+        if (c == '\n') {
+            if (++_finLigne >= 2) {
+                _etat = COMPLETE;
+            } else {
+                traiteEntete();
+            }
+            return _etat;
+        }
+        _finLigne = 0;
+
+        if (_lenEntete < TAILLE_ENTETE - 1) _entete[_lenEntete++] = c;
+        else                                _enteteTronque = true;
+    }
+
+    return _etat;
+}
+
+// Nom d'en-tête en tête de ligne (sans casse) : pointe sur la valeur, sans
+// les blancs de début
+static const char* valeurEntete(const char* ligne, const char* nom)
+{
+    size_t n = strlen(nom);
+    if (strncasecmp(ligne, nom, n) != 0) return nullptr;
+
+    const char* v = ligne + n;
+    while (*v == ' ' || *v == '\t') v++;
+    return v;
+}
+
+// Fin d'une ligne d'en-tête : on ne garde que If-None-Match et Accept-Encoding
+void RequeteHttp::traiteEntete()
+{
+    _entete[_lenEntete] = '\0';
+
+    const char* v;
+    if (_enteteTronque) {
+        // ignorée
+    }
+    else if ((v = valeurEntete(_entete, "If-None-Match:")) != nullptr) {
+        size_t len = strlen(v);
+        while (len > 0 && (v[len - 1] == ' ' || v[len - 1] == '\t')) len--;
+
+        if (len < TAILLE_ETAG) {
+            memcpy(_ifNoneMatch, v, len);
+            _ifNoneMatch[len] = '\0';
+        }
+    }
+    else if ((v = valeurEntete(_entete, "Accept-Encoding:")) != nullptr) {
+        analyseEncodages(v);
+    }
+
+    _lenEntete     = 0;
+    _enteteTronque = false;
+}
+
+// "gzip, deflate;q=0.5, identity;q=0" : un codage par élément, seul q=0
+// (refus) compte, les autres poids n'ordonnent rien ici
+void RequeteHttp::analyseEncodages(const char* v)
+{
+    int8_t gzip = -1, identite = -1, etoile = -1;   // -1 absent, 0 refusé, 1 accepté
+
+    while (*v) {
+        while (*v == ' ' || *v == '\t' || *v == ',') v++;
+        const char* nom = v;
+        while (*v && *v != ',' && *v != ';' && *v != ' ' && *v != '\t') v++;
+        size_t n = (size_t)(v - nom);
+
+        // Paramètres : "q=0", "q=0.0"... refusent le codage
+        int8_t accepte = 1;
+        while (*v && *v != ',') {
+            if (*v == ';') {
+                v++;
+                while (*v == ' ' || *v == '\t') v++;
+                if ((*v == 'q' || *v == 'Q') && v[1] == '=') {
+                    const char* q = v + 2;
+                    bool nul = (*q == '0');
+                    if (nul && q[1] == '.') for (q += 2; *q >= '0' && *q <= '9'; q++) nul = nul && *q == '0';
+                    if (nul) accepte = 0;
+                }
+                continue;
+            }
+            v++;
+        }
+
+        if      (n == 4 && strncasecmp(nom, "gzip", 4) == 0)     gzip     = accepte;
+        else if (n == 6 && strncasecmp(nom, "x-gzip", 6) == 0)   gzip     = accepte;
+        else if (n == 8 && strncasecmp(nom, "identity", 8) == 0) identite = accepte;
+        else if (n == 1 && *nom == '*')                           etoile   = accepte;
+    }
+
+    _accepteGzip    = gzip == 1 || (gzip < 0 && etoile == 1);
+    _refuseIdentite = identite == 0 || (identite < 0 && etoile == 0);
+}
+
+// "GET /chemin?query HTTP/1.1" -> "GET\0/chemin\0query\0HTTP/1.1"
+bool RequeteHttp::decoupeLigne()
+{
+    char* sp1 = strchr(_ligne, ' ');
+    if (!sp1 || sp1 == _ligne) return false;
+    *sp1 = '\0';
+
+    char* cible = sp1 + 1;
+    if (*cible != '/') return false;
+
+    char* sp2 = strchr(cible, ' ');
+    if (sp2) *sp2 = '\0';   // HTTP/0.9 : pas de version, toléré
+
+    _chemin = (uint8_t)(cible - _ligne);
+
+    char* q = strchr(cible, '?');
+    if (q) {
+        *q = '\0';
+        _query = (uint8_t)(q + 1 - _ligne);
+    } else {
+        // pointe sur le '\0' de fin du chemin -> query vide
+        _query = (uint8_t)(cible + strlen(cible) - _ligne);
+    }
+
+    return true;
+}
+
+bool RequeteHttp::parametre(const char* nom, const char*& valeur, uint8_t& longueur) const
+{
+    size_t n = strlen(nom);
+    const char* p = query();
+
+    while (*p) {
+        const char* fin = strchr(p, '&');
+        if (!fin) fin = p + strlen(p);
+
+        if ((size_t)(fin - p) > n && strncmp(p, nom, n) == 0 && p[n] == '=') {
+            valeur   = p + n + 1;
+            longueur = (uint8_t)(fin - valeur);
+            return true;
+        }
+        if ((size_t)(fin - p) == n && strncmp(p, nom, n) == 0) {
+            valeur   = fin;     // "?nom" sans valeur
+            longueur = 0;
+            return true;
+        }
+
+        p = (*fin == '&') ? fin + 1 : fin;
+    }
+
+    return false;
+}
+
+bool RequeteHttp::parametreEntier(const char* nom, long& valeur) const
+{
+    const char* v;
+    uint8_t n;
+    if (!parametre(nom, v, n) || n == 0) return false;
+
+    bool negatif = (*v == '-');
+    uint8_t i = negatif ? 1 : 0;
+    if (i >= n) return false;
+
+    // Magnitude en non signé, bornée avant chaque pas : un nombre trop
+    // long est refusé au lieu de reboucler (LONG_MIN compris)
+    unsigned long limite = negatif ? 0UL - (unsigned long)LONG_MIN : (unsigned long)LONG_MAX;
+    unsigned long r = 0;
+
+    for (; i < n; i++) {
+        if (v[i] < '0' || v[i] > '9') return false;
+        unsigned long chiffre = (unsigned long)(v[i] - '0');
+        if (r > (limite - chiffre) / 10) return false;
+        r = r * 10 + chiffre;
+    }
+
+    valeur = negatif ? (long)(0UL - r) : (long)r;
+    return true;
+}
+
+bool RequeteHttp::parametreDecimal(const char* nom, float& valeur) const
+{
+    const char* v;
+    uint8_t n;
+    if (!parametre(nom, v, n) || n == 0) return false;
+
+    bool negatif = (*v == '-');
+    uint8_t i = negatif ? 1 : 0;
+
+    float r = 0.0f;
+    float echelle = 1.0f;    // poids du prochain chiffre décimal
+    bool  decimale = false;
+    bool  chiffre = false;
+
+    for (; i < n; i++) {
+        char c = v[i];
+        if (c == '.' && !decimale) { decimale = true; continue; }
+        if (c < '0' || c > '9') return false;
+        chiffre = true;
+        if (!decimale) {
+            r = r * 10.0f + (c - '0');
+        } else {
+            echelle *= 0.1f;
+            r += (c - '0') * echelle;
+        }
+    }
+    if (!chiffre) return false;
+
+    valeur = negatif ? -r : r;
+    return true;
+}
+
+bool RequeteHttp::parametreChar(const char* nom, char& valeur) const
+{
+    const char* v;
+    uint8_t n;
+    if (!parametre(nom, v, n) || n == 0) return false;
+    valeur = v[0];
+    return true;
+}
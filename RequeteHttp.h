@@ -0,0 +1,92 @@
+#ifndef REQUETE_HTTP_H
+#define REQUETE_HTTP_H
+
+#include <Arduino.h>
+
+// =====================
+//   Analyse de requête HTTP sans allocation
+// =====================
+//
+// Tampon fixe pour la ligne de requête, découpée sur place (méthode,
+// chemin, query). Les en-têtes sont comptés jusqu'à la ligne vide, avec
+// une limite d'octets ; seuls If-None-Match (cache de la page) et
+// Accept-Encoding (page gzip ou non) sont gardés.
+// Les paramètres de query sont rendus
+// sous forme de pointeur + longueur dans le tampon, sans copie.
+//
+// Alimentation octet par octet : feed() peut être appelé sur plusieurs
+// ticks, l'état est conservé entre deux appels.
+
+class RequeteHttp
+{
+public:
+    static const uint16_t TAILLE_LIGNE   = 160;   // ligne de requête max
+    static const uint16_t MAX_ENTETES    = 2048;  // octets d'en-têtes max
+    static const uint8_t  TAILLE_ENTETE  = 64;    // ligne d'en-tête examinée
+    static const uint8_t  TAILLE_ETAG    = 40;
+
+    enum Etat : uint8_t
+    {
+        LIGNE,       // lecture de "GET /chemin?query HTTP/1.1"
+        ENTETES,     // lecture des en-têtes jusqu'à la ligne vide
+        COMPLETE,
+        ERREUR       // voir codeErreur()
+    };
+
+    RequeteHttp() { reset(); }
+
+    void reset();
+
+    // Consomme un octet ; retourne le nouvel état
+    Etat feed(char c);
+
+    Etat     etat() const { return _etat; }
+    bool     terminee() const { return _etat == COMPLETE || _etat == ERREUR; }
+    uint16_t codeErreur() const { return _code; }   // 400, 414, 431
+
+    // Chaînes terminées par '\0' dans le tampon interne (valides jusqu'au reset)
+    const char* methode() const { return _ligne; }
+    const char* chemin()  const { return _ligne + _chemin; }
+    const char* query()   const { return _ligne + _query; }   // "" si absente
+
+    bool estMethode(const char* m) const { return strcmp(methode(), m) == 0; }
+
+    // Valeur de If-None-Match ("" si absent ou trop long)
+    const char* ifNoneMatch() const { return _ifNoneMatch; }
+
+    // Accept-Encoding : gzip accepté (nommé ou "*", q non nul) ; identité
+    // refusée seulement par "identity;q=0" ou "*;q=0". Sans en-tête (ou
+    // ligne trop longue) : identité seule, ex: curl sans --compressed
+    bool accepteGzip() const     { return _accepteGzip; }
+    bool accepteIdentite() const { return !_refuseIdentite; }
+
+    // Valeur brute du paramètre "nom" (non décodée, non terminée par '\0')
+    bool parametre(const char* nom, const char*& valeur, uint8_t& longueur) const;
+    bool parametreEntier(const char* nom, long& valeur) const;
+    // "12", "-0.5", ".25" (pas d'exposant)
+    bool parametreDecimal(const char* nom, float& valeur) const;
+    bool parametreChar(const char* nom, char& valeur) const;
+
+private:
+    char     _ligne[TAILLE_LIGNE];
+    uint16_t _len;
+    uint8_t  _chemin;
+    uint8_t  _query;
+    uint16_t _octetsEntetes;
+    uint8_t  _finLigne;        // nb de fins de ligne consécutives (ligne vide = 2)
+    char     _entete[TAILLE_ENTETE];
+    uint8_t  _lenEntete;
+    bool     _enteteTronque;
+    char     _ifNoneMatch[TAILLE_ETAG];
+    bool     _accepteGzip;
+    bool     _refuseIdentite;
+    Etat     _etat;
+    uint16_t _code;
+
+    bool decoupeLigne();
+    void traiteEntete();
+    void analyseEncodages(const char* v);
+    Etat erreur(uint16_t code) { _code = code; _etat = ERREUR; return _etat; }
+};
+
+#endif
@@ -1,9 +1,21 @@
 #include "Safety.h"
 #include <Arduino.h>
+#include "Horloge.h"
 
-static constexpr float kBatTripPercent = 15.0f;
+static constexpr int kBatTripPercent = 15;
 static constexpr unsigned long kBatDelayMs = 4000;
 
+template <typename T>
+NiveauBatterie niveauBatterie(T pourcent)
+{
+  // NaN : toutes les comparaisons sont fausses en float, 0 en virgule fixe
+  if (!(T(0) < pourcent && pourcent <= T(100))) return NiveauBatterie::INVALIDE;
+  return (pourcent < T(kBatTripPercent)) ? NiveauBatterie::BASSE : NiveauBatterie::OK;
+}
+
+template NiveauBatterie niveauBatterie<float>(float);
+template NiveauBatterie niveauBatterie<Q16_16>(Q16_16);
+
 void Safety::begin() {
   _latched = EmergencyState::NONE;
   _lowBatStartMs = 0;
@@ -14,26 +26,39 @@ EmergencyState Safety::update(const Capteurs& capteurs)
   if (_latched != EmergencyState::NONE)
     return _latched;
 
-  // 1) FUITE (API chez toi = getLeakData)
-  auto leak = capteurs.getLeakData();
-  if (leak.leakLatched) {
+  // Une seule trame cohérente pour toutes les vérifications
+  const CapteursData& d = capteurs.snapshot();
+
+  // 1) FUITE
+  if (d.leak.leakLatched) {
     _latched = EmergencyState::LEAK;
     return _latched;
   }
 
-  // 2) BATTERIE (on lit juste le % via une méthode)
-  float batPercent = capteurs.getBatteryPercent();
+  // 2) ALERTES MATERIELLES INA236 (interruption, déjà filtrées par la puce)
+  const PowerData& pwr = d.power;
+  if (pwr.alerteSurintensite) {
+    _latched = EmergencyState::OVERCURRENT;
+    return _latched;
+  }
+  if (pwr.alerteSousTension) {
+    _latched = EmergencyState::BATTERY;
+    return _latched;
+  }
+
+  // 3) BATTERIE (on lit juste le % via une méthode, dans le type du compteur)
+  NiveauBatterie niveau = niveauBatterie(capteurs.socBatterie());
 
 // ✅ Si le capteur batterie n'est pas dispo / pas initialisé, on ignore la condition batterie.
 // On considère "invalide" : <= 0, > 100, ou NaN.
-if (!(batPercent > 0.0f && batPercent <= 100.0f)) {
+if (niveau == NiveauBatterie::INVALIDE) {
   _lowBatStartMs = 0;
   return EmergencyState::NONE;
 }
 
-if (batPercent < kBatTripPercent) {
-  if (_lowBatStartMs == 0) _lowBatStartMs = millis();
-  if (millis() - _lowBatStartMs >= kBatDelayMs) {
+if (niveau == NiveauBatterie::BASSE) {
+  if (_lowBatStartMs == 0) _lowBatStartMs = horloge_ms();
+  if (horloge_ms() - _lowBatStartMs >= kBatDelayMs) {
     _latched = EmergencyState::BATTERY;
     return _latched;
   }
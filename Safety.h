@@ -1,7 +1,13 @@
 #pragma once
 #include "Capteurs.h"
+#include "PointFixe.h"
 
-enum class EmergencyState { NONE, BATTERY, LEAK };
+enum class EmergencyState { NONE, BATTERY, LEAK, OVERCURRENT };
+
+// Seuil batterie, float ou virgule fixe (POINT_FIXE) :
+// -1 mesure invalide (<= 0, > 100, NaN), 1 sous le seuil, 0 sinon
+enum class NiveauBatterie : int8_t { INVALIDE = -1, OK = 0, BASSE = 1 };
+template <typename T> NiveauBatterie niveauBatterie(T pourcent);
 
 class Safety {
 public:
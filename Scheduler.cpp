@@ -0,0 +1,179 @@
+#include "Scheduler.h"
+#include "Horloge.h"
+
+// Comparaison d'échéances robuste au débordement de micros() (~71 min)
+static inline bool echeanceAtteinte(uint32_t now, uint32_t echeance)
+{
+    return (int32_t)(now - echeance) >= 0;
+}
+
+Scheduler::Scheduler()
+: _count(0)
+, _nextBackground(0)
+, _dernierPassage_us(0)
+, _premierPassage(true)
+{
+}
+
+int8_t Scheduler::addTask(const char* nom, TaskFn fn, uint32_t periode_us, uint8_t priorite)
+{
+    if (_count >= MAX_TASKS || fn == nullptr) return -1;
+
+    Task& t = _tasks[_count];
+    t.nom         = nom;
+    t.fn          = fn;
+    t.periode_us  = periode_us;
+    t.priorite    = priorite;
+    t.echeance_us = horloge_us();
+    t.executions  = 0;
+    t.overruns    = 0;
+    t.duree.reset();
+    t.retard.reset();
+
+    return (int8_t)_count++;
+}
+
+int8_t Scheduler::addBackgroundTask(const char* nom, TaskFn fn)
+{
+    return addTask(nom, fn, 0, 255);
+}
+
+void Scheduler::begin()
+{
+    uint32_t now = horloge_us();
+    for (uint8_t i = 0; i < _count; i++) {
+        _tasks[i].echeance_us = now;
+    }
+    _nextBackground = 0;
+    _premierPassage = true;
+}
+
+// =====================
+//   Boucle
+// =====================
+
+void Scheduler::run()
+{
+    uint32_t now = horloge_us();
+    if (!_premierPassage) _boucle.ajoute(now - _dernierPassage_us);
+    _dernierPassage_us = now;
+    _premierPassage    = false;
+
+    int8_t idx = findDueTask(now);
+
+    if (idx >= 0) {
+        execute(_tasks[idx], now);
+    } else {
+        runBackground();
+    }
+}
+
+int8_t Scheduler::findDueTask(uint32_t now) const
+{
+    int8_t best = -1;
+
+    for (uint8_t i = 0; i < _count; i++) {
+        const Task& t = _tasks[i];
+        if (t.periode_us == 0) continue;
+        if (!echeanceAtteinte(now, t.echeance_us)) continue;
+
+        if (best < 0) { best = i; continue; }
+
+        const Task& b = _tasks[best];
+        // Priorité d'abord, puis l'échéance la plus ancienne
+        if (t.priorite < b.priorite ||
+            (t.priorite == b.priorite && (int32_t)(t.echeance_us - b.echeance_us) < 0)) {
+            best = i;
+        }
+    }
+
+    return best;
+}
+
+void Scheduler::runBackground()
+{
+    for (uint8_t n = 0; n < _count; n++) {
+        uint8_t i = (_nextBackground + n) % _count;
+        Task& t = _tasks[i];
+        if (t.periode_us != 0) continue;
+
+        _nextBackground = (i + 1) % _count;
+        execute(t, horloge_us());
+        return;
+    }
+}
+
+void Scheduler::execute(Task& t, uint32_t start)
+{
+    if (t.periode_us != 0) t.retard.ajoute(start - t.echeance_us);
+
+    t.fn();
+
+    uint32_t end = horloge_us();
+    t.duree.ajoute(end - start);
+    t.executions++;
+
+    if (t.periode_us == 0) return;
+
+    // Créneau perdu : on démarre (ou finit) au-delà de l'échéance suivante
+    t.echeance_us += t.periode_us;
+    if (echeanceAtteinte(end, t.echeance_us)) {
+        t.overruns++;
+        t.echeance_us = end + t.periode_us;
+    }
+}
+
+uint32_t Scheduler::tempsDisponible_us() const
+{
+    uint32_t now = horloge_us();
+    uint32_t mini = 0xFFFFFFFFUL;
+
+    for (uint8_t i = 0; i < _count; i++) {
+        const Task& t = _tasks[i];
+        if (t.periode_us == 0) continue;
+        if (echeanceAtteinte(now, t.echeance_us)) return 0;
+
+        uint32_t reste = t.echeance_us - now;
+        if (reste < mini) mini = reste;
+    }
+
+    return mini;
+}
+
+// =====================
+//   Statistiques
+// =====================
+
+void Scheduler::printStats()
+{
+    Serial.println("=== Scheduler ===");
+    for (uint8_t i = 0; i < _count; i++) {
+        const Task& t = _tasks[i];
+        Serial.print(t.nom);
+        Serial.print(" T=");
+        if (t.periode_us) { Serial.print(t.periode_us); Serial.print("us"); }
+        else              { Serial.print("fond"); }
+        Serial.print(" prio=");    Serial.print(t.priorite);
+        Serial.print(" exec=");    Serial.print(t.executions);
+        Serial.print(" overrun="); Serial.print(t.overruns);
+        Serial.print(" max=");     Serial.print(t.duree.max_us());
+        Serial.println("us");
+
+        if (t.periode_us) {
+            Serial.print("  retard(us) ");
+            t.retard.print(Serial);
+        }
+    }
+}
+
+void Scheduler::resetStats()
+{
+    for (uint8_t i = 0; i < _count; i++) {
+        _tasks[i].executions  = 0;
+        _tasks[i].overruns    = 0;
+        _tasks[i].duree.reset();
+        _tasks[i].retard.reset();
+    }
+    _boucle.reset();
+    _premierPassage = true;
+}
@@ -0,0 +1,87 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+#include "StatTemps.h"
+
+// =====================
+//   Ordonnanceur coopératif
+// =====================
+//
+// Chaque tâche a sa propre période et sa priorité (0 = la plus haute).
+// Les échéances sont calculées en horloge_us() (micros() sur la carte,
+// cf. Horloge.h) : une tâche à l'heure garde
+// une période exacte (échéance += période), une tâche en retard d'une
+// période complète ou plus est comptée en "overrun" et recalée sur
+// l'instant présent (on ne rattrape pas les créneaux perdus).
+//
+// Les tâches de fond (période 0) tournent uniquement quand aucune tâche
+// périodique n'est due : c'est le "temps restant" (ex: serveur web).
+//
+// Pour chaque tâche périodique, le retard au démarrage par rapport à
+// l'échéance est gardé en histogramme (printStats) : une période stable
+// sous charge web se voit à un retard qui reste dans les premières classes.
+
+typedef void (*TaskFn)();
+
+struct Task
+{
+    const char* nom;
+    TaskFn      fn;
+    uint32_t    periode_us;   // 0 = tâche de fond
+    uint8_t     priorite;     // 0 = la plus prioritaire
+
+    uint32_t    echeance_us;  // prochaine échéance (micros)
+    uint32_t    executions;
+    uint32_t    overruns;     // échéances manquées
+
+    StatTemps   duree;        // temps d'exécution (max = pire cas observé)
+    StatTemps   retard;       // démarrage - échéance : gigue de la période
+};
+
+class Scheduler
+{
+public:
+    static const uint8_t MAX_TASKS = 10;
+
+    Scheduler();
+
+    // Retourne l'index de la tâche, ou -1 si la table est pleine
+    int8_t addTask(const char* nom, TaskFn fn, uint32_t periode_us, uint8_t priorite);
+    int8_t addBackgroundTask(const char* nom, TaskFn fn);
+
+    // Aligne toutes les échéances sur l'instant présent
+    void begin();
+
+    // Un passage : exécute la tâche due la plus prioritaire,
+    // sinon une tâche de fond (tourniquet)
+    void run();
+
+    // Temps restant avant la prochaine échéance périodique
+    // (budget utilisable par une tâche de fond)
+    uint32_t tempsDisponible_us() const;
+
+    uint8_t     taskCount() const { return _count; }
+    const Task& task(uint8_t i) const { return _tasks[i]; }
+
+    // Intervalle entre deux passages de run() (période de loop())
+    const StatTemps& statBoucle() const { return _boucle; }
+
+    void printStats();
+    void resetStats();
+
+private:
+    Task    _tasks[MAX_TASKS];
+    uint8_t _count;
+    uint8_t _nextBackground;
+
+    StatTemps _boucle;
+    uint32_t  _dernierPassage_us;
+    bool      _premierPassage;
+
+    int8_t findDueTask(uint32_t now) const;
+    void   runBackground();
+    void   execute(Task& t, uint32_t start);
+};
+
+#endif
@@ -0,0 +1,44 @@
+#include "StatTemps.h"
+
+const uint32_t StatTemps::BORNES_US[StatTemps::NB_CLASSES - 1] = {
+    100, 500, 1000, 2000, 5000, 10000, 20000
+};
+
+void StatTemps::reset()
+{
+    _n     = 0;
+    _min   = 0xFFFFFFFFUL;
+    _max   = 0;
+    _somme = 0;
+    memset(_classes, 0, sizeof(_classes));
+}
+
+void StatTemps::ajoute(uint32_t duree_us)
+{
+    _n++;
+    _somme += duree_us;
+    if (duree_us < _min) _min = duree_us;
+    if (duree_us > _max) _max = duree_us;
+
+    uint8_t i = 0;
+    while (i < NB_CLASSES - 1 && duree_us >= BORNES_US[i]) i++;
+    _classes[i]++;
+}
+
+void StatTemps::print(Print& out) const
+{
+    out.print("n=");    out.print(_n);
+    out.print(" min="); out.print(min_us());
+    out.print(" moy="); out.print(moyenne_us());
+    out.print(" max="); out.print(_max);
+    out.print(" |");
+
+    for (uint8_t i = 0; i < NB_CLASSES; i++) {
+        out.print(' ');
+        if (i < NB_CLASSES - 1) { out.print('<'); out.print(BORNES_US[i]); }
+        else                    { out.print(">="); out.print(BORNES_US[NB_CLASSES - 2]); }
+        out.print(':');
+        out.print(_classes[i]);
+    }
+    out.println();
+}
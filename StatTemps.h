@@ -0,0 +1,43 @@
+#ifndef STAT_TEMPS_H
+#define STAT_TEMPS_H
+
+#include <Arduino.h>
+
+// =====================
+//   Statistique de durées (µs) en mémoire statique
+// =====================
+//
+// min / moyenne / max + histogramme à classes fixes (bornes communes
+// à toutes les instances, pour pouvoir comparer les tâches entre elles).
+
+class StatTemps
+{
+public:
+    static const uint8_t NB_CLASSES = 8;
+
+    // Bornes supérieures des classes (µs), la dernière classe est ouverte
+    static const uint32_t BORNES_US[NB_CLASSES - 1];
+
+    StatTemps() { reset(); }
+
+    void reset();
+    void ajoute(uint32_t duree_us);
+
+    uint32_t n()       const { return _n; }
+    uint32_t min_us()  const { return _n ? _min : 0; }
+    uint32_t max_us()  const { return _max; }
+    uint32_t moyenne_us() const { return _n ? (uint32_t)(_somme / _n) : 0; }
+    uint32_t classe(uint8_t i) const { return _classes[i]; }
+
+    // "n=.. min=.. moy=.. max=.. | <100:.. <500:.. ..." sur une ligne
+    void print(Print& out) const;
+
+private:
+    uint32_t _n;
+    uint32_t _min;
+    uint32_t _max;
+    uint64_t _somme;
+    uint32_t _classes[NB_CLASSES];
+};
+
+#endif
@@ -1,16 +1,17 @@
 #include "StateMachine.h"
+#include "Journal.h"
+#include "Horloge.h"
 
 // ---- Paramètres par défaut ----
 static constexpr float kDefaultTargetDepth = 0.3f; // 30 cm 
 static constexpr unsigned long kDefaultMoveDuration = 10000;
 static constexpr unsigned long kDefaultTurnDuration = 3000;
+static constexpr unsigned long kDefaultDescentTimeout = 30000;
+static constexpr unsigned long kDefaultAscentTimeout  = 15000;
 
 static constexpr float kMoveSpeed = 0.7f;
 static constexpr float kTurnSpeed = 0.6f;
 
-// évite le bug getElapsedTime()==0 et le spam série
-static constexpr unsigned long kEntryWindowMs = 50;
-
 // Seuil pour considérer qu'on a atteint la profondeur (ex: +/- 10cm)
 static constexpr float kDepthMargin = 0.10f; 
 
@@ -28,9 +29,12 @@ StateMachine::StateMachine(CommandMotor& motor, Capteurs& capteurs, Safety& safe
       _currentState(FishState::IDLE),
       _isRunning(false),
       _stateStartTime(0),
+      _entree(false),
       _targetDepth(kDefaultTargetDepth),
       _moveDuration(kDefaultMoveDuration),
       _turnDuration(kDefaultTurnDuration),
+      _descentTimeout(kDefaultDescentTimeout),
+      _ascentTimeout(kDefaultAscentTimeout),
       _emergency(EmergencyState::NONE)
 {
 }
@@ -40,7 +44,8 @@ void StateMachine::begin()
     Serial.println("[StateMachine] Initialisation");
     _currentState = FishState::IDLE;
     _isRunning = false;
-    _stateStartTime = millis();
+    _stateStartTime = horloge_ms();
+    _entree = false;
     _emergency = EmergencyState::NONE;
 }
 
@@ -81,14 +86,14 @@ void StateMachine::update()
 
 void StateMachine::startMission()
 {
-    Serial.println("[StateMachine] === START MISSION ===");
+    LOG_INFO("StateMachine", "=== START MISSION ===");
     _isRunning = true;
     changeState(FishState::DESCENDING);
 }
 
 void StateMachine::stopMission()
 {
-    Serial.println("[StateMachine] === STOP MISSION ===");
+    LOG_INFO("StateMachine", "=== STOP MISSION ===");
     _isRunning = false;
     _motor.setDriverCommand(0.0f);
     changeState(FishState::IDLE);
@@ -105,37 +110,34 @@ void StateMachine::updateIdle()
 
 void StateMachine::updateDescending()
 {
-    if (getElapsedTime() < kEntryWindowMs) {
-        Serial.print("[StateMachine] DESCENTE vers ");
-        Serial.print(_targetDepth);
-        Serial.println("m ...");
+    if (entreeEtat()) {
+        LOG_INFO("StateMachine", "DESCENTE vers %ld mm ...", (long)(_targetDepth * 1000.0f));
     }
 
     // 1. APPEL DE L'ASSERVISSEMENT
     _asserv.setProfondeurVoulue(_targetDepth);
 
-    // 2. VÉRIFICATION : Est-on arrivé ?
+    // 2. VÉRIFICATION : Est-on arrivé ? (seulement sur une profondeur fraîche)
     float currentDepth = _capteurs.getDepthData().depth_m;
     float error = abs(currentDepth - _targetDepth);
 
     // Si on est proche de la cible (marge de 10cm)
-    if (error < kDepthMargin) {
-        Serial.println("[StateMachine] Profondeur cible atteinte !");
+    if (!_capteurs.isDepthStale() && error < kDepthMargin) {
+        LOG_INFO("StateMachine", "Profondeur cible atteinte !");
         changeState(FishState::MOVING);
     }
 
     // Sécurité : Timeout de 30 secondes si on n'arrive jamais à descendre
-    if (getElapsedTime() > 30000) {
-        Serial.println("[StateMachine] TIMEOUT Descente -> Force Moving");
+    if (getElapsedTime() > _descentTimeout) {
+        LOG_ALERTE("StateMachine", "TIMEOUT Descente -> Force Moving");
         changeState(FishState::MOVING);
     }
 }
 
 void StateMachine::updateMoving()
 {
-    if (getElapsedTime() < kEntryWindowMs) {
-        Serial.println("[StateMachine] AVANCEMENT démarré");
-        _motor.setServoAngle(90.0f); // Optionnel car l'asserv va reprendre la main
+    if (entreeEtat()) {
+        LOG_INFO("StateMachine", "AVANCEMENT démarré");
         _motor.setDriverCommand(kMoveSpeed);
     }
 
@@ -143,16 +145,15 @@ void StateMachine::updateMoving()
     _asserv.setProfondeurVoulue(_targetDepth);
 
     if (getElapsedTime() >= _moveDuration) {
-        Serial.println("[StateMachine] Fin de l'avancement");
+        LOG_INFO("StateMachine", "Fin de l'avancement");
         changeState(FishState::TURNING);
     }
 }
 
 void StateMachine::updateTurning()
 {
-    if (getElapsedTime() < kEntryWindowMs) {
-        Serial.println("[StateMachine] DEMI-TOUR démarré");
-        _motor.setServoAngle(65.0f); // Optionnel car l'asserv va reprendre la main
+    if (entreeEtat()) {
+        LOG_INFO("StateMachine", "DEMI-TOUR démarré");
         _motor.setDriverCommand(kTurnSpeed);
     }
 
@@ -160,56 +161,61 @@ void StateMachine::updateTurning()
     _asserv.setProfondeurVoulue(_targetDepth);
 
     if (getElapsedTime() >= _turnDuration) {
-        Serial.println("[StateMachine] Demi-tour terminé");
+        LOG_INFO("StateMachine", "Demi-tour terminé");
         changeState(FishState::ASCENDING);
     }
 }
 
 void StateMachine::updateAscending()
 {
-    if (getElapsedTime() < kEntryWindowMs) {
-        Serial.println("[StateMachine] REMONTÉE en cours...");
+    if (entreeEtat()) {
+        LOG_INFO("StateMachine", "REMONTÉE en cours...");
         // Pour remonter, on vide le ballast à fond (sécurité max)
         // On pourrait utiliser l'asserv avec setProfondeurVoulue(0.0), 
         // mais ballastVider est plus sûr pour garantir la flottaison.
         _motor.ballastVider();
     }
 
-    // VÉRIFICATION : Est-on en surface ?
+    // VÉRIFICATION : Est-on en surface ? (une valeur figée ne compte pas)
     float currentDepth = _capteurs.getDepthData().depth_m;
 
-    if (currentDepth < kSurfaceDepth) { // Si on est à moins de 20cm de la surface
-        Serial.println("[StateMachine] Surface atteinte (Capteur) !");
+    if (!_capteurs.isDepthStale() && currentDepth < kSurfaceDepth) { // Si on est à moins de 20cm de la surface
+        LOG_INFO("StateMachine", "Surface atteinte (Capteur) !");
         changeState(FishState::COMPLETED);
     }
     
     // Sécurité temps (si le capteur déconne)
-    if (getElapsedTime() > 15000) {
-        Serial.println("[StateMachine] Surface atteinte (Timeout) !");
+    if (getElapsedTime() > _ascentTimeout) {
+        LOG_ALERTE("StateMachine", "Surface atteinte (Timeout) !");
         changeState(FishState::COMPLETED);
     }
 }
 
 void StateMachine::updateEmergency()
 {
-    if (getElapsedTime() < kEntryWindowMs) {
-        Serial.println("[StateMachine] === EMERGENCY ===");
+    if (entreeEtat()) {
+        LOG_ALERTE("StateMachine", "=== EMERGENCY ===");
         if (_emergency == EmergencyState::LEAK) {
-            Serial.println("[StateMachine] Cause: LEAK");
+            LOG_ALERTE("StateMachine", "Cause: LEAK");
         } else if (_emergency == EmergencyState::BATTERY) {
-            Serial.println("[StateMachine] Cause: LOW BATTERY");
+            LOG_ALERTE("StateMachine", "Cause: LOW BATTERY");
+        } else if (_emergency == EmergencyState::OVERCURRENT) {
+            LOG_ALERTE("StateMachine", "Cause: OVERCURRENT");
         }
+
+        // Même réaction que le failsafe fuite (déjà faite si c'est lui) :
+        // ballast vidé hors limiteur et verrouillé, plus rien ne le remplit
+        _motor.coupureUrgence();
     }
 
-    _motor.ballastVider();
-    _motor.setServoAngle(90.0f);
+    // La propulsion reste coupée même si une commande manuelle arrive
     _motor.setDriverCommand(0.0f);
 }
 
 void StateMachine::updateCompleted()
 {
-    if (getElapsedTime() < kEntryWindowMs) {
-        Serial.println("[StateMachine] === MISSION TERMINÉE ===");
+    if (entreeEtat()) {
+        LOG_INFO("StateMachine", "=== MISSION TERMINÉE ===");
         _motor.setDriverCommand(0.0f);
         _motor.setServoAngle(90.0f);
     }
@@ -225,25 +231,42 @@ void StateMachine::changeState(FishState newState)
 {
     printStateChange(newState);
     _currentState = newState;
-    _stateStartTime = millis();
+    _stateStartTime = horloge_ms();
+    _entree = true;
+
+    // Hors tenue de profondeur : le PID repartira de l'angle servo courant
+    if (newState != FishState::DESCENDING && newState != FishState::MOVING &&
+        newState != FishState::TURNING) {
+        _asserv.arrete();
+    }
+}
+
+// Vrai une seule fois par entrée dans un état, au premier passage qui le
+// demande : les actions d'entrée ne dépendent pas de la cadence d'update()
+bool StateMachine::entreeEtat()
+{
+    bool entree = _entree;
+    _entree = false;
+    return entree;
 }
 
 unsigned long StateMachine::getElapsedTime() const
 {
-    return millis() - _stateStartTime;
+    return horloge_ms() - _stateStartTime;
 }
 
 void StateMachine::printStateChange(FishState newState)
 {
-    Serial.print("[StateMachine] Transition → ");
+    const char* nom = "?";
     switch (newState)
     {
-        case FishState::IDLE:       Serial.println("IDLE"); break;
-        case FishState::DESCENDING: Serial.println("DESCENDING"); break;
-        case FishState::MOVING:     Serial.println("MOVING"); break;
-        case FishState::TURNING:    Serial.println("TURNING"); break;
-        case FishState::ASCENDING:  Serial.println("ASCENDING"); break;
-        case FishState::COMPLETED:  Serial.println("COMPLETED"); break;
-        case FishState::EMERGENCY:  Serial.println("EMERGENCY"); break;
-    }
-}
\ No newline at end of file
+        case FishState::IDLE:       nom = "IDLE"; break;
+        case FishState::DESCENDING: nom = "DESCENDING"; break;
+        case FishState::MOVING:     nom = "MOVING"; break;
+        case FishState::TURNING:    nom = "TURNING"; break;
+        case FishState::ASCENDING:  nom = "ASCENDING"; break;
+        case FishState::COMPLETED:  nom = "COMPLETED"; break;
+        case FishState::EMERGENCY:  nom = "EMERGENCY"; break;
+    }
+    LOG_INFO("StateMachine", "Transition → %s", nom);
+}
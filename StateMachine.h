@@ -46,6 +46,13 @@ public:
   void setTargetDepth(float depth) { _targetDepth = depth; }
   void setMoveDuration(unsigned long durationMs) { _moveDuration = durationMs; }
   void setTurnDuration(unsigned long durationMs) { _turnDuration = durationMs; }
+  void setDescentTimeout(unsigned long timeoutMs) { _descentTimeout = timeoutMs; }
+  void setAscentTimeout(unsigned long timeoutMs)  { _ascentTimeout = timeoutMs; }
+
+  float getTargetDepth() const { return _targetDepth; }
+
+  // Réglage de l'asservissement (gains, neutre)
+  AsservProfond& asserv() { return _asserv; }
 
 private:
   CommandMotor& _motor;
@@ -57,14 +64,18 @@ private:
   bool _isRunning = false;
 
   unsigned long _stateStartTime = 0;
+  bool _entree = false;   // actions d'entrée de l'état courant pas encore faites
 
   float _targetDepth = 1.0f;
   unsigned long _moveDuration = 10000;
   unsigned long _turnDuration = 3000;
+  unsigned long _descentTimeout = 30000;
+  unsigned long _ascentTimeout  = 15000;
 
   EmergencyState _emergency = EmergencyState::NONE;
 
   void changeState(FishState newState);
+  bool entreeEtat();
 
   void updateIdle();
   void updateDescending();
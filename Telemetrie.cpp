@@ -0,0 +1,122 @@
+#include "Telemetrie.h"
+#include "Horloge.h"
+
+static const uint16_t kPeriodeDefautMs = 200;   // 5 Hz
+
+static inline int16_t satI16(float v)
+{
+    if (v >  32767.0f) return  32767;
+    if (v < -32768.0f) return -32768;
+    return (int16_t)(v < 0.0f ? v - 0.5f : v + 0.5f);
+}
+
+static inline uint16_t satU16(float v)
+{
+    if (v < 0.0f)      return 0;
+    if (v > 65535.0f)  return 65535;
+    return (uint16_t)(v + 0.5f);
+}
+
+Telemetrie::Telemetrie()
+: _tete(0)
+, _count(0)
+, _total(0)
+, _periode_ms(kPeriodeDefautMs)
+, _prochain_ms(0)
+{
+}
+
+void Telemetrie::clear()
+{
+    _tete  = 0;
+    _count = 0;
+}
+
+void Telemetrie::update(const Capteurs& capteurs, const CommandMotor& motor, const StateMachine& sm)
+{
+    uint32_t now = horloge_ms();
+    if ((int32_t)(now - _prochain_ms) < 0) return;
+
+    _prochain_ms += _periode_ms;
+    if ((int32_t)(now - _prochain_ms) >= 0) _prochain_ms = now + _periode_ms;
+
+    const CapteursData& d = capteurs.snapshot();
+    TelemetrieRecord& r = _records[_tete];
+
+    r.t_ds        = (uint16_t)(now / 100);
+    r.depth_mm    = satI16(d.depth.depth_m * 1000.0f);
+    r.yaw_dd      = satI16(d.imu.yaw * 10.0f);
+    r.pitch_dd    = satI16(d.imu.pitch * 10.0f);
+    r.roll_dd     = satI16(d.imu.roll * 10.0f);
+    r.vbat_mV     = satU16(d.power.busVoltage_V * 1000.0f);
+    r.ibat_mA     = satI16(d.power.current_mA);
+    r.ballast_deg = (uint8_t)(motor.getServoAngle() + 0.5f);
+    r.pwm         = motor.getDriverPwm();
+    r.direction   = motor.getEtatDirection();
+    r.etat        = ((uint8_t)sm.getCurrentState() & 0x0F) |
+                    (((uint8_t)sm.getEmergency() & 0x0F) << 4);
+
+    _tete = (_tete + 1) % CAPACITE;
+    if (_count < CAPACITE) _count++;
+    _total++;
+}
+
+const TelemetrieRecord* Telemetrie::segment(uint32_t index, uint32_t fin, uint16_t& n) const
+{
+    n = 0;
+    if ((int32_t)(fin - index) <= 0 || (int32_t)(_total - index) <= 0) return nullptr;
+
+    // Recul depuis la tête : 1 = dernier écrit
+    uint16_t recul = (uint16_t)((_total - index) % CAPACITE);
+    uint16_t idx   = (_tete + CAPACITE - recul) % CAPACITE;
+
+    uint32_t restant  = fin - index;
+    uint16_t jusquFin = CAPACITE - idx;
+    n = (restant < jusquFin) ? (uint16_t)restant : jusquFin;
+
+    return &_records[idx];
+}
+
+void Telemetrie::fillEntete(TelemetrieEntete& h) const
+{
+    memcpy(h.magic, "PTLM", 4);
+    h.version       = VERSION;
+    h.tailleRecord  = sizeof(TelemetrieRecord);
+    h.count         = _count;
+    h.periode_ms    = _periode_ms;
+    h.maintenant_ms = horloge_ms();
+}
+
+// =====================
+//   Trame binaire /data.bin
+// =====================
+
+void remplitTrameData(TrameData& t, const CapteursData& d, bool autonome)
+{
+    t.version = TRAME_DATA_VERSION;
+    t.flags   = (d.leak.leakNow     ? TRAME_FLAG_LEAK     : 0) |
+                (d.leak.leakLatched ? TRAME_FLAG_LEAK_MEM : 0) |
+                (autonome           ? TRAME_FLAG_AUTO     : 0);
+
+    t.depth_mm = satI16(d.depth.depth_m * 1000.0f);
+    t.frameId  = d.frameId;
+    t.t_ms     = d.t_ms;
+
+    t.yaw_dd   = satI16(d.imu.yaw   * 10.0f);
+    t.pitch_dd = satI16(d.imu.pitch * 10.0f);
+    t.roll_dd  = satI16(d.imu.roll  * 10.0f);
+
+    t.ax_cms2 = satI16(d.imu.ax * 100.0f);
+    t.ay_cms2 = satI16(d.imu.ay * 100.0f);
+    t.az_cms2 = satI16(d.imu.az * 100.0f);
+
+    t.gx_mrad = satI16(d.imu.gx * 1000.0f);
+    t.gy_mrad = satI16(d.imu.gy * 1000.0f);
+    t.gz_mrad = satI16(d.imu.gz * 1000.0f);
+
+    t.vbat_mV = satU16(d.power.busVoltage_V * 1000.0f);
+    t.ibat_mA = satI16(d.power.current_mA);
+
+    uint32_t age = ageEchantillon_ms(d.depth.t_ms, horloge_ms());
+    t.depthAge_ms = (age > 65535UL) ? 65535 : (uint16_t)age;
+}
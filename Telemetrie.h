@@ -0,0 +1,120 @@
+#ifndef TELEMETRIE_H
+#define TELEMETRIE_H
+
+#include <Arduino.h>
+#include "Capteurs.h"
+#include "CommandMotor.h"
+#include "StateMachine.h"
+
+// =====================
+//   Historique de télémétrie en RAM
+// =====================
+//
+// Anneau de taille fixe (aucune allocation dynamique) d'enregistrements
+// compacts en virgule fixe, rempli à cadence réglable depuis la tâche
+// capteurs. Sert de boîte noire : /log renvoie tout l'anneau.
+//
+// 512 x 18 octets = 9 Ko, soit ~100 s à 5 Hz (la RAM du SAMD21 est de 32 Ko).
+
+#ifndef TELEMETRIE_CAPACITE
+#define TELEMETRIE_CAPACITE 512
+#endif
+
+struct __attribute__((packed)) TelemetrieRecord
+{
+    uint16_t t_ds;        // temps depuis le boot en 1/10 s (reboucle après ~109 min)
+    int16_t  depth_mm;
+    int16_t  yaw_dd;      // 1/10 degré
+    int16_t  pitch_dd;
+    int16_t  roll_dd;
+    uint16_t vbat_mV;
+    int16_t  ibat_mA;
+    uint8_t  ballast_deg; // consigne servo ballast
+    uint8_t  pwm;         // propulsion 0-255
+    int8_t   direction;   // -1 gauche, 0 centre, 1 droite
+    uint8_t  etat;        // bits 0-3 : FishState, bits 4-7 : EmergencyState
+};
+
+// En-tête envoyé avant les enregistrements par /log (little-endian)
+struct __attribute__((packed)) TelemetrieEntete
+{
+    char     magic[4];    // "PTLM"
+    uint8_t  version;
+    uint8_t  tailleRecord;
+    uint16_t count;
+    uint16_t periode_ms;
+    uint32_t maintenant_ms;  // pour dérouler t_ds côté PC
+};
+
+// =====================
+//   Trame binaire /data.bin (little-endian, virgule fixe)
+// =====================
+//
+// Même contenu que /data en JSON, 36 octets au lieu de ~300, sans
+// conversion float -> texte. Décodée par le JavaScript de la page.
+
+struct __attribute__((packed)) TrameData
+{
+    uint8_t  version;     // TRAME_DATA_VERSION
+    uint8_t  flags;       // TRAME_FLAG_*
+    int16_t  depth_mm;
+    uint32_t frameId;     // CapteursData::frameId
+    uint32_t t_ms;        // instant de publication de la trame capteurs
+    int16_t  yaw_dd, pitch_dd, roll_dd;   // 1/10 degré
+    int16_t  ax_cms2, ay_cms2, az_cms2;   // cm/s² (1/100 m/s²)
+    int16_t  gx_mrad, gy_mrad, gz_mrad;   // mrad/s
+    uint16_t vbat_mV;
+    int16_t  ibat_mA;
+    uint16_t depthAge_ms; // saturé à 65535 (jamais reçu / périmé)
+};
+
+static_assert(sizeof(TrameData) == 36, "TrameData : format fige, decode par la page web");
+
+static const uint8_t TRAME_DATA_VERSION  = 1;
+static const uint8_t TRAME_FLAG_LEAK     = 0x01;
+static const uint8_t TRAME_FLAG_LEAK_MEM = 0x02;
+static const uint8_t TRAME_FLAG_AUTO     = 0x04;
+
+void remplitTrameData(TrameData& t, const CapteursData& d, bool autonome);
+
+class Telemetrie
+{
+public:
+    static const uint16_t CAPACITE = TELEMETRIE_CAPACITE;
+    static const uint8_t  VERSION  = 1;
+
+    Telemetrie();
+
+    void     setPeriode(uint16_t periode_ms) { _periode_ms = periode_ms; }
+    uint16_t getPeriode() const { return _periode_ms; }
+
+    // Ajoute un enregistrement si la période est échue
+    void update(const Capteurs& capteurs, const CommandMotor& motor, const StateMachine& sm);
+
+    void clear();
+
+    uint16_t count() const { return _count; }
+    uint32_t total() const { return _total; }   // enregistrements écrits depuis le boot
+
+    // Index absolu (compté depuis le boot) du plus ancien enregistrement gardé
+    uint32_t premierIndex() const { return _total - _count; }
+
+    // Accès sans copie : pointeur sur le plus long segment contigu de
+    // [index, fin[ (index absolus). n reçoit sa longueur.
+    // Les index absolus restent stables pendant un envoi étalé sur plusieurs
+    // ticks ; un enregistrement écrasé entre-temps est lu à sa place (plus récent).
+    const TelemetrieRecord* segment(uint32_t index, uint32_t fin, uint16_t& n) const;
+
+    void fillEntete(TelemetrieEntete& h) const;
+
+private:
+    TelemetrieRecord _records[CAPACITE];
+    uint16_t _tete;      // prochain emplacement écrit
+    uint16_t _count;
+    uint32_t _total;
+
+    uint16_t _periode_ms;
+    uint32_t _prochain_ms;
+};
+
+#endif
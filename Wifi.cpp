@@ -1,56 +1,252 @@
 #include "Wifi.h"
+#include "PageWeb.h"
+#include "Journal.h"
+#include "Metriques.h"
 
 // --- CONFIGURATION ---
 // SSID et MDP de ton point d'accès Windows (D'après ton image)
 char ssid[] = "robot_poisson";
 char pass[] = "12345678";
 
-int status = WL_IDLE_STATUS;
+int status = WL_IDLE_STATUS;   // dernier WiFi.status() lu
 WiFiServer server(80);
 
+// Contexte passé aux routes (objets de la boucle principale)
+struct ContexteWeb {
+  Controller &ctrl;
+  Capteurs   &caps;
+  Telemetrie &telem;
+};
+
+// --- CONNEXIONS ---
+// Chaque client a sa machine d'états, avancée d'un pas par passage :
+// LECTURE (requête lue au fil de l'eau) -> aiguillage -> ENVOI (un morceau
+// par passage) -> fermeture. FLUX : connexion /stream gardée ouverte.
+enum class EtatConnexion : uint8_t { LIBRE, LECTURE, ENVOI, FLUX };
+
+static const uint8_t  kMaxConnexions   = 4;
+static const uint8_t  kMaxFlux         = 2;     // parmi les connexions
+static const uint16_t kTailleEntete    = 256;   // en-tête HTTP (+ en-tête binaire /log)
+static const uint16_t kTailleMorceau   = 512;   // octets écrits par passage
+static const uint8_t  kOctetsLecture   = 64;    // octets lus par passage
+static const uint32_t kDelaiLecture_ms = 2000;  // requête incomplète -> 408
+static const uint16_t kTailleReponseJson = 512;  // /data : en-têtes + JSON, sur la pile
+
+struct Connexion {
+  WiFiClient    client;
+  EtatConnexion etat;
+  RequeteHttp   req;
+  uint32_t      debut_ms;
+
+  // Réponse découpée : en-tête, puis corps contigu (flash) ou anneau /log
+  char           entete[kTailleEntete];
+  uint16_t       enteteLen;
+  uint16_t       enteteEnvoye;
+  const uint8_t *corps;
+  uint32_t       corpsRestant;
+  uint32_t       logIndex;        // index absolus dans l'anneau de télémétrie
+  uint32_t       logFin;
+  uint16_t       logOctet;        // octets déjà envoyés de l'enregistrement logIndex
+};
+
+static Connexion connexions[kMaxConnexions];
+static uint8_t   prochaineConnexion = 0;
+
+// Route : écrit une réponse courte directement, ou prépare un ENVOI
+// découpé / passe en FLUX ; sinon la connexion est fermée après l'appel.
+typedef void (*RouteWeb)(Connexion &cnx, ContexteWeb &ctx);
+
+struct Route {
+  const char *chemin;
+  RouteWeb    fn;
+};
+
 // Prototypes privés
-void envoiePageWeb(WiFiClient &client);
-void envoieDonneesJSON(WiFiClient &client, Controller &ctrl, Capteurs &caps);
-void traiterCommande(String req, Controller &ctrl);
+void envoiePageWeb(Connexion &cnx, ContexteWeb &ctx);
+void envoieDonneesJSON(Connexion &cnx, ContexteWeb &ctx);
+void traiterCommande(Connexion &cnx, ContexteWeb &ctx);
+void envoieHistorique(Connexion &cnx, ContexteWeb &ctx);
+void envoieDonneesBinaires(Connexion &cnx, ContexteWeb &ctx);
+void ouvreFlux(Connexion &cnx, ContexteWeb &ctx);
+void envoieMetriques(Connexion &cnx, ContexteWeb &ctx);
+void regleAsserv(Connexion &cnx, ContexteWeb &ctx);
+void pousseFlux(ContexteWeb &ctx);
+void envoieErreur(WiFiClient &client, uint16_t code);
+
+static void accepteConnexion();
+static void serviceConnexion(Connexion &cnx, ContexteWeb &ctx);
+static void lisRequete(Connexion &cnx, ContexteWeb &ctx);
+static void aiguille(Connexion &cnx, ContexteWeb &ctx);
+static void envoieMorceau(Connexion &cnx, ContexteWeb &ctx);
+static void fermeConnexion(Connexion &cnx);
+static void fermeToutesConnexions();
+
+// Table de routage : chemin exact (sans query)
+static const Route routes[] = {
+  { "/",           envoiePageWeb },
+  { "/index.html", envoiePageWeb },
+  { "/data",       envoieDonneesJSON },
+  { "/data.bin",   envoieDonneesBinaires },
+  { "/stream",     ouvreFlux },
+  { "/log",        envoieHistorique },
+  { "/cmd",        traiterCommande },
+  { "/metrics",    envoieMetriques },
+  { "/pid",        regleAsserv },
+};
+
+// --- FLUX /stream (Server-Sent Events) ---
+// Une trame TrameData en base64 par évènement
+static uint16_t   periodeFlux_ms = 50;   // 20 Hz
+static uint32_t   prochainFlux_ms = 0;
+static uint32_t   dernierFrameFlux = 0;
+
+// Temps de service de /data (snapshot + JSON + écriture), voir printStatsWeb
+static StatTemps tempsServiceData;
+
+// /metrics : trop gros pour la pile, construit ici puis envoyé par morceaux
+static const uint16_t kTailleMetriques = 4096;
+static char tamponMetriques[kTailleMetriques];
 
 // ============================================================
-//   INITIALISATION WIFI (MODE STATION / CLIENT)
+//   CONNEXION WIFI (MODE STATION / CLIENT), NON BLOQUANTE
 // ============================================================
+// setupWifi() ne fait que lancer la machine d'états ; updateWifi() l'avance
+// d'un pas (un appel à WiFi.status() au plus, quelques centaines de µs).
+// Le poisson démarre sans réseau si le point d'accès PC est absent.
+//
+//   IDLE -> CONNEXION -> CONNECTE -> PERDU -> ATTENTE -> CONNEXION ...
+//   ABSENT : pas de module NINA, le reste du robot tourne sans réseau.
+
+static const uint32_t kPasConnexion_ms     = 250;    // scrutation pendant la connexion
+static const uint32_t kPasSurveillance_ms  = 1000;   // scrutation une fois connecté
+static const uint32_t kDelaiConnexion_ms   = 15000;  // tentative abandonnée
+static const uint32_t kAttenteMin_ms       = 1000;   // puis attente doublée à chaque échec
+static const uint32_t kAttenteMax_ms       = 30000;
+
+static EtatWifi  etatWifiCourant  = EtatWifi::IDLE;
+static uint32_t  debutEtat_ms     = 0;
+static uint32_t  prochainPas_ms   = 0;
+static uint32_t  attente_ms       = kAttenteMin_ms;
+static uint32_t  nbConnexions     = 0;
+static void    (*surConnexion)()  = nullptr;
+static void    (*surPerte)()      = nullptr;
+
+static void changeEtatWifi(EtatWifi e, uint32_t now) {
+  etatWifiCourant = e;
+  debutEtat_ms    = now;
+  prochainPas_ms  = now;
+}
+
+static void lanceConnexion(uint32_t now) {
+  LOG_INFO("Wifi", "Connexion au point d'acces PC : %s", ssid);
+
+  // Timeout 0 : begin() envoie la demande au module et rend la main
+  // tout de suite, l'attente se fait par scrutation dans updateWifi()
+  WiFi.setTimeout(0);
+  WiFi.begin(ssid, pass);
+  changeEtatWifi(EtatWifi::CONNEXION, now);
+}
+
+void setCallbacksWifi(void (*connexion)(), void (*perte)()) {
+  surConnexion = connexion;
+  surPerte     = perte;
+}
+
 void setupWifi() {
   // Vérif module WiFi
-  if (WiFi.status() == WL_NO_MODULE) {
-    Serial.println("[Wifi] Module absent!");
-    while (true) delay(1000);
+  status = WiFi.status();
+  if (status == WL_NO_MODULE) {
+    LOG_ERREUR("Wifi", "Module absent ! Demarrage sans reseau.");
+    changeEtatWifi(EtatWifi::ABSENT, millis());
+    return;
   }
 
-  Serial.print("[Wifi] Connexion au point d'acces PC : ");
-  Serial.println(ssid);
-
-  // --- MODIFICATION ICI : Connexion au lieu de création ---
-  WiFi.begin(ssid, pass);
+  lanceConnexion(millis());
+}
 
-  // Boucle d'attente de connexion
-  int tentatives = 0;
-  while (WiFi.status() != WL_CONNECTED) {
-    delay(500);
-    Serial.print(".");
-    tentatives++;
-    
-    // Si ça galère trop, petit message (mais on continue d'essayer)
-    if (tentatives > 40) { // 20 secondes
-        Serial.println("\n[Wifi] Connexion lente... Verifiez le Hotspot Windows !");
-        tentatives = 0;
-    }
+void updateWifi() {
+  uint32_t now = millis();
+  if ((int32_t)(now - prochainPas_ms) < 0) return;
+
+  switch (etatWifiCourant) {
+    case EtatWifi::ABSENT:
+      prochainPas_ms = now + 0x7FFFFFFFUL;   // plus rien à faire
+      break;
+
+    case EtatWifi::IDLE:
+      lanceConnexion(now);
+      break;
+
+    case EtatWifi::CONNEXION:
+      status = WiFi.status();
+      if (status == WL_CONNECTED) {
+        changeEtatWifi(EtatWifi::CONNECTE, now);
+        attente_ms = kAttenteMin_ms;
+        nbConnexions++;
+
+        server.begin();
+        IPAddress ip = WiFi.localIP();
+        LOG_INFO("Wifi", "CONNECTE au PC ! GO TO: http://%u.%u.%u.%u",
+                 ip[0], ip[1], ip[2], ip[3]);
+        if (surConnexion) surConnexion();
+      }
+      else if (now - debutEtat_ms > kDelaiConnexion_ms || status == WL_CONNECT_FAILED) {
+        LOG_ALERTE("Wifi", "Echec connexion... Verifiez le Hotspot Windows !");
+        WiFi.disconnect();
+        changeEtatWifi(EtatWifi::ATTENTE, now);
+      }
+      else {
+        prochainPas_ms = now + kPasConnexion_ms;
+      }
+      break;
+
+    case EtatWifi::CONNECTE:
+      status = WiFi.status();
+      if (status != WL_CONNECTED) {
+        LOG_ALERTE("Wifi", "Liaison perdue");
+        changeEtatWifi(EtatWifi::PERDU, now);
+      } else {
+        prochainPas_ms = now + kPasSurveillance_ms;
+      }
+      break;
+
+    case EtatWifi::PERDU:
+      // Sockets morts avec la liaison : on libère tout avant de reconnecter
+      fermeToutesConnexions();
+      if (surPerte) surPerte();
+      WiFi.disconnect();
+      attente_ms = kAttenteMin_ms;
+      changeEtatWifi(EtatWifi::ATTENTE, now);
+      break;
+
+    case EtatWifi::ATTENTE:
+      if (now - debutEtat_ms < attente_ms) {
+        prochainPas_ms = debutEtat_ms + attente_ms;
+        break;
+      }
+      attente_ms = (attente_ms * 2 > kAttenteMax_ms) ? kAttenteMax_ms : attente_ms * 2;
+      lanceConnexion(now);
+      break;
   }
+}
 
-  Serial.println("");
-  Serial.println("[Wifi] CONNECTE au PC !");
+EtatWifi etatWifi() {
+  return etatWifiCourant;
+}
 
-  server.begin();
-  printWifiStatus();
+bool wifiConnecte() {
+  return etatWifiCourant == EtatWifi::CONNECTE;
+}
+
+void printStatsWeb() {
+  Serial.print("[Wifi] /data service(us) ");
+  tempsServiceData.print(Serial);
+  tempsServiceData.reset();
 }
 
 void printWifiStatus() {
+  Serial.print("[Wifi] connexions depuis le boot: ");
+  Serial.println(nbConnexions);
   Serial.print("SSID: ");
   Serial.println(WiFi.SSID());
 
@@ -64,222 +260,534 @@ void printWifiStatus() {
 // ============================================================
 //   BOUCLE PRINCIPALE DU WIFI
 // ============================================================
-void gestionServeurWeb(Controller &ctrl, Capteurs &caps) {
+// Un appel = un passage borné : nouvelle connexion éventuelle, poussée des
+// flux, puis un pas par connexion active (tourniquet) tant que le budget
+// le permet. Le premier pas est toujours fait pour garantir l'avancement ;
+// le dépassement est borné par un morceau (kTailleMorceau / kOctetsLecture).
+void gestionServeurWeb(Controller &ctrl, Capteurs &caps, Telemetrie &telem, uint32_t budget_us) {
+  if (!wifiConnecte()) return;
+
+  uint32_t debut = micros();
+  ContexteWeb ctx = { ctrl, caps, telem };
+
+  pousseFlux(ctx);
+  accepteConnexion();
+
+  for (uint8_t n = 0; n < kMaxConnexions; n++) {
+    if (n > 0 && micros() - debut >= budget_us) break;
+
+    uint8_t i = (prochaineConnexion + n) % kMaxConnexions;
+    if (connexions[i].etat == EtatConnexion::LIBRE) continue;
+
+    serviceConnexion(connexions[i], ctx);
+    prochaineConnexion = (i + 1) % kMaxConnexions;
+  }
+}
+
+static void accepteConnexion() {
   WiFiClient client = server.available();
-  
-  if (client) {
-    Serial.println("[Wifi] Client connecte");
-
-    String req = "";
-    
-    // Lecture de la première ligne de la requête
-    while (client.connected()) {
-      if (client.available()) {
-        char c = client.read();
-        req += c;
-        if (c == '\n') break; // on lit juste la ligne GET /... HTTP/1.1
-      }
+  if (!client) return;
+
+  // server.available() rend aussi les sockets déjà suivis qui ont des données
+  int8_t libre = -1;
+  for (uint8_t i = 0; i < kMaxConnexions; i++) {
+    if (connexions[i].etat == EtatConnexion::LIBRE) {
+      if (libre < 0) libre = i;
     }
+    else if (connexions[i].client == client) {
+      return;
+    }
+  }
 
-    Serial.print("[Wifi] Requete: ");
-    Serial.println(req);
+  if (libre < 0) {
+    envoieErreur(client, 503);
+    client.stop();
+    return;
+  }
 
+  Connexion &cnx = connexions[libre];
+  cnx.client   = client;
+  cnx.etat     = EtatConnexion::LECTURE;
+  cnx.debut_ms = millis();
+  cnx.req.reset();
+}
+
+static void serviceConnexion(Connexion &cnx, ContexteWeb &ctx) {
+  switch (cnx.etat) {
+    case EtatConnexion::LECTURE: lisRequete(cnx, ctx);   break;
+    case EtatConnexion::ENVOI:   envoieMorceau(cnx, ctx); break;
+    case EtatConnexion::FLUX:
+      // Les poussées sont faites par pousseFlux, ici on ne détecte que la fermeture
+      if (!cnx.client.connected()) {
+        fermeConnexion(cnx);
+        LOG_INFO("Wifi", "Flux /stream ferme");
+      }
+      break;
+    default: break;
+  }
+}
+
+static void lisRequete(Connexion &cnx, ContexteWeb &ctx) {
+  int n = cnx.client.available();
+  if (n > kOctetsLecture) n = kOctetsLecture;
+
+  if (n > 0) {
+    uint8_t tampon[kOctetsLecture];
+    n = cnx.client.read(tampon, n);
+    for (int i = 0; i < n && !cnx.req.terminee(); i++) cnx.req.feed((char)tampon[i]);
+  }
+
+  if (cnx.req.terminee()) {
+    aiguille(cnx, ctx);
+    return;
+  }
+
+  if (!cnx.client.connected()) {
+    fermeConnexion(cnx);
+  }
+  else if (millis() - cnx.debut_ms > kDelaiLecture_ms) {
+    envoieErreur(cnx.client, 408);
+    fermeConnexion(cnx);
+  }
+}
+
+static void aiguille(Connexion &cnx, ContexteWeb &ctx) {
+  const RequeteHttp &req = cnx.req;
+
+  if (req.etat() == RequeteHttp::ERREUR) {
+    envoieErreur(cnx.client, req.codeErreur());
+  }
+  else if (!req.estMethode("GET")) {
+    envoieErreur(cnx.client, 405);
+  }
+  else {
     // --- AIGUILLAGE ---
-    if (req.indexOf("GET /data") >= 0) {
-      envoieDonneesJSON(client, ctrl, caps);
-    } 
-    else if (req.indexOf("GET /cmd") >= 0) {
-      Serial.println("[Wifi] Requete CMD detectee");
-      traiterCommande(req, ctrl);
-      client.println("HTTP/1.1 200 OK\r\nConnection: close\r\n\r\nOK");
+    const Route *route = nullptr;
+    for (uint8_t i = 0; i < sizeof(routes) / sizeof(routes[0]); i++) {
+      if (strcmp(req.chemin(), routes[i].chemin) == 0) { route = &routes[i]; break; }
     }
-    else {
-      Serial.println("[Wifi] Envoi page HTML");
-      envoiePageWeb(client);
+
+    if (route) route->fn(cnx, ctx);
+    else       envoieErreur(cnx.client, 404);
+  }
+
+  // Ni ENVOI ni FLUX demandé : réponse déjà écrite
+  if (cnx.etat == EtatConnexion::LECTURE) fermeConnexion(cnx);
+}
+
+// Prépare un ENVOI découpé : l'en-tête est déjà dans cnx.entete[0..enteteLen[
+static void prepareEnvoi(Connexion &cnx, const uint8_t *corps, uint32_t taille) {
+  cnx.enteteEnvoye = 0;
+  cnx.corps        = corps;
+  cnx.corpsRestant = taille;
+  cnx.logIndex     = 0;
+  cnx.logFin       = 0;
+  cnx.logOctet     = 0;
+  cnx.etat         = EtatConnexion::ENVOI;
+}
+
+static void envoieMorceau(Connexion &cnx, ContexteWeb &ctx) {
+  const uint8_t *p = nullptr;
+  uint32_t n = 0;
+
+  if (cnx.enteteEnvoye < cnx.enteteLen) {
+    p = (const uint8_t*)cnx.entete + cnx.enteteEnvoye;
+    n = cnx.enteteLen - cnx.enteteEnvoye;
+  }
+  else if (cnx.corpsRestant > 0) {
+    p = cnx.corps;
+    n = cnx.corpsRestant;
+  }
+  else if (cnx.logIndex != cnx.logFin) {
+    uint16_t nb = 0;
+    const TelemetrieRecord *seg = ctx.telem.segment(cnx.logIndex, cnx.logFin, nb);
+    if (seg) {
+      p = (const uint8_t*)seg + cnx.logOctet;
+      n = (uint32_t)nb * sizeof(TelemetrieRecord) - cnx.logOctet;
     }
+  }
 
-    while (client.available()) client.read(); 
-    client.stop();
-    Serial.println("[Wifi] Client deconnecte");
+  if (n == 0) {
+    fermeConnexion(cnx);
+    return;
+  }
+
+  if (n > kTailleMorceau) n = kTailleMorceau;
+  size_t ecrits = cnx.client.write(p, n);
+  if (ecrits == 0) {
+    // Client parti ou tampon du module plein de façon persistante
+    fermeConnexion(cnx);
+    return;
+  }
+
+  if (cnx.enteteEnvoye < cnx.enteteLen) {
+    cnx.enteteEnvoye += ecrits;
+  }
+  else if (cnx.corpsRestant > 0) {
+    cnx.corps        += ecrits;
+    cnx.corpsRestant -= ecrits;
   }
+  else {
+    uint32_t octets = cnx.logOctet + ecrits;
+    cnx.logIndex += octets / sizeof(TelemetrieRecord);
+    cnx.logOctet  = octets % sizeof(TelemetrieRecord);
+  }
+}
+
+static void fermeConnexion(Connexion &cnx) {
+  cnx.client.stop();
+  cnx.etat = EtatConnexion::LIBRE;
+}
+
+static void fermeToutesConnexions() {
+  for (uint8_t i = 0; i < kMaxConnexions; i++) {
+    if (connexions[i].etat != EtatConnexion::LIBRE) fermeConnexion(connexions[i]);
+  }
+}
+
+void envoieErreur(WiFiClient &client, uint16_t code) {
+  char tampon[96];
+  ReponseHttp rep(tampon, sizeof(tampon));
+  rep.statut(code);
+  rep.finEntetes();
+  rep.envoie(client);
 }
 
 
 // ============================================================
-//   TRAITEMENT COMMANDE
+//   TRAITEMENT COMMANDE /cmd?key=Z
 // ============================================================
-void traiterCommande(String req, Controller &ctrl) {
-  int idx = req.indexOf("key=");
-  if (idx == -1) return;
-  
-  char key = req.charAt(idx + 4); // caractère après "key="
+void traiterCommande(Connexion &cnx, ContexteWeb &ctx) {
+  WiFiClient &client = cnx.client;
+  char key;
+  if (!cnx.req.parametreChar("key", key)) {
+    envoieErreur(client, 400);
+    return;
+  }
   key = toupper(key);
 
-  Serial.print("[Wifi] Commande reçue: ");
-  Serial.println(key);
+  ctx.ctrl.onKey(key);
 
-  ctrl.onKey(key); 
+  char tampon[64];
+  ReponseHttp rep(tampon, sizeof(tampon));
+  rep.statut(200);
+  rep.finEntetes();
+  rep.ajoute("OK");
+  rep.envoie(client);
 }
 
 
 
+// ============================================================
+//   REGLAGE PID /pid?kp=30&ki=10&kd=90&tf=0.2
+// ============================================================
+// Paramètres absents : inchangés. Sans paramètre : lecture seule.
+static AsservProfond *asservWeb = nullptr;
+
+void setAsservWeb(AsservProfond *asserv) {
+  asservWeb = asserv;
+}
+
+void regleAsserv(Connexion &cnx, ContexteWeb &ctx) {
+  if (!asservWeb) {
+    envoieErreur(cnx.client, 503);
+    return;
+  }
+
+  float kp = asservWeb->getKp();
+  float ki = asservWeb->getKi();
+  float kd = asservWeb->getKd();
+  float tf = asservWeb->getFiltreDerivee();
+
+  bool modifie = false;
+  modifie |= cnx.req.parametreDecimal("kp", kp);
+  modifie |= cnx.req.parametreDecimal("ki", ki);
+  modifie |= cnx.req.parametreDecimal("kd", kd);
+  modifie |= cnx.req.parametreDecimal("tf", tf);
+
+  if (kp < 0.0f || ki < 0.0f || kd < 0.0f || tf < 0.0f) {
+    envoieErreur(cnx.client, 400);
+    return;
+  }
+
+  if (modifie) {
+    asservWeb->setGains(kp, ki, kd);
+    asservWeb->setFiltreDerivee(tf);
+    LOG_INFO("Asserv", "Gains kp=%ld ki=%ld kd=%ld (milliemes) tf=%ld ms",
+             (long)(kp * 1000.0f), (long)(ki * 1000.0f), (long)(kd * 1000.0f),
+             (long)(tf * 1000.0f));
+  }
+
+  char tampon[192];
+  ReponseHttp rep(tampon, sizeof(tampon));
+  rep.statut(200);
+  rep.entete("Content-Type", "application/json");
+  rep.finEntetes();
+  rep.ajoute('{');
+  rep.cleJson("kp"); rep.ajouteFixe(asservWeb->getKp(), 3);
+  rep.cleJson("ki"); rep.ajouteFixe(asservWeb->getKi(), 3);
+  rep.cleJson("kd"); rep.ajouteFixe(asservWeb->getKd(), 3);
+  rep.cleJson("tf"); rep.ajouteFixe(asservWeb->getFiltreDerivee(), 3);
+  rep.cleJson("i");  rep.ajouteFixe(asservWeb->getIntegrale(), 2);
+  rep.ajoute('}');
+  rep.envoie(cnx.client);
+}
+
 // ============================================================
 //   REPONSE JSON /data
 // ============================================================
-void envoieDonneesJSON(WiFiClient &client, Controller &ctrl, Capteurs &caps) {
-  client.println("HTTP/1.1 200 OK");
-  client.println("Content-Type: application/json");
-  client.println("Connection: close");
-  client.println();
-
-  // Récupération des données via les méthodes publiques
-  const IMUData& imu   = caps.getIMUData();
-  const PowerData& pwr = caps.getPowerData();
-  const DepthData& depth = caps.getDepthData();
-  const LeakData& leak = caps.getLeakData();
+void envoieDonneesJSON(Connexion &cnx, ContexteWeb &ctx) {
+  uint32_t debut = micros();
+  Controller &ctrl = ctx.ctrl;
+  Capteurs   &caps = ctx.caps;
+
+  // Une copie cohérente : l'envoi peut durer plus d'un tick capteurs
+  CapteursData snap;
+  caps.getSnapshot(snap);
+
+  const IMUData& imu     = snap.imu;
+  const PowerData& pwr   = snap.power;
+  const DepthData& depth = snap.depth;
+  const LeakData& leak   = snap.leak;
+
+  char tampon[kTailleReponseJson];
+  ReponseHttp rep(tampon, sizeof(tampon));
+  rep.statut(200);
+  rep.entete("Content-Type", "application/json");
+  rep.finEntetes();
 
   // Construction JSON
-  client.print("{");
-  
+  rep.ajoute('{');
+
+  // Trame et fraîcheur de la profondeur (ms, -1 si jamais reçue)
+  uint32_t agePro = ageEchantillon_ms(depth.t_ms, millis());
+  rep.cleJson("frame"); rep.ajouteNaturel(snap.frameId);
+  rep.cleJson("pAge");  rep.ajouteEntier(agePro == 0xFFFFFFFFUL ? -1L : (int32_t)agePro);
+
   // IMU
-  client.print("\"yaw\":"); client.print(imu.yaw);   client.print(",");
-  client.print("\"pit\":"); client.print(imu.pitch); client.print(",");
-  client.print("\"rol\":"); client.print(imu.roll);  client.print(",");
-  client.print("\"ax\":");  client.print(imu.ax);    client.print(",");
-  client.print("\"ay\":");  client.print(imu.ay);    client.print(",");
-  client.print("\"az\":");  client.print(imu.az);    client.print(",");
-  client.print("\"gx\":");  client.print(imu.gx);    client.print(",");
-  client.print("\"gy\":");  client.print(imu.gy);    client.print(",");
-  client.print("\"gz\":");  client.print(imu.gz);    client.print(",");
+  rep.cleJson("yaw"); rep.ajouteFixe(imu.yaw);
+  rep.cleJson("pit"); rep.ajouteFixe(imu.pitch);
+  rep.cleJson("rol"); rep.ajouteFixe(imu.roll);
+  rep.cleJson("ax");  rep.ajouteFixe(imu.ax);
+  rep.cleJson("ay");  rep.ajouteFixe(imu.ay);
+  rep.cleJson("az");  rep.ajouteFixe(imu.az);
+  rep.cleJson("gx");  rep.ajouteFixe(imu.gx);
+  rep.cleJson("gy");  rep.ajouteFixe(imu.gy);
+  rep.cleJson("gz");  rep.ajouteFixe(imu.gz);
 
   // Power & Environment
-  client.print("\"v\":");   client.print(pwr.busVoltage_V);      client.print(",");
-  client.print("\"p\":");   client.print(depth.depth_m);         client.print(","); // Profondeur
-  
+  rep.cleJson("v");   rep.ajouteFixe(pwr.busVoltage_V);
+  rep.cleJson("p");   rep.ajouteFixe(depth.depth_m);      // Profondeur
+  rep.cleJson("pf");  rep.ajouteFixe(depth.profondeurFiltree_m, 3);   // estimée
+  rep.cleJson("vz");  rep.ajouteFixe(depth.vitesseVerticale_mps, 3);
+
   // ICI : On garde la version corrigée qui utilise leakLatched (compatible compilation)
-  client.print("\"leak\":");        client.print(leak.leakLatched ? "true" : "false"); client.print(",");
-  client.print("\"leakLatched\":"); client.print(leak.leakLatched ? "true" : "false"); client.print(",");
+  rep.cleJson("leak");        rep.ajouteBool(leak.leakLatched);
+  rep.cleJson("leakLatched"); rep.ajouteBool(leak.leakLatched);
 
   // État du controleur
-  client.print("\"auto\":"); 
-  client.print(ctrl.mode() == ControlMode::AUTONOMOUS ? "true" : "false");
-  
-  client.print("}");
+  rep.cleJson("auto"); rep.ajouteBool(ctrl.mode() == ControlMode::AUTONOMOUS);
+
+  rep.ajoute('}');
+  rep.envoie(cnx.client);
+
+  tempsServiceData.ajoute(micros() - debut);
+}
+
+// ============================================================
+//   REPONSE BINAIRE /data.bin
+// ============================================================
+void envoieDonneesBinaires(Connexion &cnx, ContexteWeb &ctx) {
+  TrameData t;
+  remplitTrameData(t, ctx.caps.snapshot(), ctx.ctrl.mode() == ControlMode::AUTONOMOUS);
+
+  char tampon[128];
+  ReponseHttp rep(tampon, sizeof(tampon));
+  rep.statut(200);
+  rep.entete("Content-Type", "application/octet-stream");
+  rep.finEntetes();
+  rep.ajouteOctets(&t, sizeof(t));
+  rep.envoie(cnx.client);
+}
+
+// ============================================================
+//   METRIQUES /metrics (JSON), /metrics?reset=1 : remise à zéro après lecture
+// ============================================================
+void envoieMetriques(Connexion &cnx, ContexteWeb &ctx) {
+  // Un seul envoi à la fois : le tampon statique est lu sur plusieurs passages
+  for (uint8_t i = 0; i < kMaxConnexions; i++) {
+    const Connexion &autre = connexions[i];
+    if (autre.etat == EtatConnexion::ENVOI && autre.corpsRestant > 0 &&
+        autre.corps >= (const uint8_t*)tamponMetriques &&
+        autre.corps <  (const uint8_t*)tamponMetriques + kTailleMetriques) {
+      envoieErreur(cnx.client, 503);
+      return;
+    }
+  }
+
+  ReponseHttp rep(tamponMetriques, kTailleMetriques);
+  rep.statut(200);
+  rep.entete("Content-Type", "application/json");
+  rep.entete("Cache-Control", "no-cache");
+  rep.finEntetes();
+  metriques.ecritJson(rep);
+  uint16_t n = rep.termine();
+
+  long reset;
+  if (cnx.req.parametreEntier("reset", reset) && reset) metriques.reset();
+
+  cnx.enteteLen = 0;
+  prepareEnvoi(cnx, (const uint8_t*)tamponMetriques, n);
 }
 
 // ============================================================
-//   INTERFACE HTML (INTACTE - Ton Design Original)
+//   FLUX /stream (Server-Sent Events)
 // ============================================================
-void envoiePageWeb(WiFiClient &client) {
-  client.println("HTTP/1.1 200 OK");
-  client.println("Content-Type: text/html");
-  client.println("Connection: close");
-  client.println();
-
-  client.print(F(
-"<!DOCTYPE html><html><head><meta charset='UTF-8'>"
-"<meta name='viewport' content='width=device-width, initial-scale=1'>"
-"<title>Robot Poisson MKR</title>"
-"<style>"
-"body { background: #0f172a; color: #e2e8f0; font-family: sans-serif; text-align: center; margin: 0; padding: 20px; }"
-".container { max-width: 800px; margin: auto; }"
-"h1 { color: #38bdf8; }"
-".dashboard { display: grid; grid-template-columns: repeat(auto-fit, minmax(150px, 1fr)); gap: 15px; margin-bottom: 20px; }"
-".card { background: #1e293b; padding: 15px; border-radius: 10px; box-shadow: 0 4px 6px rgba(0,0,0,0.3); }"
-".val { font-size: 1.2em; font-weight: bold; color: #34d399; }"
-".label { font-size: 0.8em; color: #94a3b8; }"
-".controls { background: #1e293b; padding: 20px; border-radius: 15px; margin-top: 10px; }"
-".key-row { display: flex; justify-content: center; gap: 10px; margin: 10px 0; }"
-".key { background: #334155; padding: 15px 25px; border-radius: 8px; font-weight: bold;"
-"       border: 2px solid #475569; cursor:pointer; user-select: none; color:#e2e8f0;"
-"       transition: background 0.1s, transform 0.05s; }"
-".key:active { background: #22c55e; color: #000; border-color: #ffffff; transform: translateY(2px); }"
-".key.active { background: #22c55e; color: #000; border-color: #ffffff; transform: translateY(2px); }"
-"</style></head><body>"
-"<div class='container'>"
-"<h1>COMMANDER CENTER</h1>"
-
-"<div class='dashboard'>"
-  "<div class='card'><div class='label'>MODE</div><div class='val' id='mode'>MANUEL</div></div>"
-  "<div class='card'><div class='label'>BATTERIE</div><div class='val'><span id='vbat'>--</span> V</div></div>"
-  "<div class='card'><div class='label'>PROFONDEUR</div><div class='val'><span id='prof'>--</span> m</div></div>"
-  "<div class='card'><div class='label'>CAP (YAW)</div><div class='val'><span id='yaw'>--</span> deg</div></div>"
-"</div>"
-
-"<div class='dashboard' style='font-size:0.8em'>"
-  "<div class='card'><div class='label'>ACCEL (X/Y/Z)</div><div id='acc'>--</div></div>"
-  "<div class='card'><div class='label'>GYRO (X/Y/Z)</div><div id='gyr'>--</div></div>"
-  "<div class='card'><div class='label'>ATTITUDE (P/R)</div><div id='att'>--</div></div>"
-"</div>"
-
-"<div class='controls'>"
-  "<h3>PILOTAGE (Clavier ZQSD + A)</h3>"
-  "<div class='key-row'>"
-"    <div class='key' id='kZ' onclick=\"sendCmd('Z')\">Z</div>"
-  "</div>"
-  "<div class='key-row'>"
-"    <div class='key' id='kQ' onclick=\"sendCmd('Q')\">Q</div>"
-"    <div class='key' id='kS' onclick=\"sendCmd('S')\">S</div>"
-"    <div class='key' id='kD' onclick=\"sendCmd('D')\">D</div>"
-  "</div>"
-  "<div class='key-row'>"
-"    <div class='key' id='kA' onclick=\"sendCmd('A')\">A (AUTO)</div>"
-  "</div>"
-"</div>"
-
-"</div>"
-"<script>"
-"function sendCmd(k){fetch('/cmd?key='+k);}"
-
-// visuel touches actives
-"function setKeyActive(k,a){"
-"  k=k.toUpperCase();"
-"  var el=document.getElementById('k'+k);"
-"  if(!el)return;"
-"  if(a)el.classList.add('active');"
-"  else el.classList.remove('active');"
-"}"
-
-// clavier ZQSD + A
-"window.addEventListener('keydown',function(e){"
-"  var k=e.key;"
-"  if(!k)return;"
-"  k=k.toUpperCase();"
-"  if(['Z','Q','S','D','A'].includes(k)){"
-"    if(e.repeat)return;"
-"    e.preventDefault();"
-"    setKeyActive(k,true);"
-"    sendCmd(k);"
-"  }"
-"});"
-
-"window.addEventListener('keyup',function(e){"
-"  var k=e.key;"
-"  if(!k)return;"
-"  k=k.toUpperCase();"
-"  if(['Z','Q','S','D','A'].includes(k)){"
-"    e.preventDefault();"
-"    setKeyActive(k,false);"
-"    if(['Z','Q','S','D'].includes(k)){"
-"      sendCmd('S');"
-"    }"
-"  }"
-"});"
-
-// rafraîchissement des données
-"setInterval(function(){"
-"  fetch('/data').then(function(r){return r.json();}).then(function(d){"
-"    var el;"
-"    el=document.getElementById('vbat'); if(el)el.innerText=d.v.toFixed(2);"
-"    el=document.getElementById('prof'); if(el)el.innerText=d.p.toFixed(2);"
-"    el=document.getElementById('yaw');  if(el)el.innerText=d.yaw.toFixed(0);"
-"    el=document.getElementById('acc');  if(el)el.innerText=d.ax.toFixed(1)+'/'+d.ay.toFixed(1)+'/'+d.az.toFixed(1);"
-"    el=document.getElementById('gyr');  if(el)el.innerText=d.gx.toFixed(1)+'/'+d.gy.toFixed(1)+'/'+d.gz.toFixed(1);"
-"    el=document.getElementById('att');  if(el)el.innerText=d.pit.toFixed(0)+'/'+d.rol.toFixed(0);"
-"    el=document.getElementById('mode'); if(el)el.innerText=d.auto?'AUTONOME':'MANUEL';"
-"  });"
-"},200);"
-"</script>"
-"</body></html>"
-  ));
-}
\ No newline at end of file
+// Une seule connexion TCP pour toute la session au lieu d'une par échantillon.
+// Chaque évènement : "data:" + TrameData en base64 (48 caractères) + "\n\n".
+
+void setPeriodeFlux(uint16_t periode_ms) {
+  periodeFlux_ms = (periode_ms < 10) ? 10 : periode_ms;
+}
+
+static size_t encodeBase64(const uint8_t *src, size_t n, char *dst) {
+  static const char alphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  size_t o = 0;
+  for (size_t i = 0; i < n; i += 3) {
+    uint32_t v = (uint32_t)src[i] << 16;
+    if (i + 1 < n) v |= (uint32_t)src[i + 1] << 8;
+    if (i + 2 < n) v |= src[i + 2];
+    dst[o++] = alphabet[(v >> 18) & 0x3F];
+    dst[o++] = alphabet[(v >> 12) & 0x3F];
+    dst[o++] = (i + 1 < n) ? alphabet[(v >> 6) & 0x3F] : '=';
+    dst[o++] = (i + 2 < n) ? alphabet[v & 0x3F] : '=';
+  }
+  return o;
+}
+
+void ouvreFlux(Connexion &cnx, ContexteWeb &ctx) {
+  uint8_t ouverts = 0;
+  for (uint8_t i = 0; i < kMaxConnexions; i++) {
+    if (connexions[i].etat == EtatConnexion::FLUX) ouverts++;
+  }
+  if (ouverts >= kMaxFlux) {
+    envoieErreur(cnx.client, 503);
+    return;
+  }
+
+  // /stream?hz=N : cadence demandée par la page
+  long hz;
+  if (cnx.req.parametreEntier("hz", hz) && hz > 0) setPeriodeFlux(1000 / hz);
+
+  char tampon[128];
+  ReponseHttp rep(tampon, sizeof(tampon));
+  rep.statut(200);
+  rep.entete("Content-Type", "text/event-stream");
+  rep.entete("Cache-Control", "no-cache");
+  rep.finEntetesFlux();
+  rep.ajoute("retry: 2000\n\n");
+  rep.envoie(cnx.client);
+
+  cnx.etat = EtatConnexion::FLUX;
+  LOG_INFO("Wifi", "Flux /stream ouvert");
+}
+
+void pousseFlux(ContexteWeb &ctx) {
+  uint32_t now = millis();
+  if ((int32_t)(now - prochainFlux_ms) < 0) return;
+  prochainFlux_ms = now + periodeFlux_ms;
+
+  bool actif = false;
+  for (uint8_t i = 0; i < kMaxConnexions; i++) {
+    if (connexions[i].etat == EtatConnexion::FLUX) actif = true;
+  }
+  if (!actif) return;
+
+  // Pas de nouvelle trame capteurs : rien à envoyer
+  const CapteursData &snap = ctx.caps.snapshot();
+  if (snap.frameId == dernierFrameFlux) return;
+  dernierFrameFlux = snap.frameId;
+
+  TrameData t;
+  remplitTrameData(t, snap, ctx.ctrl.mode() == ControlMode::AUTONOMOUS);
+
+  char evt[5 + 48 + 2];
+  memcpy(evt, "data:", 5);
+  size_t n = 5 + encodeBase64((const uint8_t*)&t, sizeof(t), evt + 5);
+  evt[n++] = '\n';
+  evt[n++] = '\n';
+
+  for (uint8_t i = 0; i < kMaxConnexions; i++) {
+    Connexion &cnx = connexions[i];
+    if (cnx.etat != EtatConnexion::FLUX) continue;
+    if (cnx.client.write((const uint8_t*)evt, n) != n) {
+      fermeConnexion(cnx);
+      LOG_INFO("Wifi", "Flux /stream ferme");
+    }
+  }
+}
+
+// ============================================================
+//   HISTORIQUE /log (binaire)
+// ============================================================
+// En-tête TelemetrieEntete puis count x TelemetrieRecord, lus directement
+// dans l'anneau par morceaux, sur plusieurs passages (voir envoieMorceau).
+void envoieHistorique(Connexion &cnx, ContexteWeb &ctx) {
+  const Telemetrie &telem = ctx.telem;
+  TelemetrieEntete h;
+  telem.fillEntete(h);
+
+  // En-tête HTTP + TelemetrieEntete dans cnx.entete, les enregistrements suivent
+  ReponseHttp rep(cnx.entete, kTailleEntete);
+  rep.statut(200);
+  rep.entete("Content-Type", "application/octet-stream");
+  rep.finEntetes();
+  rep.ajouteOctets(&h, sizeof(h));
+  cnx.enteteLen = rep.termine((uint32_t)h.count * sizeof(TelemetrieRecord));
+
+  if (rep.debordement()) {
+    // 500 déjà dans le tampon : rien d'autre à envoyer
+    prepareEnvoi(cnx, nullptr, 0);
+    return;
+  }
+
+  prepareEnvoi(cnx, nullptr, 0);
+  cnx.logIndex = telem.premierIndex();
+  cnx.logFin   = cnx.logIndex + h.count;
+}
+
+// ============================================================
+//   INTERFACE HTML (web/index.html, compressée dans PageWeb.h)
+// ============================================================
+// Envoyée telle quelle en gzip si Accept-Encoding l'annonce (navigateurs),
+// sinon la copie minifiée non compressée (curl sans --compressed...) ;
+// 406 si le client refuse les deux. Par morceaux de kTailleMorceau.
+// no-cache + ETag (un par copie, Vary: Accept-Encoding) : le navigateur
+// revalide à chaque chargement et reçoit un 304 sans corps tant que la
+// page n'a pas changé (les ETag changent à chaque regénération de PageWeb.h).
+void envoiePageWeb(Connexion &cnx, ContexteWeb &ctx) {
+  bool gzip = cnx.req.accepteGzip();
+  if (!gzip && !cnx.req.accepteIdentite()) {
+    envoieErreur(cnx.client, 406);
+    return;
+  }
+
+  const char    *etag   = gzip ? PAGE_WEB_ETAG : PAGE_WEB_ETAG_HTML;
+  const uint8_t *corps  = gzip ? PAGE_WEB_GZ : PAGE_WEB_HTML;
+  uint32_t       taille = gzip ? sizeof(PAGE_WEB_GZ) : sizeof(PAGE_WEB_HTML);
+  bool aJour = strstr(cnx.req.ifNoneMatch(), etag) != nullptr;
+
+  ReponseHttp rep(cnx.entete, kTailleEntete);
+  rep.statut(aJour ? 304 : 200);
+  rep.entete("Content-Type", "text/html");
+  if (gzip) rep.entete("Content-Encoding", "gzip");
+  rep.entete("Vary", "Accept-Encoding");
+  rep.entete("ETag", etag);
+  rep.entete("Cache-Control", "no-cache");
+  rep.finEntetes();
+  // 304 : Content-Length identique à celui du 200, mais pas de corps
+  cnx.enteteLen = rep.termine(taille);
+
+  prepareEnvoi(cnx, aJour ? nullptr : corps, aJour ? 0 : taille);
+}
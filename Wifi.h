@@ -4,9 +4,48 @@
 #include <WiFiNINA.h>
 #include "Controller.h"
 #include "Capteurs.h"
+#include "Telemetrie.h"
+#include "RequeteHttp.h"
+#include "ReponseHttp.h"
+#include "StatTemps.h"
 
+// Etat de la liaison WiFi (voir updateWifi)
+enum class EtatWifi : uint8_t
+{
+  ABSENT,      // pas de module NINA : fonctionnement sans réseau
+  IDLE,
+  CONNEXION,   // demande envoyée, on scrute le statut
+  CONNECTE,
+  PERDU,       // liaison tombée : sockets fermés
+  ATTENTE      // délai avant nouvelle tentative (doublé à chaque échec)
+};
+
+// Lance la connexion sans attendre (le robot démarre même sans point d'accès)
 void setupWifi();
-void gestionServeurWeb(Controller &controller, Capteurs &capteurs);
+// Un pas de la machine d'états, borné (au plus un WiFi.status())
+void updateWifi();
+EtatWifi etatWifi();
+bool wifiConnecte();
+
+// Appelés à chaque (re)connexion et perte de liaison (ex: canal UDP)
+void setCallbacksWifi(void (*connexion)(), void (*perte)());
+
+// Budget par défaut d'un passage du serveur web (µs)
+static const uint32_t BUDGET_WEB_DEFAUT_US = 2000;
+
+// Un passage non bloquant : avance chaque connexion ouverte d'un pas
+// (lecture, aiguillage, écriture d'un morceau, fermeture) dans le budget donné
+void gestionServeurWeb(Controller &controller, Capteurs &capteurs, Telemetrie &telemetrie,
+                       uint32_t budget_us = BUDGET_WEB_DEFAUT_US);
 void printWifiStatus();
 
+// Temps de service de /data depuis le dernier appel (puis remise à zéro)
+void printStatsWeb();
+
+// Cadence de poussée du flux /stream (Server-Sent Events), en ms
+void setPeriodeFlux(uint16_t periode_ms);
+
+// Asservissement réglé par /pid (sans lui : 503)
+void setAsservWeb(AsservProfond *asserv);
+
 #endif
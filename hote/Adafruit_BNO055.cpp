@@ -0,0 +1,82 @@
+#include "Adafruit_BNO055.h"
+
+static const uint8_t REG_CHIP_ID    = 0x00;
+static const uint8_t REG_CALIB_STAT = 0x35;
+static const uint8_t REG_OPR_MODE   = 0x3D;
+static const uint8_t REG_SYS_TRIGGER = 0x3F;
+static const uint8_t BNO055_ID      = 0xA0;
+
+Adafruit_BNO055::Adafruit_BNO055(int32_t sensorID, uint8_t address, TwoWire* wire)
+: _sensorID(sensorID)
+, _address(address)
+, _wire(wire)
+{
+}
+
+bool Adafruit_BNO055::lit(uint8_t reg, uint8_t* octets, uint8_t n)
+{
+    _wire->beginTransmission(_address);
+    _wire->write(reg);
+    if (_wire->endTransmission() != 0) return false;
+    if (_wire->requestFrom(_address, n) != n) return false;
+    for (uint8_t i = 0; i < n; i++) octets[i] = (uint8_t)_wire->read();
+    return true;
+}
+
+void Adafruit_BNO055::ecrit(uint8_t reg, uint8_t valeur)
+{
+    _wire->beginTransmission(_address);
+    _wire->write(reg);
+    _wire->write(valeur);
+    _wire->endTransmission();
+}
+
+bool Adafruit_BNO055::begin(adafruit_bno055_opmode_t mode)
+{
+    uint8_t id = 0;
+    if (!lit(REG_CHIP_ID, &id, 1) || id != BNO055_ID) return false;
+    ecrit(REG_OPR_MODE, (uint8_t)mode);
+    return true;
+}
+
+void Adafruit_BNO055::setExtCrystalUse(bool usextal)
+{
+    ecrit(REG_SYS_TRIGGER, usextal ? 0x80 : 0x00);
+}
+
+bool Adafruit_BNO055::getEvent(sensors_event_t* event, adafruit_vector_type_t type)
+{
+    memset(event, 0, sizeof(*event));
+    event->sensor_id = _sensorID;
+    event->timestamp = (int32_t)millis();
+
+    uint8_t b[6];
+    if (!lit((uint8_t)type, b, sizeof(b))) return false;
+
+    float v[3];
+    for (uint8_t i = 0; i < 3; i++) v[i] = (float)(int16_t)((uint16_t)b[2 * i] | ((uint16_t)b[2 * i + 1] << 8));
+
+    // Unités par défaut du BNO055 (UNIT_SEL = 0)
+    float echelle = 1.0f;
+    switch (type) {
+        case VECTOR_EULER:        echelle = 1.0f / 16.0f;   break;   // degrés
+        case VECTOR_GYROSCOPE:    echelle = SENSORS_DPS_TO_RADS / 16.0f; break;   // 16 LSB/dps -> rad/s
+        case VECTOR_MAGNETOMETER: echelle = 1.0f / 16.0f;   break;   // µT
+        default:                  echelle = 1.0f / 100.0f;  break;   // m/s²
+    }
+
+    event->orientation.x = v[0] * echelle;
+    event->orientation.y = v[1] * echelle;
+    event->orientation.z = v[2] * echelle;
+    return true;
+}
+
+void Adafruit_BNO055::getCalibration(uint8_t* sys, uint8_t* gyro, uint8_t* accel, uint8_t* mag)
+{
+    uint8_t cal = 0;
+    lit(REG_CALIB_STAT, &cal, 1);
+    if (sys)   *sys   = (cal >> 6) & 0x03;
+    if (gyro)  *gyro  = (cal >> 4) & 0x03;
+    if (accel) *accel = (cal >> 2) & 0x03;
+    if (mag)   *mag   =  cal       & 0x03;
+}
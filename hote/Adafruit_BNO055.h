@@ -0,0 +1,54 @@
+#ifndef HOTE_ADAFRUIT_BNO055_H
+#define HOTE_ADAFRUIT_BNO055_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <Adafruit_Sensor.h>
+
+// =====================
+//   Adafruit_BNO055 factice
+// =====================
+//
+// Passe par le bus I2C comme la librairie : lit les registres du
+// périphérique branché à son adresse (en général un FauxBNO055), avec les
+// mêmes échelles que getEvent() (Euler en degrés, accélération en m/s²,
+// gyro en rad/s).
+
+typedef enum
+{
+    OPERATION_MODE_CONFIG = 0x00,
+    OPERATION_MODE_IMUPLUS = 0x08,
+    OPERATION_MODE_NDOF   = 0x0C
+} adafruit_bno055_opmode_t;
+
+class Adafruit_BNO055
+{
+public:
+    typedef enum
+    {
+        VECTOR_ACCELEROMETER = 0x08,
+        VECTOR_MAGNETOMETER  = 0x0E,
+        VECTOR_GYROSCOPE     = 0x14,
+        VECTOR_EULER         = 0x1A,
+        VECTOR_LINEARACCEL   = 0x28,
+        VECTOR_GRAVITY       = 0x2E
+    } adafruit_vector_type_t;
+
+    Adafruit_BNO055(int32_t sensorID = -1, uint8_t address = 0x28, TwoWire* wire = &Wire);
+
+    bool begin(adafruit_bno055_opmode_t mode = OPERATION_MODE_NDOF);
+    void setExtCrystalUse(bool usextal);
+
+    bool getEvent(sensors_event_t* event, adafruit_vector_type_t type);
+    void getCalibration(uint8_t* sys, uint8_t* gyro, uint8_t* accel, uint8_t* mag);
+
+private:
+    int32_t  _sensorID;
+    uint8_t  _address;
+    TwoWire* _wire;
+
+    bool lit(uint8_t reg, uint8_t* octets, uint8_t n);
+    void ecrit(uint8_t reg, uint8_t valeur);
+};
+
+#endif
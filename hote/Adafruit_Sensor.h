@@ -0,0 +1,31 @@
+#ifndef HOTE_ADAFRUIT_SENSOR_H
+#define HOTE_ADAFRUIT_SENSOR_H
+
+#include <stdint.h>
+
+// Sous-ensemble de Adafruit_Sensor.h utilisé par le firmware
+
+#define SENSORS_DPS_TO_RADS (0.017453293F)
+
+typedef struct
+{
+    float x;
+    float y;
+    float z;
+} sensors_vec_t;
+
+typedef struct
+{
+    int32_t version;
+    int32_t sensor_id;
+    int32_t type;
+    int32_t timestamp;
+    union {
+        sensors_vec_t orientation;
+        sensors_vec_t acceleration;
+        sensors_vec_t gyro;
+        sensors_vec_t magnetic;
+    };
+} sensors_event_t;
+
+#endif
@@ -0,0 +1,294 @@
+#include "Hote.h"
+
+#include <chrono>
+#include <thread>
+
+void hoteReinitialiseServos();   // Servo.cpp
+void hoteReinitialiseIna();      // INA236.cpp
+void hoteReinitialiseWifi();     // WiFiNINA.cpp
+
+// =====================
+//   Horloge
+// =====================
+
+static uint64_t s_temps_us = 0;
+static bool     s_reelle   = false;
+
+static uint64_t tempsReel_us()
+{
+    using namespace std::chrono;
+    static const steady_clock::time_point origine = steady_clock::now();
+    return (uint64_t)duration_cast<microseconds>(steady_clock::now() - origine).count();
+}
+
+void hoteAvance_us(uint32_t dt_us) { s_temps_us += dt_us; }
+void hoteAvance_ms(uint32_t dt_ms) { s_temps_us += (uint64_t)dt_ms * 1000; }
+void hoteHorlogeReelle(bool reelle) { s_reelle = reelle; }
+
+uint64_t hoteTemps_us()
+{
+    return s_reelle ? tempsReel_us() : s_temps_us;
+}
+
+// Rebouclages 32 bits comme sur la carte
+unsigned long millis() { return (uint32_t)(hoteTemps_us() / 1000); }
+unsigned long micros() { return (uint32_t)hoteTemps_us(); }
+
+void delay(unsigned long ms)
+{
+    if (s_reelle) std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    else          s_temps_us += (uint64_t)ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us)
+{
+    if (s_reelle) std::this_thread::sleep_for(std::chrono::microseconds(us));
+    else          s_temps_us += us;
+}
+
+// =====================
+//   Broches
+// =====================
+
+static EtatBroche s_broches[HOTE_NB_BROCHES];
+static int        s_sectionCritique = 0;
+
+static EtatBroche* broche(uint8_t pin)
+{
+    return pin < HOTE_NB_BROCHES ? &s_broches[pin] : nullptr;
+}
+
+const EtatBroche& hoteBroche(uint8_t pin)
+{
+    static const EtatBroche aucune = { INPUT, LOW, LOW, -1, 0, nullptr, 0 };
+    const EtatBroche* b = broche(pin);
+    return b ? *b : aucune;
+}
+
+void hoteRegleBroche(uint8_t pin, uint8_t niveau)
+{
+    EtatBroche* b = broche(pin);
+    if (!b) return;
+
+    uint8_t avant = b->entree;
+    b->entree = niveau ? HIGH : LOW;
+    if (!b->isr || avant == b->entree) return;
+
+    bool montant = b->entree == HIGH;
+    if (b->front == CHANGE || (b->front == RISING && montant) || (b->front == FALLING && !montant)) {
+        b->isr();
+    }
+}
+
+int hoteProfondeurSectionCritique() { return s_sectionCritique; }
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    EtatBroche* b = broche(pin);
+    if (!b) return;
+    b->mode = mode;
+    if (mode == INPUT_PULLUP) b->entree = HIGH;
+}
+
+int digitalRead(uint8_t pin)
+{
+    EtatBroche* b = broche(pin);
+    return b ? b->entree : LOW;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+    EtatBroche* b = broche(pin);
+    if (!b) return;
+    b->sortie = val ? HIGH : LOW;
+    b->pwm    = 0;   // comme sur AVR : la broche quitte la PWM
+}
+
+void analogWrite(uint8_t pin, int val)
+{
+    EtatBroche* b = broche(pin);
+    if (!b) return;
+    b->pwm = val;
+    b->ecrituresPwm++;
+}
+
+int analogRead(uint8_t) { return 0; }
+
+void attachInterrupt(int interrupt, void (*isr)(void), int mode)
+{
+    EtatBroche* b = broche((uint8_t)interrupt);
+    if (!b) return;
+    b->isr   = isr;
+    b->front = mode;
+}
+
+void detachInterrupt(int interrupt)
+{
+    EtatBroche* b = broche((uint8_t)interrupt);
+    if (b) b->isr = nullptr;
+}
+
+void noInterrupts() { s_sectionCritique++; }
+void interrupts()   { s_sectionCritique--; }
+
+// =====================
+//   Print
+// =====================
+
+size_t Print::write(const uint8_t* buffer, size_t size)
+{
+    size_t n = 0;
+    while (size--) {
+        if (!write(*buffer++)) break;
+        n++;
+    }
+    return n;
+}
+
+size_t Print::print(long v, int base)
+{
+    if (base == DEC && v < 0) {
+        size_t t = print('-');
+        return t + printNumber(0UL - (unsigned long)v, DEC);
+    }
+    return printNumber((unsigned long)v, (uint8_t)base);
+}
+
+size_t Print::print(unsigned long v, int base)
+{
+    return printNumber(v, (uint8_t)base);
+}
+
+size_t Print::print(double v, int digits)
+{
+    return printFloat(v, (uint8_t)digits);
+}
+
+size_t Print::println()
+{
+    return write("\r\n");
+}
+
+size_t Print::printf(const char* format, ...)
+{
+    char tampon[256];
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(tampon, sizeof(tampon), format, args);
+    va_end(args);
+    if (n < 0) return 0;
+    return write((const uint8_t*)tampon, (size_t)n < sizeof(tampon) ? (size_t)n : sizeof(tampon) - 1);
+}
+
+// Mêmes sorties que le cœur Arduino (Print.cpp)
+size_t Print::printNumber(unsigned long n, uint8_t base)
+{
+    char buf[8 * sizeof(long) + 1];
+    char* str = &buf[sizeof(buf) - 1];
+    *str = '\0';
+    if (base < 2) base = 10;
+
+    do {
+        char c = (char)(n % base);
+        n /= base;
+        *--str = c < 10 ? c + '0' : c + 'A' - 10;
+    } while (n);
+
+    return write(str);
+}
+
+size_t Print::printFloat(double number, uint8_t digits)
+{
+    if (isnan(number)) return print("nan");
+    if (isinf(number)) return print("inf");
+    if (number > 4294967040.0)  return print("ovf");
+    if (number < -4294967040.0) return print("ovf");
+
+    size_t n = 0;
+    if (number < 0.0) {
+        n += print('-');
+        number = -number;
+    }
+
+    double arrondi = 0.5;
+    for (uint8_t i = 0; i < digits; ++i) arrondi /= 10.0;
+    number += arrondi;
+
+    unsigned long entier = (unsigned long)number;
+    double reste = number - (double)entier;
+    n += print(entier);
+    if (digits > 0) n += print('.');
+
+    while (digits-- > 0) {
+        reste *= 10.0;
+        unsigned int chiffre = (unsigned int)reste;
+        n += print(chiffre);
+        reste -= chiffre;
+    }
+    return n;
+}
+
+// =====================
+//   Serial
+// =====================
+
+Serial_ Serial;
+
+static bool        s_capture = false;
+static std::string s_sortie;
+static std::string s_entree;
+
+void               hoteSerieCapture(bool capture) { s_capture = capture; }
+const std::string& hoteSerieSortie()              { return s_sortie; }
+void               hoteSerieEfface()              { s_sortie.clear(); }
+void               hoteSerieEntree(const char* texte) { s_entree += texte; }
+
+size_t Serial_::write(uint8_t c)
+{
+    return write(&c, 1);
+}
+
+size_t Serial_::write(const uint8_t* buffer, size_t size)
+{
+    if (s_capture) s_sortie.append((const char*)buffer, size);
+    else           fwrite(buffer, 1, size, stdout);
+    return size;
+}
+
+int Serial_::available() { return (int)s_entree.size(); }
+
+int Serial_::read()
+{
+    if (s_entree.empty()) return -1;
+    int c = (uint8_t)s_entree[0];
+    s_entree.erase(0, 1);
+    return c;
+}
+
+int Serial_::peek() { return s_entree.empty() ? -1 : (uint8_t)s_entree[0]; }
+
+// =====================
+//   Remise à zéro
+// =====================
+
+void hoteReinitialise()
+{
+    s_temps_us = 0;
+    s_reelle   = false;
+    s_sectionCritique = 0;
+    for (uint8_t i = 0; i < HOTE_NB_BROCHES; i++) s_broches[i] = hoteBroche(0xFF);
+
+    s_capture = false;
+    s_sortie.clear();
+    s_entree.clear();
+
+    hoteReinitialiseServos();
+    hoteReinitialiseIna();
+    hoteReinitialiseWifi();
+}
+
+// Etat initial des broches (avant tout hoteReinitialise)
+static struct InitBroches
+{
+    InitBroches() { for (uint8_t i = 0; i < HOTE_NB_BROCHES; i++) s_broches[i] = { INPUT, LOW, LOW, -1, 0, nullptr, 0 }; }
+} s_initBroches;
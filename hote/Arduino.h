@@ -0,0 +1,167 @@
+#ifndef HOTE_ARDUINO_H
+#define HOTE_ARDUINO_H
+
+// =====================
+//   Couche Arduino factice (build hôte Linux)
+// =====================
+//
+// Juste ce que le firmware utilise du cœur SAMD, avec un comportement
+// observable par les tests (Hote.h) :
+//
+//   millis() / micros()   horloge virtuelle (n'avance que par hoteAvance_us()
+//                         ou delay()), ou horloge du PC (hoteHorlogeReelle)
+//   Serial                stdout, ou tampon capturé ; entrée scriptable
+//   broches               niveaux d'entrée scriptés, sorties et PWM
+//                         enregistrées, ISR déclenchées sur front
+//
+// Pas de PendSV ni de NVIC : ARDUINO_ARCH_SAMD n'est pas défini.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <ctype.h>
+
+#ifndef F_CPU
+#define F_CPU 48000000UL   // SAMD21 : seulement pour convertir µs -> cycles
+#endif
+
+typedef uint8_t byte;
+typedef bool    boolean;
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT          0x0
+#define OUTPUT         0x1
+#define INPUT_PULLUP   0x2
+#define INPUT_PULLDOWN 0x3
+
+#define CHANGE  2
+#define FALLING 3
+#define RISING  4
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define PI         3.1415926535897932384626433832795
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+#define NOT_AN_INTERRUPT -1
+#define digitalPinToInterrupt(p) ((int)(p))
+
+#define PROGMEM
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define memcpy_P memcpy
+
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper*>(s))
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+int  digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t val);
+void analogWrite(uint8_t pin, int val);
+int  analogRead(uint8_t pin);
+
+void attachInterrupt(int interrupt, void (*isr)(void), int mode);
+void detachInterrupt(int interrupt);
+
+void noInterrupts();
+void interrupts();
+
+template <typename T> inline T constrain(T x, T a, T b) { return x < a ? a : (x > b ? b : x); }
+
+// =====================
+//   Print / Stream
+// =====================
+
+class Print;
+
+class Printable
+{
+public:
+    virtual ~Printable() {}
+    virtual size_t printTo(Print& p) const = 0;
+};
+
+class Print
+{
+public:
+    virtual ~Print() {}
+
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size);
+    size_t write(const char* s) { return s ? write((const uint8_t*)s, strlen(s)) : 0; }
+    size_t write(const char* buffer, size_t size) { return write((const uint8_t*)buffer, size); }
+
+    virtual int availableForWrite() { return 0; }
+    virtual void flush() {}
+
+    size_t print(const __FlashStringHelper* s) { return write((const char*)s); }
+    size_t print(const char* s)                { return write(s); }
+    size_t print(char c)                       { return write((uint8_t)c); }
+    size_t print(unsigned char v, int base = DEC) { return print((unsigned long)v, base); }
+    size_t print(int v, int base = DEC)           { return print((long)v, base); }
+    size_t print(unsigned int v, int base = DEC)  { return print((unsigned long)v, base); }
+    size_t print(long v, int base = DEC);
+    size_t print(unsigned long v, int base = DEC);
+    size_t print(double v, int digits = 2);
+    size_t print(const Printable& x)           { return x.printTo(*this); }
+
+    size_t println();
+    template <typename T> size_t println(T v)              { size_t n = print(v); return n + println(); }
+    template <typename T> size_t println(T v, int format)  { size_t n = print(v, format); return n + println(); }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+private:
+    size_t printNumber(unsigned long n, uint8_t base);
+    size_t printFloat(double number, uint8_t digits);
+};
+
+class Stream : public Print
+{
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+};
+
+class Serial_ : public Stream
+{
+public:
+    void begin(unsigned long) {}
+    void end() {}
+    operator bool() const { return true; }
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+
+    // Tampon USB CDC du SAMD21 : 63 octets libres au plus par paquet ;
+    // plus large ici, stdout ne bloque pas
+    int availableForWrite() override { return 256; }
+
+    int available() override;
+    int read() override;
+    int peek() override;
+};
+
+extern Serial_ Serial;
+
+// Point d'entrée du croquis (CodePoisson.ino)
+void setup();
+void loop();
+
+#endif
@@ -0,0 +1,207 @@
+#include "FauxCapteurs.h"
+#include "Hote.h"
+
+// =====================
+//   BNO055
+// =====================
+
+FauxBNO055::FauxBNO055()
+: _pointeur(0)
+, _lectures(0)
+{
+    memset(_reg, 0, sizeof(_reg));
+    _reg[0x00] = 0xA0;   // CHIP_ID
+    regleGravite(0.0f, 0.0f, 9.81f);
+    regleAcceleration(0.0f, 0.0f, 9.81f);
+    regleCalibration(3, 3, 3, 3);
+}
+
+void FauxBNO055::ecritVecteur(uint8_t reg, float x, float y, float z, float lsb)
+{
+    float v[3] = { x, y, z };
+    for (uint8_t i = 0; i < 3; i++) {
+        int16_t brut = (int16_t)lroundf(v[i] * lsb);
+        _reg[reg + 2 * i]     = (uint8_t)(brut & 0xFF);
+        _reg[reg + 2 * i + 1] = (uint8_t)((uint16_t)brut >> 8);
+    }
+}
+
+void FauxBNO055::regleEuler(float cap, float roulis, float tangage) { ecritVecteur(0x1A, cap, roulis, tangage, 16.0f); }
+void FauxBNO055::regleAcceleration(float x, float y, float z)      { ecritVecteur(0x08, x, y, z, 100.0f); }
+void FauxBNO055::regleGyro(float x, float y, float z)              { ecritVecteur(0x14, x, y, z, 16.0f); }
+void FauxBNO055::regleLineaire(float x, float y, float z)          { ecritVecteur(0x28, x, y, z, 100.0f); }
+void FauxBNO055::regleGravite(float x, float y, float z)           { ecritVecteur(0x2E, x, y, z, 100.0f); }
+
+void FauxBNO055::regleCalibration(uint8_t sys, uint8_t gyro, uint8_t acc, uint8_t mag)
+{
+    _reg[0x35] = (uint8_t)(((sys & 3) << 6) | ((gyro & 3) << 4) | ((acc & 3) << 2) | (mag & 3));
+}
+
+void FauxBNO055::recoit(const uint8_t* octets, uint8_t n)
+{
+    if (n == 0) return;
+    _pointeur = octets[0] & 0x7F;
+    for (uint8_t i = 1; i < n; i++) _reg[(_pointeur + i - 1) & 0x7F] = octets[i];
+}
+
+uint8_t FauxBNO055::envoie(uint8_t* octets, uint8_t n)
+{
+    for (uint8_t i = 0; i < n; i++) octets[i] = _reg[(_pointeur + i) & 0x7F];
+    _lectures++;
+    return n;
+}
+
+// =====================
+//   MS5837
+// =====================
+
+// Durée max de conversion par OSR 256..8192 (datasheet)
+static const uint32_t CONVERSION_MAX_US[6] = { 600, 1170, 2280, 4540, 9040, 18080 };
+
+FauxMS5837::FauxMS5837()
+: _d1(0)
+, _d2(0)
+, _bar02(false)
+, _lecture(RIEN)
+, _motProm(0)
+, _resultat(0)
+, _conversionLancee(false)
+, _finConversion_us(0)
+, _conversions(0)
+{
+    static const uint16_t exemple[7] = { 0, 34982, 36352, 20328, 22354, 26646, 26146 };
+    regleProm(exemple);
+    regleBrut(4958179, 6815414);   // 3999.8 mbar, 19.82 °C
+}
+
+void FauxMS5837::regleProm(const uint16_t c[7])
+{
+    for (uint8_t i = 0; i < 7; i++) _prom[i] = c[i];
+    _prom[7] = 0;
+    _prom[0] = (uint16_t)((_prom[0] & 0x0FFF) | ((uint16_t)crc4(_prom) << 12));
+}
+
+void FauxMS5837::regleBrut(uint32_t d1, uint32_t d2)
+{
+    _d1 = d1;
+    _d2 = d2;
+}
+
+void FauxMS5837::compense(uint32_t D1, uint32_t D2, float& pression_mbar, float& temperature_C) const
+{
+    const uint16_t* C = _prom;
+    int64_t dT = (int64_t)D2 - (int64_t)C[5] * 256;
+    int64_t SENS, OFF;
+    if (_bar02) {
+        SENS = (int64_t)C[1] * 65536 + ((int64_t)C[3] * dT) / 128;
+        OFF  = (int64_t)C[2] * 131072 + ((int64_t)C[4] * dT) / 64;
+    } else {
+        SENS = (int64_t)C[1] * 32768 + ((int64_t)C[3] * dT) / 256;
+        OFF  = (int64_t)C[2] * 65536 + ((int64_t)C[4] * dT) / 128;
+    }
+    int64_t T = 2000 + dT * C[6] / 8388608;
+
+    int64_t Ti = 0, OFFi = 0, SENSi = 0;
+    int64_t e2 = (T - 2000) * (T - 2000);
+    if (_bar02) {
+        if (T < 2000) {
+            Ti    = 11 * dT * dT / 34359738368LL;
+            OFFi  = 31 * e2 / 8;
+            SENSi = 63 * e2 / 32;
+        }
+    } else if (T < 2000) {
+        Ti    = 3 * dT * dT / 8589934592LL;
+        OFFi  = 3 * e2 / 2;
+        SENSi = 5 * e2 / 8;
+        if (T < -1500) {
+            OFFi  += 7 * (T + 1500) * (T + 1500);
+            SENSi += 4 * (T + 1500) * (T + 1500);
+        }
+    } else {
+        Ti    = 2 * dT * dT / 137438953472LL;
+        OFFi  = e2 / 16;
+    }
+
+    int64_t P = ((int64_t)D1 * (SENS - SENSi) / 2097152 - (OFF - OFFi)) / (_bar02 ? 32768 : 8192);
+    pression_mbar = _bar02 ? P / 100.0f : P / 10.0f;
+    temperature_C = (T - Ti) / 100.0f;
+}
+
+void FauxMS5837::reglePression(float pression_mbar, float temperature_C)
+{
+    // Monotones : T croît avec D2, P croît avec D1 (à D2 fixé). Dichotomie.
+    float p, t;
+
+    uint32_t bas = 0, haut = 0xFFFFFF;
+    while (bas < haut) {
+        uint32_t milieu = bas + (haut - bas) / 2;
+        compense(0, milieu, p, t);
+        if (t < temperature_C) bas = milieu + 1; else haut = milieu;
+    }
+    uint32_t d2 = bas;
+
+    bas = 0; haut = 0xFFFFFF;
+    while (bas < haut) {
+        uint32_t milieu = bas + (haut - bas) / 2;
+        compense(milieu, d2, p, t);
+        if (p < pression_mbar) bas = milieu + 1; else haut = milieu;
+    }
+    regleBrut(bas, d2);
+}
+
+uint8_t FauxMS5837::crc4(const uint16_t n_prom[8])
+{
+    uint16_t prom[8];
+    memcpy(prom, n_prom, sizeof(prom));
+    prom[0] &= 0x0FFF;
+    prom[7] = 0;
+
+    uint16_t n_rem = 0;
+    for (uint8_t i = 0; i < 16; i++) {
+        n_rem ^= (i & 1) ? (uint16_t)(prom[i >> 1] & 0x00FF) : (uint16_t)(prom[i >> 1] >> 8);
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            n_rem = (n_rem & 0x8000) ? (uint16_t)((n_rem << 1) ^ 0x3000) : (uint16_t)(n_rem << 1);
+        }
+    }
+    return (n_rem >> 12) & 0x0F;
+}
+
+void FauxMS5837::recoit(const uint8_t* octets, uint8_t n)
+{
+    if (n == 0) return;
+    uint8_t cmd = octets[0];
+
+    if (cmd == 0x1E) {                                  // reset
+        _lecture = RIEN;
+        _conversionLancee = false;
+    } else if (cmd >= 0xA0 && cmd <= 0xAE) {            // lecture PROM
+        _lecture = PROM;
+        _motProm = (cmd - 0xA0) >> 1;
+    } else if ((cmd & 0xE0) == 0x40 && (cmd & 0x0F) <= 0x0A && !(cmd & 1)) {   // conversion D1 / D2
+        uint8_t osr = (cmd & 0x0F) >> 1;
+        _resultat         = (cmd & 0x10) ? _d2 : _d1;
+        _conversionLancee = true;
+        _finConversion_us = hoteTemps_us() + CONVERSION_MAX_US[osr];
+        _conversions++;
+    } else if (cmd == 0x00) {                           // lecture ADC
+        _lecture = ADC;
+    }
+}
+
+uint8_t FauxMS5837::envoie(uint8_t* octets, uint8_t n)
+{
+    if (_lecture == PROM && n >= 2) {
+        octets[0] = (uint8_t)(_prom[_motProm] >> 8);
+        octets[1] = (uint8_t)(_prom[_motProm] & 0xFF);
+        return 2;
+    }
+    if (_lecture == ADC && n >= 3) {
+        uint32_t v = (_conversionLancee && hoteTemps_us() >= _finConversion_us) ? _resultat : 0;
+        _conversionLancee = false;
+        octets[0] = (uint8_t)(v >> 16);
+        octets[1] = (uint8_t)(v >> 8);
+        octets[2] = (uint8_t)v;
+        return 3;
+    }
+    return 0;
+}
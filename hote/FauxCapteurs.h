@@ -0,0 +1,92 @@
+#ifndef HOTE_FAUX_CAPTEURS_H
+#define HOTE_FAUX_CAPTEURS_H
+
+#include <Wire.h>
+
+// =====================
+//   Capteurs I2C scriptés
+// =====================
+//
+// À brancher sur le bus factice (Wire.branche(adresse, &faux)) : le
+// firmware les lit par ses vrais chemins (rafale BNO055, MS5837Async).
+// Les grandeurs sont réglées en unités physiques et codées comme le
+// ferait la puce.
+
+// BNO055 : banc de registres, unités par défaut (UNIT_SEL = 0)
+class FauxBNO055 : public PeripheriqueI2C
+{
+public:
+    static const uint8_t ADRESSE = 0x28;
+
+    FauxBNO055();
+
+    void regleEuler(float cap_deg, float roulis_deg, float tangage_deg);   // 16 LSB/°
+    void regleAcceleration(float x, float y, float z);                     // m/s², 100 LSB
+    void regleGyro(float x_dps, float y_dps, float z_dps);                 // 16 LSB/dps
+    void regleLineaire(float x, float y, float z);                         // LIA, m/s²
+    void regleGravite(float x, float y, float z);                          // GRV, m/s²
+    void regleCalibration(uint8_t sys, uint8_t gyro, uint8_t acc, uint8_t mag);
+
+    uint8_t registre(uint8_t reg) const { return _reg[reg & 0x7F]; }
+    uint32_t lectures() const { return _lectures; }
+
+    void    recoit(const uint8_t* octets, uint8_t n) override;
+    uint8_t envoie(uint8_t* octets, uint8_t n) override;
+
+private:
+    uint8_t  _reg[128];
+    uint8_t  _pointeur;
+    uint32_t _lectures;
+
+    void ecritVecteur(uint8_t reg, float x, float y, float z, float lsb);
+};
+
+// MS5837 : PROM, conversions D1/D2 avec leur durée, lecture ADC.
+// Une lecture ADC avant la fin de conversion rend 0, comme la puce.
+class FauxMS5837 : public PeripheriqueI2C
+{
+public:
+    static const uint8_t ADRESSE = 0x76;
+
+    // Coefficients de l'exemple de la datasheet MS5837-30BA (CRC calculé)
+    FauxMS5837();
+
+    void regleProm(const uint16_t c[7]);   // c[0] : CRC recalculé
+    void regleMotProm(uint8_t i, uint16_t v) { _prom[i & 7] = v; }   // tel quel (PROM corrompue)
+    void regleBrut(uint32_t d1, uint32_t d2);
+
+    // Formules de compensation : 30BA (défaut) ou 02BA
+    void regleModele02BA(bool bar02) { _bar02 = bar02; }
+
+    // Trouve D1/D2 donnant ces valeurs après compensation (1er + 2nd ordre)
+    void reglePression(float pression_mbar, float temperature_C);
+
+    uint16_t prom(uint8_t i) const { return _prom[i]; }
+    uint32_t d1() const { return _d1; }
+    uint32_t d2() const { return _d2; }
+    uint32_t conversions() const { return _conversions; }
+
+    // Compensation de référence (datasheet), calculée en entiers
+    void compense(uint32_t d1, uint32_t d2, float& pression_mbar, float& temperature_C) const;
+
+    static uint8_t crc4(const uint16_t prom[8]);
+
+    void    recoit(const uint8_t* octets, uint8_t n) override;
+    uint8_t envoie(uint8_t* octets, uint8_t n) override;
+
+private:
+    enum Lecture : uint8_t { RIEN, PROM, ADC };
+
+    uint16_t _prom[8];
+    uint32_t _d1, _d2;
+    bool     _bar02;
+
+    Lecture  _lecture;
+    uint8_t  _motProm;
+    uint32_t _resultat;        // conversion en cours ou terminée
+    bool     _conversionLancee;
+    uint64_t _finConversion_us;
+    uint32_t _conversions;
+};
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef HOTE_H
+#define HOTE_H
+
+#include <Arduino.h>
+#include <string>
+
+// =====================
+//   Pilotage de la couche factice (tests, bancs, simulateur)
+// =====================
+//
+// Horloge : virtuelle par défaut, partagée par millis(), micros(), delay()
+// et delayMicroseconds(). Sans HORLOGE_VIRTUELLE, horloge_ms()/horloge_us()
+// sont millis()/micros() (Horloge.h) : tout le firmware avance avec
+// hoteAvance_us(). hoteHorlogeReelle(true) branche micros() sur l'horloge
+// du PC (bancs).
+
+void     hoteAvance_us(uint32_t dt_us);
+void     hoteAvance_ms(uint32_t dt_ms);
+uint64_t hoteTemps_us();
+void     hoteHorlogeReelle(bool reelle);
+
+// --- Broches ---
+
+static const uint8_t HOTE_NB_BROCHES = 32;
+
+struct EtatBroche
+{
+    uint8_t  mode;          // pinMode()
+    uint8_t  entree;        // niveau scripté, lu par digitalRead()
+    uint8_t  sortie;        // dernier digitalWrite()
+    int      pwm;           // dernier analogWrite() (-1 : jamais, 0 après digitalWrite())
+    uint32_t ecrituresPwm;
+    void   (*isr)();        // attachInterrupt()
+    int      front;         // RISING, FALLING, CHANGE
+};
+
+const EtatBroche& hoteBroche(uint8_t pin);
+
+// Change le niveau d'entrée ; déclenche l'ISR attachée si le front correspond
+void hoteRegleBroche(uint8_t pin, uint8_t niveau);
+
+// Sections critiques : noInterrupts() / interrupts() équilibrés ?
+int  hoteProfondeurSectionCritique();
+
+// --- Serial ---
+
+// true : la sortie est gardée dans un tampon au lieu de stdout
+void               hoteSerieCapture(bool capture);
+const std::string& hoteSerieSortie();
+void               hoteSerieEfface();
+void               hoteSerieEntree(const char* texte);
+
+// Remet broches, Serial et horloge à zéro (début de test)
+void hoteReinitialise();
+
+#endif
@@ -0,0 +1,46 @@
+#include "INA236.h"
+
+static FauxINA236 s_ina[128];
+
+FauxINA236& hoteIna(uint8_t address)
+{
+    return s_ina[address & 0x7F];
+}
+
+void hoteReinitialiseIna()
+{
+    for (uint8_t i = 0; i < 128; i++) s_ina[i] = FauxINA236();
+    // Batterie 2S chargée par défaut, sans consommation
+    for (uint8_t i = 0; i < 128; i++) { s_ina[i].present = true; s_ina[i].tension_V = 8.0f; }
+}
+
+static struct InitIna { InitIna() { hoteReinitialiseIna(); } } s_initIna;
+
+INA236::INA236(uint8_t address, TwoWire*)
+: _address(address & 0x7F)
+{
+}
+
+bool INA236::begin()       { return isConnected(); }
+bool INA236::isConnected() { return s_ina[_address].present; }
+
+float INA236::getBusVoltage()   { s_ina[_address].lectures++; return s_ina[_address].tension_V; }
+float INA236::getCurrent()      { s_ina[_address].lectures++; return s_ina[_address].courant_mA; }
+float INA236::getShuntVoltage() { return s_ina[_address].courant_mA * 1e-5f; }   // mV sur 10 mΩ
+float INA236::getPower()        { return s_ina[_address].tension_V * s_ina[_address].courant_mA; }
+
+bool INA236::setAverage(uint8_t avg)                    { s_ina[_address].moyenne = avg;     return isConnected(); }
+bool INA236::setBusVoltageConversionTime(uint8_t bvct)  { s_ina[_address].tempsBus = bvct;   return isConnected(); }
+bool INA236::setShuntVoltageConversionTime(uint8_t svct){ s_ina[_address].tempsShunt = svct; return isConnected(); }
+bool INA236::setMode(uint8_t)                           { return isConnected(); }
+
+bool INA236::setAlertRegister(uint16_t mask) { s_ina[_address].registreAlerte = mask; return isConnected(); }
+bool INA236::setAlertLimit(uint16_t limit)   { s_ina[_address].limiteAlerte = limit;  return isConnected(); }
+uint16_t INA236::getAlertLimit()             { return s_ina[_address].limiteAlerte; }
+
+uint16_t INA236::getAlertFlag()
+{
+    uint16_t f = s_ina[_address].drapeaux;
+    s_ina[_address].drapeaux = 0;
+    return f;
+}
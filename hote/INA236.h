@@ -0,0 +1,60 @@
+#ifndef HOTE_INA236_H
+#define HOTE_INA236_H
+
+#include <Arduino.h>
+#include <Wire.h>
+
+// =====================
+//   INA236 factice
+// =====================
+//
+// Interface de la librairie utilisée par Capteurs. Les mesures et les
+// drapeaux d'alerte sont scriptés par adresse (hoteIna) ; la configuration
+// écrite par le firmware y est relevée.
+
+struct FauxINA236
+{
+    bool     present;
+    float    tension_V;
+    float    courant_mA;
+    uint16_t drapeaux;      // MASK/ENABLE relu par getAlertFlag(), acquitté à la lecture
+    // Configuration écrite par le firmware
+    uint8_t  moyenne;
+    uint8_t  tempsBus;
+    uint8_t  tempsShunt;
+    uint16_t registreAlerte;
+    uint16_t limiteAlerte;
+    uint32_t lectures;      // getBusVoltage() + getCurrent()
+};
+
+FauxINA236& hoteIna(uint8_t address);
+void        hoteReinitialiseIna();
+
+class INA236
+{
+public:
+    INA236(uint8_t address, TwoWire* wire = &Wire);
+
+    bool begin();
+    bool isConnected();
+
+    float getBusVoltage();
+    float getShuntVoltage();
+    float getCurrent();
+    float getPower();
+
+    bool setAverage(uint8_t avg = 0);
+    bool setBusVoltageConversionTime(uint8_t bvct = 4);
+    bool setShuntVoltageConversionTime(uint8_t svct = 4);
+    bool setMode(uint8_t mode = 7);
+
+    bool     setAlertRegister(uint16_t mask);
+    uint16_t getAlertFlag();
+    bool     setAlertLimit(uint16_t limit);
+    uint16_t getAlertLimit();
+
+private:
+    uint8_t _address;
+};
+
+#endif
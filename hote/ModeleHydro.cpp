@@ -0,0 +1,158 @@
+#include "ModeleHydro.h"
+#include <math.h>
+
+static const float G_MS2      = 9.81f;
+static const float RHO_KG_M3  = 997.0f;
+
+// Poisson de ~2 kg, seringue de 60 mL, équilibré à 30° (ballastEquilibre)
+ParametresHydro::ParametresHydro()
+: masse_kg(2.0f)
+, volumeBallast_m3(60e-6f)
+, angleEquilibre_deg(30.0f)
+, masseAjoutee_kg(1.0f)
+, traineeZ_kg_m(10.0f)
+, profondeurFond_m(3.0f)
+, vitesseServo_dps(120.0f)
+, pousseeMax_N(2.0f)
+, traineeX_kg_m(2.0f)
+, lacet_dps_par_mps(60.0f)
+, constanteLacet_s(0.5f)
+, dureeGouvernail_s(1.0f)
+, capacite_mAh(2200.0f)
+, tensionPleine_V(8.4f)
+, tensionVide_V(6.4f)
+, resistanceInterne_ohm(0.1f)
+, courantRepos_mA(150.0f)
+, courantServo_mA(350.0f)
+, courantServoMaintien_mA(10.0f)
+, courantPropulsionMax_mA(1500.0f)
+, bruitProfondeur_m(0.002f)
+, graine(1)
+{
+}
+
+ModeleHydro::ModeleHydro(const ParametresHydro& p)
+: _p(p)
+{
+    reset();
+}
+
+void ModeleHydro::setParametres(const ParametresHydro& p)
+{
+    _p = p;
+    reset();
+}
+
+void ModeleHydro::reset()
+{
+    // Volume de coque tel que la flottabilité soit nulle à angleEquilibre_deg
+    float eau_kg = RHO_KG_M3 * _p.volumeBallast_m3 * _p.angleEquilibre_deg / 180.0f;
+    _volumeCoque_m3 = (_p.masse_kg + eau_kg) / RHO_KG_M3;
+
+    _etat = EtatHydro();
+    _etat.tension_V = _p.tensionPleine_V;
+
+    _consigneServo_deg = 0.0f;
+    _pwm        = 0;
+    _rotationGouvernail = 0;
+    _reste_s    = 0.0f;
+    _alea       = _p.graine ? _p.graine : 1;
+}
+
+void ModeleHydro::commande(float angleServo_deg, uint8_t pwmPropulsion, int8_t rotationGouvernail)
+{
+    _consigneServo_deg  = angleServo_deg;
+    _pwm                = pwmPropulsion;
+    _rotationGouvernail = rotationGouvernail;
+}
+
+void ModeleHydro::avance(float dt_s)
+{
+    _reste_s += dt_s;
+    while (_reste_s >= PAS_S) {
+        pas(PAS_S);
+        _reste_s -= PAS_S;
+    }
+}
+
+void ModeleHydro::pas(float dt)
+{
+    EtatHydro& e = _etat;
+
+    // 1. Crémaillère : suit la consigne à vitesse bornée
+    float ecart  = _consigneServo_deg - e.angleBallast_deg;
+    float maxPas = _p.vitesseServo_dps * dt;
+    bool  bouge  = fabsf(ecart) > 1e-3f;
+    if (ecart >  maxPas) ecart =  maxPas;
+    if (ecart < -maxPas) ecart = -maxPas;
+    e.angleBallast_deg += ecart;
+
+    // 2. Vertical : poids (ballast compris) - Archimède - traînée
+    float eau_kg  = RHO_KG_M3 * _p.volumeBallast_m3 * e.angleBallast_deg / 180.0f;
+    float masse   = _p.masse_kg + eau_kg;
+    float force_N = masse * G_MS2 - RHO_KG_M3 * _volumeCoque_m3 * G_MS2
+                  - _p.traineeZ_kg_m * e.vitesseZ_mps * fabsf(e.vitesseZ_mps);
+    float acc     = force_N / (masse + _p.masseAjoutee_kg);
+
+    e.vitesseZ_mps += acc * dt;
+    e.profondeur_m += e.vitesseZ_mps * dt;
+
+    // Surface et fond : butées sans rebond
+    if (e.profondeur_m <= 0.0f && e.vitesseZ_mps <= 0.0f) {
+        e.profondeur_m = 0.0f;
+        e.vitesseZ_mps = 0.0f;
+        acc = 0.0f;
+    }
+    if (e.profondeur_m >= _p.profondeurFond_m && e.vitesseZ_mps >= 0.0f) {
+        e.profondeur_m = _p.profondeurFond_m;
+        e.vitesseZ_mps = 0.0f;
+        acc = 0.0f;
+    }
+    e.accelerationZ_mps2 = acc;
+
+    // 3. Avance
+    float poussee_N = _p.pousseeMax_N * _pwm / 255.0f;
+    e.vitesse_mps += (poussee_N - _p.traineeX_kg_m * e.vitesse_mps * fabsf(e.vitesse_mps)) / masse * dt;
+
+    // 4. Gouvernail : tourne tant que le servo est commandé, jusqu'aux butées
+    e.gouvernail += _rotationGouvernail * dt / _p.dureeGouvernail_s;
+    if (e.gouvernail >  1.0f) e.gouvernail =  1.0f;
+    if (e.gouvernail < -1.0f) e.gouvernail = -1.0f;
+
+    // 5. Lacet : le gouvernail n'agit qu'en mouvement
+    float lacetCible = _p.lacet_dps_par_mps * e.vitesse_mps * e.gouvernail;
+    e.lacet_dps += (lacetCible - e.lacet_dps) * dt / _p.constanteLacet_s;
+    e.cap_deg   += e.lacet_dps * dt;
+    if (e.cap_deg >= 360.0f) e.cap_deg -= 360.0f;
+    if (e.cap_deg <    0.0f) e.cap_deg += 360.0f;
+
+    // 6. Batterie
+    e.courantServo_mA = bouge ? _p.courantServo_mA : _p.courantServoMaintien_mA;
+    e.courant_mA      = _p.courantRepos_mA + e.courantServo_mA
+                      + _p.courantPropulsionMax_mA * _pwm / 255.0f;
+    e.consomme_mAh   += e.courant_mA * dt / 3600.0f;
+    e.consommeServo_mAh += e.courantServo_mA * dt / 3600.0f;
+
+    e.tension_V = _p.tensionVide_V + (_p.tensionPleine_V - _p.tensionVide_V) * soc_percent() / 100.0f
+                - _p.resistanceInterne_ohm * e.courant_mA / 1000.0f;
+}
+
+float ModeleHydro::soc_percent() const
+{
+    float soc = 100.0f * (1.0f - _etat.consomme_mAh / _p.capacite_mAh);
+    return (soc < 0.0f) ? 0.0f : soc;
+}
+
+float ModeleHydro::mesureProfondeur_m()
+{
+    return _etat.profondeur_m + _p.bruitProfondeur_m * aleatoire();
+}
+
+// xorshift32 : reproductible d'une machine à l'autre
+float ModeleHydro::aleatoire()
+{
+    _alea ^= _alea << 13;
+    _alea ^= _alea >> 17;
+    _alea ^= _alea << 5;
+    return (float)(_alea >> 8) / (float)(1UL << 23) - 1.0f;
+}
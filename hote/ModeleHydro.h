@@ -0,0 +1,122 @@
+#ifndef MODELE_HYDRO_H
+#define MODELE_HYDRO_H
+
+#include <stdint.h>
+
+// =====================
+//   Modèle hydrodynamique du poisson
+// =====================
+//
+// Modèle de l'installation pour la simulation en boucle fermée (voir
+// Simulation.h). Code pur, sans Arduino ni matériel :
+//
+//   angle servo -> crémaillère (vitesse bornée) -> eau dans le ballast
+//     -> poids - poussée d'Archimède - traînée -> dynamique verticale
+//   PWM propulsion -> poussée -> vitesse d'avance (traînée quadratique)
+//   servo de gouvernail à rotation continue (-1/0/1) -> position bornée
+//     -> gouvernail x vitesse -> taux de lacet (1er ordre) -> cap
+//   courants (repos + servo + propulsion) -> décharge et tension batterie
+//
+// Profondeur et accélérations positives vers le bas. Intégration d'Euler
+// semi-implicite à pas fixe (PAS_S), quel que soit le dt demandé.
+
+struct ParametresHydro
+{
+    // Vertical
+    float masse_kg;            // poisson complet, ballast vide
+    float volumeBallast_m3;    // eau embarquée servo à 180°
+    float angleEquilibre_deg;  // angle de flottabilité nulle (fixe le volume de coque)
+    float masseAjoutee_kg;     // masse d'eau entraînée en vertical
+    float traineeZ_kg_m;       // 0.5 * rho * Cd * A (vertical)
+    float profondeurFond_m;    // fond du bassin
+
+    // Actionneurs
+    float vitesseServo_dps;    // vitesse de la crémaillère sous charge
+
+    // Avance et lacet
+    float pousseeMax_N;        // PWM 255
+    float traineeX_kg_m;       // 0.5 * rho * Cd * A (avance)
+    float lacet_dps_par_mps;   // taux de lacet gouvernail en butée, par m/s d'avance
+    float constanteLacet_s;
+    float dureeGouvernail_s;   // rotation du centre à la butée
+
+    // Batterie (2S Li-ion)
+    float capacite_mAh;
+    float tensionPleine_V;
+    float tensionVide_V;
+    float resistanceInterne_ohm;
+    float courantRepos_mA;
+    float courantServo_mA;           // crémaillère en mouvement
+    float courantServoMaintien_mA;   // servo à l'arrêt
+    float courantPropulsionMax_mA;
+
+    // Capteur de profondeur
+    float    bruitProfondeur_m;  // bruit uniforme +/- (résolution + turbulence)
+    uint32_t graine;             // même graine -> même plongée
+
+    ParametresHydro();
+};
+
+struct EtatHydro
+{
+    float profondeur_m;
+    float vitesseZ_mps;
+    float accelerationZ_mps2;
+    float angleBallast_deg;   // position réelle de la crémaillère
+
+    float vitesse_mps;        // avance
+    float cap_deg;            // [0 ; 360[
+    float lacet_dps;
+    float gouvernail;         // [-1 ; 1], + = droite
+
+    float consomme_mAh;
+    float consommeServo_mAh;  // part du servo ballast
+    float tension_V;
+    float courant_mA;         // total (voie batterie)
+    float courantServo_mA;    // servo ballast (voie mesure)
+
+    bool  fuite;
+};
+
+class ModeleHydro
+{
+public:
+    static constexpr float PAS_S = 0.001f;
+
+    explicit ModeleHydro(const ParametresHydro& p = ParametresHydro());
+
+    void reset();
+    void setParametres(const ParametresHydro& p);
+    const ParametresHydro& parametres() const { return _p; }
+
+    // Commandes appliquées jusqu'au prochain appel. rotationGouvernail :
+    // sens de rotation du servo de direction (-1 gauche, 0 arrêt, 1 droite)
+    void commande(float angleServo_deg, uint8_t pwmPropulsion, int8_t rotationGouvernail);
+
+    // Avance de dt_s, par pas fixes de PAS_S
+    void avance(float dt_s);
+
+    void declencheFuite() { _etat.fuite = true; }
+
+    const EtatHydro& etat() const { return _etat; }
+
+    // Mesures capteurs (bruitées) tirées de l'état
+    float mesureProfondeur_m();
+    float soc_percent() const;
+
+private:
+    ParametresHydro _p;
+    EtatHydro       _etat;
+    float           _volumeCoque_m3;
+
+    float    _consigneServo_deg;
+    uint8_t  _pwm;
+    int8_t   _rotationGouvernail;
+    float    _reste_s;   // fraction de pas pas encore intégrée
+    uint32_t _alea;
+
+    void  pas(float dt_s);
+    float aleatoire();   // [-1 ; 1]
+};
+
+#endif
@@ -0,0 +1,87 @@
+#include "Servo.h"
+#include "Hote.h"
+
+static uint8_t   s_nbServos = 0;
+static EtatServo s_servos[HOTE_NB_BROCHES];
+
+void hoteReinitialiseServos()
+{
+    memset(s_servos, 0, sizeof(s_servos));
+    s_nbServos = 0;
+}
+
+const EtatServo& hoteServo(uint8_t pin)
+{
+    static const EtatServo aucun = { false, 0, 0, 0, 0 };
+    return pin < HOTE_NB_BROCHES ? s_servos[pin] : aucun;
+}
+
+static EtatServo* etat(int pin)
+{
+    return (pin >= 0 && pin < HOTE_NB_BROCHES) ? &s_servos[pin] : nullptr;
+}
+
+Servo::Servo()
+: _index(s_nbServos < MAX_SERVOS ? s_nbServos++ : INVALID_SERVO)
+, _pin(-1)
+, _min(MIN_PULSE_WIDTH)
+, _max(MAX_PULSE_WIDTH)
+{
+}
+
+uint8_t Servo::attach(int pin)
+{
+    return attach(pin, MIN_PULSE_WIDTH, MAX_PULSE_WIDTH);
+}
+
+uint8_t Servo::attach(int pin, int min, int max)
+{
+    if (_index == INVALID_SERVO || !etat(pin)) return INVALID_SERVO;
+
+    _pin = pin;
+    _min = min;
+    _max = max;
+    etat(pin)->attache = true;
+    etat(pin)->min_us  = min;
+    etat(pin)->max_us  = max;
+    return _index;
+}
+
+void Servo::detach()
+{
+    if (etat(_pin)) etat(_pin)->attache = false;
+    _pin = -1;
+}
+
+void Servo::write(int value)
+{
+    if (value < MIN_PULSE_WIDTH) {
+        value = constrain(value, 0, 180);
+        value = _min + (long)value * (_max - _min) / 180;
+    }
+    writeMicroseconds(value);
+}
+
+void Servo::writeMicroseconds(int value)
+{
+    EtatServo* e = etat(_pin);
+    if (!e) return;
+    e->impulsion_us = constrain(value, _min, _max);
+    e->ecritures++;
+}
+
+int Servo::readMicroseconds()
+{
+    EtatServo* e = etat(_pin);
+    return e ? e->impulsion_us : 0;
+}
+
+int Servo::read()
+{
+    return (int)((long)(readMicroseconds() - _min + 1) * 180 / (_max - _min));
+}
+
+bool Servo::attached()
+{
+    return etat(_pin) && etat(_pin)->attache;
+}
@@ -0,0 +1,54 @@
+#ifndef HOTE_SERVO_H
+#define HOTE_SERVO_H
+
+#include <Arduino.h>
+
+// =====================
+//   Servo factice
+// =====================
+//
+// Même contrat que la librairie Servo du cœur SAMD : index attribué à la
+// construction, attach() retourne cet index (0 pour le premier servo) ou
+// INVALID_SERVO. Chaque impulsion est enregistrée par broche (hoteServo).
+
+#define MIN_PULSE_WIDTH      544
+#define MAX_PULSE_WIDTH      2400
+#define DEFAULT_PULSE_WIDTH  1500
+#define MAX_SERVOS           12
+#define INVALID_SERVO        255
+
+class Servo
+{
+public:
+    Servo();
+
+    uint8_t attach(int pin);
+    uint8_t attach(int pin, int min, int max);
+    void    detach();
+
+    void write(int value);               // angle si < MIN_PULSE_WIDTH, sinon µs
+    void writeMicroseconds(int value);
+    int  read();                          // angle 0-180
+    int  readMicroseconds();
+    bool attached();
+
+private:
+    uint8_t _index;
+    int     _pin;
+    int     _min;
+    int     _max;
+};
+
+// --- Pilotage hôte ---
+
+struct EtatServo
+{
+    bool     attache;
+    int      impulsion_us;   // dernière impulsion écrite (0 : aucune)
+    int      min_us, max_us; // bornes données à attach() (0° / 180°)
+    uint32_t ecritures;      // write() + writeMicroseconds()
+};
+
+const EtatServo& hoteServo(uint8_t pin);
+
+#endif
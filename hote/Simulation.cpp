@@ -0,0 +1,405 @@
+#include "Simulation.h"
+#include "Hote.h"
+#include <Servo.h>
+#include <INA236.h>
+#include "CommandMotor.h"
+#include "Capteurs.h"
+#include "StateMachine.h"
+#include "Journal.h"
+
+#include <chrono>
+
+static const uint32_t kDepartMission_ms = 1000;   // capteurs publiés avant le départ
+static const uint32_t kPriseEnCompte_ms = 1000;   // touche 'a' -> mission en cours
+static const float    kMargeBilan_m     = 0.05f;  // "atteinte" au sens du bilan
+static const uint32_t kUrgenceMax_ms    = 20000;  // en urgence : laisse le temps de remonter
+static const float    kSurface_m        = 0.05f;
+
+// Câblage de CodePoisson.ino
+static const uint8_t kBrocheServoBallast    = 3;
+static const uint8_t kBrochePropulsion      = 4;   // D4 : marche avant
+static const uint8_t kBrocheServoDirection  = 6;
+static const uint8_t kBrocheFuite           = 1;
+static const uint8_t kAdresseInaBatterie    = 0x40;
+static const uint8_t kAdresseInaMesure      = 0x41;
+
+// FT90R : arrêt à mi-course, hors de cette marge le servo tourne
+static const int     kMargeArretDirection_us = 50;
+
+// Pression vue par le MS5837 (même référence et densité que Capteurs)
+static const float   kPressionSurface_mbar  = 1013.0f;
+static const float   kRhoG_Pa_m             = 997.0f * 9.80665f;
+static const float   kTemperatureEau_C      = 18.0f;
+
+static uint64_t tempsReel_us()
+{
+    using namespace std::chrono;
+    return (uint64_t)duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+// =====================
+//   Scénario
+// =====================
+
+ScenarioSim::ScenarioSim()
+: cible_m(0.3f)
+, kp(30.0f)
+, ki(10.0f)
+, kd(90.0f)
+, angleNeutre_deg(30.0f)
+, angleEquilibre_deg(30.0f)
+, servo_dps(90.0f)
+, bandeMorte_deg(1.0f)
+, hysteresis_deg(1.0f)
+, dureeAvance_ms(10000)
+, dureeVirage_ms(3000)
+, timeoutDescente_ms(30000)
+, timeoutRemontee_ms(15000)
+, fuite_ms(0)
+, graine(1)
+, csv_ms(100)
+, dureeMax_ms(120000)
+, depassementMax_mm(0)
+, erreurMoyMax_mm(0)
+{
+}
+
+struct CleReelle { const char* nom; float    ScenarioSim::*champ; };
+struct CleEntier { const char* nom; uint32_t ScenarioSim::*champ; };
+
+static const CleReelle kClesReelles[] = {
+    { "cible_m",            &ScenarioSim::cible_m },
+    { "kp",                 &ScenarioSim::kp },
+    { "ki",                 &ScenarioSim::ki },
+    { "kd",                 &ScenarioSim::kd },
+    { "angleNeutre_deg",    &ScenarioSim::angleNeutre_deg },
+    { "angleEquilibre_deg", &ScenarioSim::angleEquilibre_deg },
+    { "servo_dps",          &ScenarioSim::servo_dps },
+    { "bandeMorte_deg",     &ScenarioSim::bandeMorte_deg },
+    { "hysteresis_deg",     &ScenarioSim::hysteresis_deg },
+};
+
+static const CleEntier kClesEntieres[] = {
+    { "dureeAvance_ms",     &ScenarioSim::dureeAvance_ms },
+    { "dureeVirage_ms",     &ScenarioSim::dureeVirage_ms },
+    { "timeoutDescente_ms", &ScenarioSim::timeoutDescente_ms },
+    { "timeoutRemontee_ms", &ScenarioSim::timeoutRemontee_ms },
+    { "fuite_ms",           &ScenarioSim::fuite_ms },
+    { "graine",             &ScenarioSim::graine },
+    { "csv_ms",             &ScenarioSim::csv_ms },
+    { "dureeMax_ms",        &ScenarioSim::dureeMax_ms },
+    { "depassementMax_mm",  &ScenarioSim::depassementMax_mm },
+    { "erreurMoyMax_mm",    &ScenarioSim::erreurMoyMax_mm },
+};
+
+bool ScenarioSim::regle(const char* cle, const char* valeur)
+{
+    char* fin = nullptr;
+
+    for (const CleReelle& c : kClesReelles) {
+        if (strcmp(cle, c.nom) != 0) continue;
+        float v = strtof(valeur, &fin);
+        if (fin == valeur || *fin != '\0' || !isfinite(v)) return false;
+        this->*c.champ = v;
+        return true;
+    }
+
+    for (const CleEntier& c : kClesEntieres) {
+        if (strcmp(cle, c.nom) != 0) continue;
+        if (*valeur == '-') return false;
+        unsigned long v = strtoul(valeur, &fin, 10);
+        if (fin == valeur || *fin != '\0' || v > 0xFFFFFFFFUL) return false;
+        this->*c.champ = (uint32_t)v;
+        return true;
+    }
+    return false;
+}
+
+static char* sansEspaces(char* debut, char* fin)
+{
+    while (debut < fin && isspace((unsigned char)*debut))    debut++;
+    while (fin > debut && isspace((unsigned char)fin[-1]))   fin--;
+    *fin = '\0';
+    return debut;
+}
+
+bool ScenarioSim::regleLigne(const char* ligne)
+{
+    char tampon[96];
+    size_t n = strlen(ligne);
+    if (n >= sizeof(tampon)) return false;
+    memcpy(tampon, ligne, n + 1);
+
+    char* diese = strchr(tampon, '#');
+    if (diese) *diese = '\0';
+
+    char* egal = strchr(tampon, '=');
+    if (!egal) return *sansEspaces(tampon, tampon + strlen(tampon)) == '\0';
+
+    char* valeur = sansEspaces(egal + 1, egal + 1 + strlen(egal + 1));
+    char* cle    = sansEspaces(tampon, egal);
+    return regle(cle, valeur);
+}
+
+// =====================
+//   Boucle fermée
+// =====================
+
+Simulation::Simulation(CommandMotor& motor, Capteurs& capteurs, StateMachine& stateMachine)
+: _motor(motor)
+, _capteurs(capteurs)
+, _stateMachine(stateMachine)
+, _modele(ParametresHydro())
+, _csv(nullptr)
+, _angleServo_deg(0.0f)
+, _pwm(0)
+, _rotationGouvernail(0)
+, _debut_ms(0)
+, _debutReel_us(0)
+, _prochainCsv_ms(0)
+, _lancee(false)
+, _partie(false)
+, _terminee(false)
+, _echec(false)
+, _atteinte_ms(0)
+, _urgence_ms(0)
+, _depassement_m(0.0f)
+, _sommeErreur_m(0.0f)
+, _nErreur(0)
+{
+}
+
+Simulation::~Simulation()
+{
+    Wire.debranche(FauxBNO055::ADRESSE);
+    Wire.debranche(FauxMS5837::ADRESSE);
+}
+
+void Simulation::branche()
+{
+    ParametresHydro p = _modele.parametres();
+    p.angleEquilibre_deg = _scenario.angleEquilibre_deg;
+    p.graine             = _scenario.graine;
+    _modele.setParametres(p);   // remet aussi l'état à zéro
+
+    _bno.regleCalibration(3, 3, 3, 3);
+    _baro.regleModele02BA(true);   // Capteurs::begin() configure un 02BA
+    Wire.branche(FauxBNO055::ADRESSE, &_bno);
+    Wire.branche(FauxMS5837::ADRESSE, &_baro);
+    publieMesures();
+}
+
+void Simulation::begin()
+{
+    _stateMachine.setTargetDepth(_scenario.cible_m);
+    _stateMachine.setMoveDuration(_scenario.dureeAvance_ms);
+    _stateMachine.setTurnDuration(_scenario.dureeVirage_ms);
+    _stateMachine.setDescentTimeout(_scenario.timeoutDescente_ms);
+    _stateMachine.setAscentTimeout(_scenario.timeoutRemontee_ms);
+    _stateMachine.asserv().setGains(_scenario.kp, _scenario.ki, _scenario.kd);
+    _stateMachine.asserv().setAngleNeutre(_scenario.angleNeutre_deg);
+    _motor.setLimiteurServo(_scenario.servo_dps, _scenario.bandeMorte_deg, _scenario.hysteresis_deg);
+    _motor.resetStatsServo();
+
+    _debut_ms       = millis();
+    _debutReel_us   = tempsReel_us();
+    _prochainCsv_ms = 0;
+
+    Print& csv = _csv ? *_csv : Serial;
+    if (!_csv) csv.print("SIM,");
+    csv.println("t_ms,etat,cible_m,prof_m,prof_mesuree_m,vz_mps,servo_cmd_deg,"
+                "servo_reel_deg,pwm,vitesse_mps,cap_deg,tension_V,courant_mA,soc");
+}
+
+void Simulation::avance(uint32_t dt_us)
+{
+    if (_terminee) return;
+
+    // Les sorties ne changent que pendant les tâches : relevées une fois
+    lisActionneurs();
+    _modele.commande(_angleServo_deg, _pwm, _rotationGouvernail);
+
+    while (dt_us > 0 && !_terminee) {
+        uint32_t pas = (dt_us < 1000) ? dt_us : 1000;
+        _modele.avance(pas * 1e-6f);
+        hoteAvance_us(pas);
+        dt_us -= pas;
+
+        evenements(millis() - _debut_ms);
+    }
+
+    // Et les puces ne sont relues qu'à la tâche suivante
+    publieMesures();
+}
+
+// =====================
+//   Couplage avec la couche factice
+// =====================
+
+void Simulation::lisActionneurs()
+{
+    const EtatServo& ballast = hoteServo(kBrocheServoBallast);
+    if (ballast.impulsion_us > 0 && ballast.max_us > ballast.min_us) {
+        _angleServo_deg = (float)(ballast.impulsion_us - ballast.min_us) * 180.0f
+                        / (float)(ballast.max_us - ballast.min_us);
+    }
+
+    int pwm = hoteBroche(kBrochePropulsion).pwm;
+    _pwm = (uint8_t)constrain(pwm, 0, 255);
+
+    // Impulsion courte = vers la droite (CommandMotor : write(0))
+    const EtatServo& direction = hoteServo(kBrocheServoDirection);
+    int milieu = (direction.min_us + direction.max_us) / 2;
+    _rotationGouvernail = 0;
+    if (direction.attache && direction.impulsion_us > 0) {
+        if      (direction.impulsion_us < milieu - kMargeArretDirection_us) _rotationGouvernail =  1;
+        else if (direction.impulsion_us > milieu + kMargeArretDirection_us) _rotationGouvernail = -1;
+    }
+}
+
+void Simulation::publieMesures()
+{
+    const EtatHydro& e = _modele.etat();
+
+    // Repère BNO055 (z vers le haut) : au repos ACC = GRV = +g, LIA opposé
+    // à GRV pour une accélération vers le bas ; cap croissant vers la
+    // droite, gz positif vers la gauche
+    _bno.regleEuler(e.cap_deg, 0.0f, 0.0f);
+    _bno.regleAcceleration(0.0f, 0.0f, 9.81f - e.accelerationZ_mps2);
+    _bno.regleLineaire(0.0f, 0.0f, -e.accelerationZ_mps2);
+    _bno.regleGravite(0.0f, 0.0f, 9.81f);
+    _bno.regleGyro(0.0f, 0.0f, -e.lacet_dps);
+
+    float profondeur_m = _modele.mesureProfondeur_m();
+    _baro.reglePression(kPressionSurface_mbar + kRhoG_Pa_m * profondeur_m / 100.0f, kTemperatureEau_C);
+
+    // Voie batterie : courant total ; voie mesure : servo ballast
+    FauxINA236& batterie = hoteIna(kAdresseInaBatterie);
+    batterie.tension_V  = e.tension_V;
+    batterie.courant_mA = e.courant_mA;
+    FauxINA236& mesure = hoteIna(kAdresseInaMesure);
+    mesure.tension_V  = e.tension_V;
+    mesure.courant_mA = e.courantServo_mA;
+
+    if (e.fuite && !hoteBroche(kBrocheFuite).entree) hoteRegleBroche(kBrocheFuite, HIGH);
+}
+
+// =====================
+//   Scénario et bilan
+// =====================
+
+void Simulation::evenements(uint32_t t)
+{
+    const EtatHydro& e = _modele.etat();
+    FishState etat = _stateMachine.getCurrentState();
+
+    if (!_lancee && t >= kDepartMission_ms) {
+        _lancee = true;
+        hoteSerieEntree("a");   // mode autonome, comme au clavier
+    }
+
+    if (_scenario.fuite_ms && !e.fuite && t >= _scenario.fuite_ms) {
+        LOG_ALERTE("SIM", "Fuite simulee");
+        _modele.declencheFuite();
+    }
+
+    if (_scenario.csv_ms && t >= _prochainCsv_ms) {
+        _prochainCsv_ms = t + _scenario.csv_ms;
+        ecritCsv(t);
+    }
+
+    // Tenue de profondeur : de la descente à la fin du virage
+    if (etat == FishState::DESCENDING || etat == FishState::MOVING || etat == FishState::TURNING) {
+        float erreur = e.profondeur_m - _scenario.cible_m;
+        if (erreur > _depassement_m) _depassement_m = erreur;
+        if (!_atteinte_ms && fabsf(erreur) < kMargeBilan_m) _atteinte_ms = t;
+        if (etat != FishState::DESCENDING) {
+            _sommeErreur_m += fabsf(erreur);
+            _nErreur++;
+        }
+    }
+
+    if (!_lancee) return;
+
+    // La touche est lue par la tâche de contrôle suivante
+    if (!_partie) {
+        if (_stateMachine.isRunning())                      _partie = true;
+        else if (t - kDepartMission_ms > kPriseEnCompte_ms) bilan("sans_depart", t);
+        return;
+    }
+
+    if (etat == FishState::EMERGENCY) {
+        if (!_urgence_ms) _urgence_ms = t;
+        if (e.profondeur_m < kSurface_m)          bilan("urgence_surface", t);
+        else if (t - _urgence_ms > kUrgenceMax_ms) bilan("urgence_fond", t);
+    }
+    else if (!_stateMachine.isRunning()) {
+        bilan("fin_mission", t);
+    }
+    else if (t >= _scenario.dureeMax_ms) {
+        bilan("duree_max", t);
+    }
+}
+
+void Simulation::ecritCsv(uint32_t t)
+{
+    const EtatHydro& e = _modele.etat();
+    const CapteursData& d = _capteurs.snapshot();
+
+    Print& csv = _csv ? *_csv : Serial;
+    if (!_csv) csv.print("SIM,");
+    csv.print(t);                                  csv.print(',');
+    csv.print((int)_stateMachine.getCurrentState()); csv.print(',');
+    csv.print(_stateMachine.getTargetDepth(), 3);  csv.print(',');
+    csv.print(e.profondeur_m, 4);                  csv.print(',');
+    csv.print(d.depth.depth_m, 4);                 csv.print(',');
+    csv.print(e.vitesseZ_mps, 4);                  csv.print(',');
+    csv.print(_angleServo_deg, 1);                 csv.print(',');
+    csv.print(e.angleBallast_deg, 1);              csv.print(',');
+    csv.print(_pwm);                               csv.print(',');
+    csv.print(e.vitesse_mps, 3);                   csv.print(',');
+    csv.print(e.cap_deg, 1);                       csv.print(',');
+    csv.print(d.power.busVoltage_V, 3);            csv.print(',');
+    csv.print(d.power.current_mA, 0);              csv.print(',');
+    csv.println(_capteurs.getBatteryPercent(), 2);
+}
+
+void Simulation::bilan(const char* raison, uint32_t t)
+{
+    _terminee = true;
+
+    uint64_t reel_us = tempsReel_us() - _debutReel_us;
+    float erreurMoy_m = _nErreur ? _sommeErreur_m / _nErreur : 0.0f;
+    long  depassement_mm = (long)(_depassement_m * 1000.0f);
+    long  erreurMoy_mm   = (long)(erreurMoy_m * 1000.0f);
+
+    Serial.print("SIM,BILAN,raison=");   Serial.print(raison);
+    Serial.print(",t_ms=");              Serial.print(t);
+    Serial.print(",atteinte_ms=");       Serial.print(_atteinte_ms);
+    Serial.print(",depassement_mm=");    Serial.print(depassement_mm);
+    Serial.print(",erreur_moy_mm=");     Serial.print(erreurMoy_mm);
+    const CommandMotor::StatsServo& servo = _motor.statsServo();
+    Serial.print(",debattement_deg=");   Serial.print((long)servo.parcours_deg());
+    Serial.print(",servo_commandes=");   Serial.print(servo.commandes);
+    Serial.print(",servo_evitees=");     Serial.print(servo.evitees);
+    Serial.print(",servo_ecritures=");   Serial.print(servo.ecritures);
+    Serial.print(",servo_identiques=");  Serial.print(servo.identiques);
+    Serial.print(",energie_mAh=");       Serial.print(_modele.etat().consomme_mAh, 2);
+    Serial.print(",servo_mAh=");         Serial.print(_modele.etat().consommeServo_mAh, 2);
+    Serial.print(",facteur_temps_reel="); Serial.println(reel_us ? (float)t * 1000.0f / reel_us : 0.0f, 1);
+
+    verifieLimite("depassement_mm", depassement_mm, _scenario.depassementMax_mm);
+    verifieLimite("erreur_moy_mm", erreurMoy_mm, _scenario.erreurMoyMax_mm);
+}
+
+void Simulation::verifieLimite(const char* nom, long valeur, uint32_t limite)
+{
+    if (limite == 0 || valeur <= (long)limite) return;
+    _echec = true;
+    Serial.print("SIM,ECHEC,");
+    Serial.print(nom);
+    Serial.print('=');
+    Serial.print(valeur);
+    Serial.print(",max=");
+    Serial.println(limite);
+}
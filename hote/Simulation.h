@@ -0,0 +1,137 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include <Arduino.h>
+#include "ModeleHydro.h"
+#include "FauxCapteurs.h"
+
+class CommandMotor;
+class Capteurs;
+class StateMachine;
+
+// =====================
+//   Simulation en boucle fermée (poisson_sim)
+// =====================
+//
+// Le firmware complet, compilé tel quel, tourne sur la couche factice de
+// hote/ ; seul le banc d'essai change. ModeleHydro remplace le poisson et
+// son bassin :
+//
+//   modèle -> puces factices : BNO055 (cap, lacet, accélération verticale),
+//             MS5837 (pression de la profondeur bruitée), INA236 0x40 / 0x41
+//             (tension, courant total / servo ballast), broche fuite D1
+//   broches et servos factices -> modèle : impulsion du servo ballast (D3),
+//             PWM propulsion (D4), sens du servo de direction (D6)
+//
+// Capteurs, CommandMotor, StateMachine, AsservProfond, Safety et Controller
+// ne savent rien de la simulation. La mission est lancée par la touche 'a',
+// comme depuis le moniteur série.
+//
+// Le temps est celui de la couche factice : quand aucune tâche n'est due,
+// la boucle du simulateur saute directement à la prochaine échéance
+// (avance()). Le rapport temps simulé / temps réel est donné dans le bilan.
+//
+// Sortie CSV sur Serial, lignes préfixées "SIM," (le journal reste
+// intercalé), ou brute dans la sortie donnée à setSortieCsv() (fichier) :
+//   t_ms,etat,cible_m,prof_m,prof_mesuree_m,vz_mps,servo_cmd_deg,
+//   servo_reel_deg,pwm,vitesse_mps,cap_deg,tension_V,courant_mA,soc
+// Bilan toujours sur Serial, une fois en fin de plongée :
+//   SIM,BILAN,cle=valeur,...
+// suivie d'une ligne "SIM,ECHEC,..." par limite du scénario dépassée.
+//
+// Scénario : ScenarioSim, valeurs par défaut réglables clé par clé avant
+// begin() (fichier "cle=valeur" lu par poisson_sim).
+
+struct ScenarioSim
+{
+    float    cible_m;              // profondeur de mission
+    float    kp;                   // AsservProfond : deg/m
+    float    ki;                   // AsservProfond : deg/(m.s)
+    float    kd;                   // AsservProfond : deg.s/m
+    float    angleNeutre_deg;      // AsservProfond : neutre supposé
+    float    angleEquilibre_deg;   // modèle : neutre réel (écart = défaut de trim)
+    float    servo_dps;            // CommandMotor : vitesse max ballast, 0 = sans limite
+    float    bandeMorte_deg;       // CommandMotor : bande morte ballast
+    float    hysteresis_deg;       // CommandMotor : en plus au changement de sens
+    uint32_t dureeAvance_ms;
+    uint32_t dureeVirage_ms;
+    uint32_t timeoutDescente_ms;
+    uint32_t timeoutRemontee_ms;
+    uint32_t fuite_ms;             // instant de la fuite simulée, 0 = aucune
+    uint32_t graine;               // bruit du capteur de profondeur
+    uint32_t csv_ms;               // période des lignes CSV, 0 = bilan seul
+    uint32_t dureeMax_ms;
+    uint32_t depassementMax_mm;    // bilan : au-delà, ligne "SIM,ECHEC" (0 = non vérifié)
+    uint32_t erreurMoyMax_mm;      // idem pour l'erreur moyenne de tenue
+
+    ScenarioSim();
+
+    // "cle=valeur" (espaces ignorés) ; ligne vide ou commentaire '#' : rien.
+    // Clés : noms des champs ci-dessus. false : clé inconnue ou valeur invalide.
+    bool regleLigne(const char* ligne);
+    bool regle(const char* cle, const char* valeur);
+};
+
+class Simulation
+{
+public:
+    Simulation(CommandMotor& motor, Capteurs& capteurs, StateMachine& stateMachine);
+    ~Simulation();
+
+    // A régler avant begin()
+    ScenarioSim& scenario() { return _scenario; }
+    void setSortieCsv(Print& sortie) { _csv = &sortie; }
+
+    // Avant setup() : puces factices branchées et réglées sur le modèle au repos
+    void branche();
+
+    // Après setup() : scénario appliqué au firmware, t = 0 du scénario
+    void begin();
+
+    // Aucune tâche due : modèle et horloge avancés de dt_us, par pas de 1 ms
+    void avance(uint32_t dt_us);
+
+    bool terminee() const { return _terminee; }
+    bool echec() const { return _echec; }   // limites du scénario dépassées
+
+    ModeleHydro& modele() { return _modele; }
+
+private:
+    CommandMotor& _motor;
+    Capteurs&     _capteurs;
+    StateMachine& _stateMachine;
+    FauxBNO055    _bno;
+    FauxMS5837    _baro;
+    ModeleHydro   _modele;
+    ScenarioSim   _scenario;
+    Print*        _csv;            // nullptr : Serial, lignes préfixées
+
+    // Actionneurs relevés sur les broches et servos factices
+    float   _angleServo_deg;
+    uint8_t _pwm;
+    int8_t  _rotationGouvernail;
+
+    uint32_t _debut_ms;        // t = 0 du scénario (horloge factice)
+    uint64_t _debutReel_us;    // horloge du PC au même instant
+    uint32_t _prochainCsv_ms;
+    bool     _lancee;          // touche 'a' envoyée
+    bool     _partie;          // mission en cours vue par la machine d'état
+    bool     _terminee;
+    bool     _echec;
+
+    // Bilan de plongée
+    uint32_t _atteinte_ms;     // première entrée dans +/- kMargeBilan_m, 0 = jamais
+    uint32_t _urgence_ms;
+    float    _depassement_m;
+    float    _sommeErreur_m;
+    uint32_t _nErreur;
+
+    void lisActionneurs();
+    void publieMesures();
+    void evenements(uint32_t t_ms);
+    void ecritCsv(uint32_t t_ms);
+    void bilan(const char* raison, uint32_t t_ms);
+    void verifieLimite(const char* nom, long valeur, uint32_t limite);
+};
+
+#endif
@@ -0,0 +1,281 @@
+#include "WiFiNINA.h"
+
+WiFiClass WiFi;
+
+struct SocketFaux
+{
+    uint16_t    port;
+    std::string entree;
+    size_t      lu;
+    std::string sortie;
+    bool        connecte;       // côté PC
+    bool        fermeFirmware;  // stop()
+    bool        vu;             // déjà rendu par WiFiServer::available()
+};
+
+static std::vector<SocketFaux> s_sockets;
+static std::vector<PaquetUdp>  s_udpRecus;
+static std::vector<PaquetUdp>  s_udpEmis;
+static bool    s_apDisponible = true;
+static uint8_t s_statut       = WL_IDLE_STATUS;
+
+static SocketFaux* socket(int sock)
+{
+    return (sock >= 0 && (size_t)sock < s_sockets.size()) ? &s_sockets[sock] : nullptr;
+}
+
+// --- Pilotage hôte ---
+
+void hoteWifiDisponible(bool disponible) { s_apDisponible = disponible; }
+
+void hoteWifiCoupe()
+{
+    if (s_statut == WL_CONNECTED) s_statut = WL_CONNECTION_LOST;
+    for (size_t i = 0; i < s_sockets.size(); i++) s_sockets[i].connecte = false;
+}
+
+int hoteConnexionTcp(uint16_t port, const char* requete)
+{
+    SocketFaux s;
+    s.port = port;
+    s.entree = requete ? requete : "";
+    s.lu = 0;
+    s.connecte = true;
+    s.fermeFirmware = false;
+    s.vu = false;
+    s_sockets.push_back(s);
+    return (int)s_sockets.size() - 1;
+}
+
+void hoteTcpAjoute(int sock, const char* octets)
+{
+    if (SocketFaux* s = socket(sock)) s->entree += octets;
+}
+
+void hoteTcpDeconnecte(int sock)
+{
+    if (SocketFaux* s = socket(sock)) s->connecte = false;
+}
+
+const std::string& hoteTcpSortie(int sock)
+{
+    static const std::string vide;
+    SocketFaux* s = socket(sock);
+    return s ? s->sortie : vide;
+}
+
+bool hoteTcpFermeParFirmware(int sock)
+{
+    SocketFaux* s = socket(sock);
+    return s && s->fermeFirmware;
+}
+
+void hoteUdpRecoit(const PaquetUdp& p)        { s_udpRecus.push_back(p); }
+const std::vector<PaquetUdp>& hoteUdpEmis()   { return s_udpEmis; }
+
+void hoteReinitialiseWifi()
+{
+    s_sockets.clear();
+    s_udpRecus.clear();
+    s_udpEmis.clear();
+    s_apDisponible = true;
+    s_statut = WL_IDLE_STATUS;
+}
+
+// --- IPAddress ---
+
+size_t IPAddress::printTo(Print& p) const
+{
+    size_t n = 0;
+    for (int i = 0; i < 4; i++) {
+        if (i) n += p.print('.');
+        n += p.print((*this)[i], DEC);
+    }
+    return n;
+}
+
+// --- WiFiClass ---
+
+uint8_t WiFiClass::status() { return s_statut; }
+
+int WiFiClass::begin(const char*, const char*)
+{
+    s_statut = s_apDisponible ? WL_CONNECTED : WL_CONNECT_FAILED;
+    return s_statut;
+}
+
+void WiFiClass::disconnect()
+{
+    s_statut = WL_DISCONNECTED;
+    for (size_t i = 0; i < s_sockets.size(); i++) s_sockets[i].connecte = false;
+}
+
+const char* WiFiClass::SSID() { return s_statut == WL_CONNECTED ? "hote" : ""; }
+
+IPAddress WiFiClass::localIP()
+{
+    return s_statut == WL_CONNECTED ? IPAddress(192, 168, 137, 2) : IPAddress();
+}
+
+// --- WiFiServer ---
+
+// Comme le NINA : une connexion nouvelle, ou un socket déjà suivi qui a des données
+WiFiClient WiFiServer::available(uint8_t* status)
+{
+    if (status) *status = 0;
+    if (!_ecoute || s_statut != WL_CONNECTED) return WiFiClient();
+
+    for (size_t i = 0; i < s_sockets.size(); i++) {
+        SocketFaux& s = s_sockets[i];
+        if (s.port != _port || s.fermeFirmware) continue;
+        if (!s.vu || s.lu < s.entree.size()) {
+            s.vu = true;
+            return WiFiClient((int)i);
+        }
+    }
+    return WiFiClient();
+}
+
+// --- WiFiClient ---
+
+uint8_t WiFiClient::connected()
+{
+    SocketFaux* s = socket(_sock);
+    if (!s || s->fermeFirmware) return 0;
+    // Des données non lues gardent le socket "connecté", comme la librairie
+    return s->connecte || s->lu < s->entree.size();
+}
+
+uint8_t WiFiClient::status() { return connected() ? 4 : 0; }   // ESTABLISHED / CLOSED
+
+WiFiClient::operator bool() { return socket(_sock) != nullptr; }
+
+size_t WiFiClient::write(uint8_t c) { return write(&c, 1); }
+
+size_t WiFiClient::write(const uint8_t* buffer, size_t size)
+{
+    SocketFaux* s = socket(_sock);
+    if (!s || !s->connecte || s->fermeFirmware) return 0;
+    s->sortie.append((const char*)buffer, size);
+    return size;
+}
+
+int WiFiClient::available()
+{
+    SocketFaux* s = socket(_sock);
+    return (s && !s->fermeFirmware) ? (int)(s->entree.size() - s->lu) : 0;
+}
+
+int WiFiClient::read()
+{
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+int WiFiClient::read(uint8_t* buffer, size_t size)
+{
+    SocketFaux* s = socket(_sock);
+    if (!s || s->fermeFirmware) return -1;
+    size_t n = s->entree.size() - s->lu;
+    if (n > size) n = size;
+    memcpy(buffer, s->entree.data() + s->lu, n);
+    s->lu += n;
+    return (int)n;
+}
+
+int WiFiClient::peek()
+{
+    SocketFaux* s = socket(_sock);
+    return (s && s->lu < s->entree.size()) ? (uint8_t)s->entree[s->lu] : -1;
+}
+
+void WiFiClient::stop()
+{
+    if (SocketFaux* s = socket(_sock)) s->fermeFirmware = true;
+    _sock = -1;
+}
+
+IPAddress WiFiClient::remoteIP()   { return IPAddress(192, 168, 137, 1); }
+uint16_t  WiFiClient::remotePort() { return 50000; }
+
+// --- WiFiUDP ---
+
+uint8_t WiFiUDP::begin(uint16_t port)
+{
+    _port = port;
+    return s_statut == WL_CONNECTED ? 1 : 0;
+}
+
+void WiFiUDP::stop()
+{
+    _port = 0;
+    _paquet = -1;
+}
+
+int WiFiUDP::parsePacket()
+{
+    _paquet = -1;
+    if (!_port) return 0;
+
+    for (size_t i = 0; i < s_udpRecus.size(); i++) {
+        if (s_udpRecus[i].portDest != _port) continue;
+        // Paquet pris : les suivants restent en file
+        PaquetUdp p = s_udpRecus[i];
+        s_udpRecus.erase(s_udpRecus.begin() + i);
+        _courant    = p.donnees;
+        _remoteIp   = p.ip;
+        _remotePort = p.portSource;
+        _pos        = 0;
+        _paquet     = 0;
+        return (int)_courant.size();
+    }
+    return 0;
+}
+
+int WiFiUDP::available() { return _paquet < 0 ? 0 : (int)(_courant.size() - _pos); }
+
+int WiFiUDP::read()
+{
+    unsigned char c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+int WiFiUDP::read(unsigned char* buffer, size_t len)
+{
+    size_t n = (size_t)available();
+    if (n == 0) return 0;
+    if (n > len) n = len;
+    memcpy(buffer, _courant.data() + _pos, n);
+    _pos += n;
+    return (int)n;
+}
+
+int WiFiUDP::peek() { return available() ? (uint8_t)_courant[_pos] : -1; }
+
+int WiFiUDP::beginPacket(IPAddress ip, uint16_t port)
+{
+    _destIp   = ip;
+    _destPort = port;
+    _sortie.clear();
+    return 1;
+}
+
+int WiFiUDP::endPacket()
+{
+    PaquetUdp p;
+    p.ip         = _destIp;
+    p.portSource = _port;
+    p.portDest   = _destPort;
+    p.donnees    = _sortie;
+    s_udpEmis.push_back(p);
+    _sortie.clear();
+    return 1;
+}
+
+size_t WiFiUDP::write(uint8_t c) { return write(&c, 1); }
+
+size_t WiFiUDP::write(const uint8_t* buffer, size_t size)
+{
+    _sortie.append((const char*)buffer, size);
+    return size;
+}
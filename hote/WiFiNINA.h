@@ -0,0 +1,165 @@
+#ifndef HOTE_WIFININA_H
+#define HOTE_WIFININA_H
+
+#include <Arduino.h>
+#include <string>
+#include <vector>
+
+// =====================
+//   WiFiNINA factice
+// =====================
+//
+// Pas de réseau : les connexions TCP et paquets UDP sont injectés par le
+// test (hoteConnexionTcp, hoteUdpRecoit) et ce que le firmware écrit est
+// relevé par socket. WiFi.begin() connecte aussitôt si le point d'accès
+// est déclaré disponible (par défaut).
+
+#define WL_NO_SHIELD       255
+#define WL_NO_MODULE       WL_NO_SHIELD
+#define WL_IDLE_STATUS     0
+#define WL_NO_SSID_AVAIL   1
+#define WL_SCAN_COMPLETED  2
+#define WL_CONNECTED       3
+#define WL_CONNECT_FAILED  4
+#define WL_CONNECTION_LOST 5
+#define WL_DISCONNECTED    6
+
+class IPAddress : public Printable
+{
+public:
+    IPAddress() : _adresse(0) {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+    : _adresse((uint32_t)a | ((uint32_t)b << 8) | ((uint32_t)c << 16) | ((uint32_t)d << 24)) {}
+    IPAddress(uint32_t adresse) : _adresse(adresse) {}
+
+    operator uint32_t() const { return _adresse; }
+    bool operator==(const IPAddress& o) const { return _adresse == o._adresse; }
+    bool operator!=(const IPAddress& o) const { return _adresse != o._adresse; }
+    uint8_t operator[](int i) const { return (uint8_t)(_adresse >> (8 * (i & 3))); }
+
+    size_t printTo(Print& p) const override;
+
+private:
+    uint32_t _adresse;
+};
+
+class WiFiClient : public Stream
+{
+public:
+    WiFiClient() : _sock(-1) {}
+    explicit WiFiClient(int sock) : _sock(sock) {}
+
+    uint8_t connected();
+    uint8_t status();
+    operator bool();
+    bool operator==(const WiFiClient& o) const { return _sock == o._sock; }
+    bool operator!=(const WiFiClient& o) const { return _sock != o._sock; }
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+
+    int available() override;
+    int read() override;
+    int read(uint8_t* buffer, size_t size);
+    int peek() override;
+    void stop();
+
+    IPAddress remoteIP();
+    uint16_t  remotePort();
+
+private:
+    int _sock;
+};
+
+class WiFiServer
+{
+public:
+    explicit WiFiServer(uint16_t port) : _port(port), _ecoute(false) {}
+
+    void begin() { _ecoute = true; }
+    WiFiClient available(uint8_t* status = nullptr);
+
+private:
+    uint16_t _port;
+    bool     _ecoute;
+};
+
+class WiFiUDP : public Stream
+{
+public:
+    WiFiUDP() : _port(0), _paquet(-1), _pos(0), _remotePort(0), _destPort(0) {}
+
+    uint8_t begin(uint16_t port);
+    void    stop();
+
+    int parsePacket();
+    int available() override;
+    int read() override;
+    int read(unsigned char* buffer, size_t len);
+    int peek() override;
+    IPAddress remoteIP()   { return _remoteIp; }
+    uint16_t  remotePort() { return _remotePort; }
+
+    int beginPacket(IPAddress ip, uint16_t port);
+    int endPacket();
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+
+private:
+    uint16_t    _port;
+    int         _paquet;     // paquet reçu en cours de lecture (-1 : aucun)
+    size_t      _pos;
+    IPAddress   _remoteIp;
+    uint16_t    _remotePort;
+    std::string _courant;
+    IPAddress   _destIp;
+    uint16_t    _destPort;
+    std::string _sortie;
+};
+
+class WiFiClass
+{
+public:
+    uint8_t     status();
+    int         begin(const char* ssid, const char* passphrase);
+    void        disconnect();
+    void        end() {}
+    void        setTimeout(unsigned long) {}
+    const char* SSID();
+    IPAddress   localIP();
+    int32_t     RSSI() { return -50; }
+    const char* firmwareVersion() { return "1.5.0"; }
+    void        lowPowerMode() {}
+    void        noLowPowerMode() {}
+};
+
+extern WiFiClass WiFi;
+
+// --- Pilotage hôte ---
+
+struct PaquetUdp
+{
+    IPAddress   ip;
+    uint16_t    portSource;
+    uint16_t    portDest;
+    std::string donnees;
+};
+
+void hoteWifiDisponible(bool disponible);   // point d'accès joignable
+void hoteWifiCoupe();                       // perte de liaison (WL_CONNECTION_LOST)
+
+// Nouvelle connexion TCP vers "port" avec ces octets déjà reçus ; retourne l'id du socket
+int                hoteConnexionTcp(uint16_t port, const char* requete);
+void               hoteTcpAjoute(int sock, const char* octets);
+void               hoteTcpDeconnecte(int sock);          // fermeture côté PC
+const std::string& hoteTcpSortie(int sock);              // octets écrits par le firmware
+bool               hoteTcpFermeParFirmware(int sock);    // stop() appelé
+
+void                          hoteUdpRecoit(const PaquetUdp& p);
+const std::vector<PaquetUdp>& hoteUdpEmis();
+
+void hoteReinitialiseWifi();
+
+#endif
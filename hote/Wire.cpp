@@ -0,0 +1,72 @@
+#include "Wire.h"
+
+TwoWire Wire;
+
+TwoWire::TwoWire()
+: _adresse(0)
+, _txLen(0)
+, _rxLen(0)
+, _rxPos(0)
+, _transactions(0)
+{
+    memset(_peripheriques, 0, sizeof(_peripheriques));
+}
+
+void TwoWire::branche(uint8_t address, PeripheriqueI2C* p)
+{
+    if (address < 128) _peripheriques[address] = p;
+}
+
+void TwoWire::debranche(uint8_t address)
+{
+    if (address < 128) _peripheriques[address] = nullptr;
+}
+
+void TwoWire::beginTransmission(uint8_t address)
+{
+    _adresse = address;
+    _txLen   = 0;
+}
+
+uint8_t TwoWire::endTransmission(bool)
+{
+    PeripheriqueI2C* p = _adresse < 128 ? _peripheriques[_adresse] : nullptr;
+    if (!p) return 2;   // NACK adresse
+
+    _transactions++;
+    p->recoit(_tx, _txLen);
+    _txLen = 0;
+    return 0;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, size_t quantity, bool)
+{
+    _rxLen = 0;
+    _rxPos = 0;
+
+    PeripheriqueI2C* p = address < 128 ? _peripheriques[address] : nullptr;
+    if (!p) return 0;
+
+    if (quantity > TAILLE_TAMPON) quantity = TAILLE_TAMPON;
+    _transactions++;
+    _rxLen = p->envoie(_rx, (uint8_t)quantity);
+    return _rxLen;
+}
+
+size_t TwoWire::write(uint8_t c)
+{
+    if (_txLen >= TAILLE_TAMPON) return 0;
+    _tx[_txLen++] = c;
+    return 1;
+}
+
+size_t TwoWire::write(const uint8_t* data, size_t n)
+{
+    size_t i = 0;
+    while (i < n && write(data[i])) i++;
+    return i;
+}
+
+int TwoWire::available() { return _rxLen - _rxPos; }
+int TwoWire::read()      { return _rxPos < _rxLen ? _rx[_rxPos++] : -1; }
+int TwoWire::peek()      { return _rxPos < _rxLen ? _rx[_rxPos] : -1; }
@@ -0,0 +1,69 @@
+#ifndef HOTE_WIRE_H
+#define HOTE_WIRE_H
+
+#include <Arduino.h>
+
+// =====================
+//   Bus I2C factice
+// =====================
+//
+// Les transactions sont routées vers le périphérique enregistré à
+// l'adresse (FauxBNO055, FauxMS5837...). Adresse sans périphérique :
+// NACK (endTransmission() = 2, requestFrom() = 0), comme sur la carte.
+
+class PeripheriqueI2C
+{
+public:
+    virtual ~PeripheriqueI2C() {}
+
+    // Octets écrits entre beginTransmission() et endTransmission()
+    virtual void recoit(const uint8_t* octets, uint8_t n) = 0;
+
+    // requestFrom() : remplit au plus n octets, retourne le nombre fourni
+    virtual uint8_t envoie(uint8_t* octets, uint8_t n) = 0;
+};
+
+class TwoWire : public Stream
+{
+public:
+    static const uint8_t TAILLE_TAMPON = 64;   // SERIAL_BUFFER_SIZE du cœur SAMD
+
+    TwoWire();
+
+    void begin() {}
+    void end() {}
+    void setClock(uint32_t) {}
+
+    void    beginTransmission(uint8_t address);
+    uint8_t endTransmission(bool stopBit = true);
+
+    uint8_t requestFrom(uint8_t address, size_t quantity, bool stopBit = true);
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* data, size_t n) override;
+    using Print::write;
+
+    int available() override;
+    int read() override;
+    int peek() override;
+
+    // --- Pilotage hôte ---
+    void branche(uint8_t address, PeripheriqueI2C* p);
+    void debranche(uint8_t address);
+    uint32_t transactions() const { return _transactions; }
+
+private:
+    PeripheriqueI2C* _peripheriques[128];
+
+    uint8_t  _adresse;
+    uint8_t  _tx[TAILLE_TAMPON];
+    uint8_t  _txLen;
+    uint8_t  _rx[TAILLE_TAMPON];
+    uint8_t  _rxLen;
+    uint8_t  _rxPos;
+    uint32_t _transactions;
+};
+
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,38 @@
+#include "Hote.h"
+#include "FauxCapteurs.h"
+
+// =====================
+//   Firmware complet sur la couche factice
+// =====================
+//
+//   poisson_hote [durée_s] [touches série]
+//
+// setup() puis loop() sur l'horloge virtuelle (pas de 100 µs entre deux
+// passages), BNO055 et MS5837 scriptés au repos en surface. Les touches
+// sont lues par tacheControle comme depuis le moniteur série
+// (ex: "e" pour l'état, "x" pour le banc virgule fixe).
+
+static const uint32_t PAS_BOUCLE_US = 100;
+
+int main(int argc, char** argv)
+{
+    float duree_s = argc > 1 ? (float)atof(argv[1]) : 10.0f;
+
+    FauxBNO055 bno;
+    FauxMS5837 baro;
+    baro.regleModele02BA(true);   // Capteurs::begin() configure un 02BA
+    baro.reglePression(1013.0f, 20.0f);
+    Wire.branche(FauxBNO055::ADRESSE, &bno);
+    Wire.branche(FauxMS5837::ADRESSE, &baro);
+
+    if (argc > 2) hoteSerieEntree(argv[2]);
+
+    setup();
+
+    uint64_t fin_us = hoteTemps_us() + (uint64_t)(duree_s * 1e6f);
+    while (hoteTemps_us() < fin_us) {
+        loop();
+        hoteAvance_us(PAS_BOUCLE_US);
+    }
+    return 0;
+}
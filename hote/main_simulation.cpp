@@ -0,0 +1,92 @@
+#include "Hote.h"
+#include "Simulation.h"
+#include "Scheduler.h"
+
+// =====================
+//   Simulateur de plongée sur le PC
+// =====================
+//
+//   poisson_sim <scénario.txt> [sortie.csv]
+//
+// Firmware de poisson_hote, puces factices pilotées par ModeleHydro
+// (Simulation.h), scénario lu dans un fichier "cle=valeur" (clés de
+// ScenarioSim, une par ligne, '#' pour les commentaires), trace CSV écrite
+// dans un fichier (simulation.csv par défaut). Journal et bilan restent sur
+// la sortie standard (ligne "SIM,BILAN,raison=..."). Code de retour 1 si
+// une limite du bilan est dépassée ("SIM,ECHEC,..."), 2 si le scénario ou
+// la sortie sont invalides.
+
+// CodePoisson.ino
+extern CommandMotor commandMotor;
+extern Capteurs     capteurs;
+extern StateMachine stateMachine;
+extern Scheduler    scheduler;
+
+// Print vers un fichier : la trace CSV sans passer par Serial
+class SortieFichier : public Print
+{
+public:
+    explicit SortieFichier(FILE* f) : _f(f) {}
+
+    size_t write(uint8_t c) override { return fputc(c, _f) == EOF ? 0 : 1; }
+    size_t write(const uint8_t* buffer, size_t size) override { return fwrite(buffer, 1, size, _f); }
+
+private:
+    FILE* _f;
+};
+
+static bool lisScenario(const char* chemin, ScenarioSim& scenario)
+{
+    FILE* f = fopen(chemin, "r");
+    if (!f) {
+        fprintf(stderr, "poisson_sim: %s illisible\n", chemin);
+        return false;
+    }
+
+    char ligne[128];
+    uint32_t numero = 0;
+    bool ok = true;
+    while (fgets(ligne, sizeof(ligne), f)) {
+        numero++;
+        ligne[strcspn(ligne, "\r\n")] = '\0';
+        if (!scenario.regleLigne(ligne)) {
+            fprintf(stderr, "%s:%lu: ligne invalide : %s\n", chemin, (unsigned long)numero, ligne);
+            ok = false;
+        }
+    }
+    fclose(f);
+    return ok;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: poisson_sim <scenario.txt> [sortie.csv]\n");
+        return 2;
+    }
+    Simulation simulation(commandMotor, capteurs, stateMachine);
+    if (!lisScenario(argv[1], simulation.scenario())) return 2;
+
+    const char* cheminCsv = argc > 2 ? argv[2] : "simulation.csv";
+    FILE* csv = fopen(cheminCsv, "w");
+    if (!csv) {
+        fprintf(stderr, "poisson_sim: %s non inscriptible\n", cheminCsv);
+        return 2;
+    }
+    SortieFichier sortie(csv);
+    simulation.setSortieCsv(sortie);
+
+    simulation.branche();
+    setup();
+    simulation.begin();
+
+    // Rien de dû : saut direct à la prochaine échéance au lieu de l'attendre
+    while (!simulation.terminee()) {
+        loop();
+        uint32_t attente = scheduler.tempsDisponible_us();
+        if (attente > 0) simulation.avance(attente);
+    }
+
+    fclose(csv);
+    return simulation.echec() ? 1 : 0;
+}
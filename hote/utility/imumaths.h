@@ -0,0 +1,6 @@
+#ifndef HOTE_IMUMATHS_H
+#define HOTE_IMUMATHS_H
+
+// Inclus par Capteurs.h ; le firmware n'utilise pas imu::Vector
+
+#endif
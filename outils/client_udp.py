@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+"""Client de test du canal UDP de pilotage (voir CanalUdp.h).
+
+Envoie des commandes (ou des demandes de télémétrie), vérifie les réponses
+et mesure l'aller-retour. Le temps de traitement côté poisson (réception ->
+actionneurs) est lu dans la réponse.
+
+    python3 outils/client_udp.py 192.168.137.50          # 100 demandes TELEM
+    python3 outils/client_udp.py 192.168.137.50 -k ZSZS  # commandes
+    python3 outils/client_udp.py 127.0.0.1 -n 1000       # contre poisson_udp_factice.py
+"""
+
+import argparse
+import socket
+import statistics
+import struct
+import sys
+import time
+
+MAGIC = b"PU"
+VERSION = 1
+UDP_CMD = 0x01
+UDP_TELEM = 0x02
+UDP_REPONSE = 0x80
+
+ENTETE = struct.Struct("<2sBBH")                    # EnteteUdp (6 octets)
+REPONSE = struct.Struct("<HH")                      # ReponseUdp sans la trame
+TRAME = struct.Struct("<BBhIIhhhhhhhhhHhH")         # TrameData v1 (36 octets)
+
+
+def decode_trame(b):
+    (version, flags, depth_mm, frame, t_ms, yaw, pitch, roll,
+     ax, ay, az, gx, gy, gz, vbat_mv, ibat_ma, page) = TRAME.unpack(b)
+    return {
+        "version": version, "frame": frame, "t_ms": t_ms,
+        "p": depth_mm / 1000.0, "yaw": yaw / 10.0, "pit": pitch / 10.0, "rol": roll / 10.0,
+        "v": vbat_mv / 1000.0, "i": ibat_ma, "pAge": page,
+        "leak": bool(flags & 1), "auto": bool(flags & 4),
+    }
+
+
+def paquet(type_, seq, touche=None):
+    p = ENTETE.pack(MAGIC, VERSION, type_, seq & 0xFFFF)
+    if touche is not None:
+        p += touche.encode("ascii")[:1]
+    return p
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("hote")
+    ap.add_argument("-p", "--port", type=int, default=4210)
+    ap.add_argument("-n", "--nombre", type=int, default=100, help="demandes TELEM si pas de -k")
+    ap.add_argument("-k", "--touches", default="", help="touches envoyées en UDP_CMD (ex: ZSQS)")
+    ap.add_argument("-i", "--intervalle", type=float, default=0.02, help="s entre deux envois")
+    ap.add_argument("-t", "--timeout", type=float, default=0.2)
+    ap.add_argument("--doublons", action="store_true",
+                    help="renvoie chaque paquet une 2e fois (doit être ignoré)")
+    args = ap.parse_args()
+
+    s = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    s.settimeout(args.timeout)
+    dest = (args.hote, args.port)
+
+    envois = [(UDP_CMD, k) for k in args.touches] or [(UDP_TELEM, None)] * args.nombre
+    rtt_ms, traitement_us, perdus, derniere = [], [], 0, None
+
+    for seq, (type_, touche) in enumerate(envois, start=1):
+        p = paquet(type_, seq, touche)
+        t0 = time.perf_counter()
+        s.sendto(p, dest)
+        if args.doublons:
+            s.sendto(p, dest)
+
+        try:
+            while True:
+                r, _ = s.recvfrom(128)
+                magic, ver, rtype, rseq = ENTETE.unpack_from(r)
+                # Réponse en retard d'un envoi précédent : ignorée
+                if magic == MAGIC and ver == VERSION and rseq == seq:
+                    break
+        except socket.timeout:
+            perdus += 1
+            continue
+
+        rtt_ms.append((time.perf_counter() - t0) * 1000.0)
+        if rtype != type_ | UDP_REPONSE:
+            print("type de réponse inattendu 0x%02x" % rtype, file=sys.stderr)
+        trait, rejets = REPONSE.unpack_from(r, ENTETE.size)
+        traitement_us.append(trait)
+        derniere = decode_trame(r[ENTETE.size + REPONSE.size:])
+        time.sleep(args.intervalle)
+
+    print("envoyés=%d réponses=%d perdus=%d rejets(poisson)=%d"
+          % (len(envois), len(rtt_ms), perdus, rejets if rtt_ms else -1))
+    if rtt_ms:
+        rtt_ms.sort()
+        print("aller-retour ms : min=%.2f med=%.2f p95=%.2f max=%.2f"
+              % (rtt_ms[0], statistics.median(rtt_ms),
+                 rtt_ms[int(0.95 * (len(rtt_ms) - 1))], rtt_ms[-1]))
+        print("traitement poisson us : min=%d med=%d max=%d"
+              % (min(traitement_us), statistics.median(traitement_us), max(traitement_us)))
+        print("dernière trame :", derniere)
+    return 0 if rtt_ms else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
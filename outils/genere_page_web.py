@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+"""Génère PageWeb.h à partir de web/index.html.
+
+Minification : blancs entre balises retirés, CSS compacté (commentaires,
+blancs autour de { } : ; , >), JS compacté hors chaînes (lignes de
+commentaire "//", blancs hors identifiants, lignes jointes quand la
+précédente finit par { ; , ( ou que la suivante commence par } . ) : pas
+de fin de ligne retirée là où l'insertion automatique de ";" compterait).
+
+Deux copies en flash (tableaux d'octets constants), chacune avec son ETag
+fort tiré de son contenu :
+  - PAGE_WEB_GZ   : gzip, via zopfli si le module Python est installé
+                    (pip install zopfli), sinon zlib niveau 9 ; date à 0
+                    pour un résultat reproductible ;
+  - PAGE_WEB_HTML : minifiée sans compression, pour les clients qui
+                    n'annoncent pas gzip dans Accept-Encoding.
+
+A relancer après chaque modification de web/index.html :
+    python3 outils/genere_page_web.py
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+try:
+    import zopfli.gzip
+except ImportError:
+    zopfli = None
+
+RACINE = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SOURCE = os.path.join(RACINE, "web", "index.html")
+CIBLE = os.path.join(RACINE, "PageWeb.h")
+
+PONCTUATION_JS = set("{}();,=+-*/<>!&|?:[]")
+
+
+def minifie_css(css):
+    css = re.sub(r"/\*.*?\*/", "", css, flags=re.S)
+    css = re.sub(r"\s+", " ", css)
+    css = re.sub(r"\s*([{}:;,>])\s*", r"\1", css)
+    return css.replace(";}", "}").strip()
+
+
+def compacte_ligne_js(ligne):
+    sortie = []
+    i = 0
+    guillemet = None
+    while i < len(ligne):
+        c = ligne[i]
+        if guillemet:
+            sortie.append(c)
+            if c == "\\":
+                sortie.append(ligne[i + 1])
+                i += 2
+                continue
+            if c == guillemet:
+                guillemet = None
+        elif c in "'\"":
+            guillemet = c
+            sortie.append(c)
+        elif c in " \t":
+            j = i
+            while j < len(ligne) and ligne[j] in " \t":
+                j += 1
+            avant = sortie[-1] if sortie else ""
+            apres = ligne[j] if j < len(ligne) else ""
+            # Un blanc ne reste qu'entre deux identifiants (var x, return y)
+            if avant and apres and avant not in PONCTUATION_JS and apres not in PONCTUATION_JS:
+                sortie.append(" ")
+            i = j
+            continue
+        else:
+            sortie.append(c)
+        i += 1
+    return "".join(sortie)
+
+
+def minifie_js(js):
+    lignes = []
+    for ligne in js.split("\n"):
+        ligne = ligne.strip()
+        if not ligne or ligne.startswith("//"):
+            continue
+        ligne = compacte_ligne_js(ligne)
+        if lignes and (lignes[-1][-1] in "{;,(" or ligne[0] in "}.)"):
+            lignes[-1] += ligne
+        else:
+            lignes.append(ligne)
+    return "\n".join(lignes)
+
+
+def minifie(html):
+    html = html.decode("utf-8")
+    morceaux = re.split(r"(<style>.*?</style>|<script>.*?</script>)", html, flags=re.S)
+    for i, m in enumerate(morceaux):
+        if m.startswith("<style>"):
+            morceaux[i] = "<style>" + minifie_css(m[7:-8]) + "</style>"
+        elif m.startswith("<script>"):
+            morceaux[i] = "<script>" + minifie_js(m[8:-9]) + "</script>"
+        else:
+            m = re.sub(r">\s+<", "><", m)
+            morceaux[i] = re.sub(r"\n\s*", "", m)
+    return "".join(morceaux).encode("utf-8")
+
+
+def compresse(donnees):
+    if zopfli:
+        return zopfli.gzip.compress(donnees, numiterations=1000), "zopfli"
+    return gzip.compress(donnees, compresslevel=9, mtime=0), "zlib -9"
+
+
+def tableau(f, nom, donnees):
+    f.write("static const uint8_t %s[] PROGMEM = {\n" % nom)
+    for i in range(0, len(donnees), 16):
+        f.write("    " + ", ".join("0x%02x" % b for b in donnees[i:i + 16]) + ",\n")
+    f.write("};\n\n")
+
+
+def main():
+    with open(SOURCE, "rb") as f:
+        html = f.read()
+
+    mini = minifie(html)
+    gz, outil = compresse(mini)
+    etag_gz = hashlib.sha1(gz).hexdigest()[:16]
+    etag_html = hashlib.sha1(mini).hexdigest()[:16]
+
+    with open(CIBLE, "w", newline="\n") as f:
+        f.write("#ifndef PAGE_WEB_H\n#define PAGE_WEB_H\n\n")
+        f.write("// Fichier généré par outils/genere_page_web.py depuis web/index.html,\n")
+        f.write("// ne pas modifier à la main.\n")
+        f.write("// %d octets -> %d minifiés -> %d octets gzip, %s (-%d%%)\n\n"
+                % (len(html), len(mini), len(gz), outil, 100 - 100 * len(gz) // len(html)))
+        f.write("#include <Arduino.h>\n\n")
+        f.write("#define PAGE_WEB_ETAG \"\\\"%s\\\"\"\n" % etag_gz)
+        f.write("#define PAGE_WEB_ETAG_HTML \"\\\"%s\\\"\"\n\n" % etag_html)
+        f.write("static const uint32_t PAGE_WEB_TAILLE_SOURCE = %d;\n\n" % len(html))
+        tableau(f, "PAGE_WEB_GZ", gz)
+        tableau(f, "PAGE_WEB_HTML", mini)
+        f.write("#endif\n")
+
+    print("PageWeb.h : %d -> %d minifiés -> %d octets (%s), ETag %s / %s"
+          % (len(html), len(mini), len(gz), outil, etag_gz, etag_html))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""Poisson factice : serveur UDP local qui parle le protocole de CanalUdp.
+
+Permet de tester outils/client_udp.py (ou une autre interface de pilotage)
+sans la carte. Mêmes règles que le firmware : paquet malformé ou seq pas
+strictement après le dernier accepté (par émetteur) -> ignoré sans réponse.
+
+    python3 outils/poisson_udp_factice.py          # écoute 127.0.0.1:4210
+"""
+
+import argparse
+import socket
+import struct
+import sys
+import time
+
+from client_udp import ENTETE, REPONSE, TRAME, MAGIC, VERSION, UDP_CMD, UDP_TELEM, UDP_REPONSE
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("--adresse", default="127.0.0.1")
+    ap.add_argument("-p", "--port", type=int, default=4210)
+    args = ap.parse_args()
+
+    s = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    s.bind((args.adresse, args.port))
+    print("poisson factice sur %s:%d" % (args.adresse, args.port))
+
+    dernier = {}          # émetteur -> dernier seq accepté
+    rejets = 0
+    frame = 0
+    auto = False
+    debut = time.monotonic()
+
+    while True:
+        p, emetteur = s.recvfrom(64)
+        t0 = time.perf_counter()
+
+        if len(p) < ENTETE.size or len(p) > ENTETE.size + 1:
+            rejets += 1
+            continue
+        magic, ver, type_, seq = ENTETE.unpack_from(p)
+        if magic != MAGIC or ver != VERSION or type_ not in (UDP_CMD, UDP_TELEM):
+            rejets += 1
+            continue
+        if type_ == UDP_CMD and len(p) != ENTETE.size + 1:
+            rejets += 1
+            continue
+
+        # Même test que CanalUdp::seqAccepte (différence signée 16 bits)
+        d = (seq - dernier[emetteur]) & 0xFFFF if emetteur in dernier else 1
+        if d == 0 or d >= 0x8000:
+            rejets += 1
+            continue
+        dernier[emetteur] = seq
+
+        if type_ == UDP_CMD:
+            touche = chr(p[ENTETE.size]).upper()
+            if touche == "A":
+                auto = not auto
+            print("commande %s (seq %d)" % (touche, seq))
+
+        frame += 1
+        t_ms = int((time.monotonic() - debut) * 1000) & 0xFFFFFFFF
+        trame = TRAME.pack(1, 4 if auto else 0, 1234, frame, t_ms,
+                           900, -15, 20, 0, 0, 981, 0, 0, 0, 7400, 350, 12)
+        trait = min(int((time.perf_counter() - t0) * 1e6), 0xFFFF)
+
+        r = ENTETE.pack(MAGIC, VERSION, type_ | UDP_REPONSE, seq)
+        r += REPONSE.pack(trait, rejets & 0xFFFF) + trame
+        s.sendto(r, emetteur)
+
+
+if __name__ == "__main__":
+    try:
+        sys.exit(main())
+    except KeyboardInterrupt:
+        pass
@@ -0,0 +1,123 @@
+#include "Hote.h"
+#include "FauxCapteurs.h"
+#include "Capteurs.h"
+#include "CommandMotor.h"
+#include "AsservProfond.h"
+#include "Safety.h"
+#include "StateMachine.h"
+#include "Telemetrie.h"
+#include "BancPointFixe.h"
+
+#include <chrono>
+
+// =====================
+//   Durée des chemins par tick sur le PC
+// =====================
+//
+//   banc_tick [appels]
+//
+// Chaque chemin tourne sur l'horloge virtuelle (les cadences du firmware
+// sont respectées : une lecture IMU tous les 20 ms, etc.) et n'est
+// chronométré que par l'horloge du PC, autour de l'appel. Donne un ordre
+// de grandeur relatif et attrape les régressions ; les durées sur la
+// carte sont celles de Metriques (touche 'm') et du banc 'x'.
+//
+// Termine par bancPointFixe() sur l'horloge réelle (même sortie que 'x').
+
+typedef std::chrono::steady_clock Chrono;
+
+static volatile float s_puits;
+
+struct Mesure
+{
+    double   total_ns = 0.0;
+    double   max_ns   = 0.0;
+    uint32_t appels   = 0;
+
+    template <typename F> void chronometre(F f)
+    {
+        Chrono::time_point t0 = Chrono::now();
+        f();
+        double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(Chrono::now() - t0).count();
+        total_ns += ns;
+        if (ns > max_ns) max_ns = ns;
+        appels++;
+    }
+
+    void affiche(const char* nom) const
+    {
+        printf("[Tick] %-24s moy %8.1f ns  max %9.1f ns  (%lu appels)\n",
+               nom, appels ? total_ns / appels : 0.0, max_ns, (unsigned long)appels);
+    }
+};
+
+int main(int argc, char** argv)
+{
+    uint32_t n = argc > 1 ? (uint32_t)atol(argv[1]) : 20000;
+
+    FauxBNO055 bno;
+    FauxMS5837 puce;
+    puce.regleModele02BA(true);
+    puce.reglePression(1100.0f, 15.0f);
+    bno.regleGravite(0.0f, 0.0f, 9.81f);
+    Wire.branche(FauxBNO055::ADRESSE, &bno);
+    Wire.branche(FauxMS5837::ADRESSE, &puce);
+
+    static CommandMotor motor;
+    static Safety       safety;
+    static Capteurs     capteurs;
+    static StateMachine sm(motor, capteurs, safety);
+    static AsservProfond asserv(&motor, &capteurs);
+    static Telemetrie   telemetrie;
+
+    hoteSerieCapture(true);   // logs de démarrage hors de la sortie du banc
+    motor.begin();
+    capteurs.begin();
+    hoteSerieCapture(false);
+
+    // Tâche capteurs (100 Hz) : rafale IMU, INA, MS5837 et publication
+    Mesure capt;
+    for (uint32_t i = 0; i < n; i++) {
+        hoteAvance_ms(10);
+        capt.chronometre([] { capteurs.update(); });
+    }
+    capt.affiche("Capteurs::update");
+
+    // Loi de profondeur + étage actionneur servo
+    Mesure pid;
+    for (uint32_t i = 0; i < n; i++) {
+        hoteAvance_ms(10);
+        capteurs.update();
+        pid.chronometre([] { asserv.setProfondeurVoulue(1.5f); motor.update(); });
+    }
+    pid.affiche("AsservProfond + servo");
+
+    // Estimateur vertical seul : prédiction à 50 Hz, correction à 20 Hz
+    EstimateurVertical est;
+    Mesure kal;
+    uint32_t t_ms = 0;
+    est.correction(1.0f, t_ms);
+    for (uint32_t i = 0; i < n; i++) {
+        t_ms += 20;
+        kal.chronometre([&] {
+            est.setAcceleration(0.01f);
+            est.prediction(t_ms);
+            if (i % 5 == 4) est.correction(1.0f + (i & 7) * 1e-3f, t_ms);
+            s_puits = est.profondeurPredite_m(0.3f);
+        });
+    }
+    kal.affiche("EstimateurVertical");
+
+    // Machine d'état + enregistrement télémétrie
+    Mesure etat;
+    for (uint32_t i = 0; i < n; i++) {
+        hoteAvance_ms(10);
+        etat.chronometre([] { sm.update(); telemetrie.update(capteurs, motor, sm); });
+    }
+    etat.affiche("StateMachine + Telemetrie");
+
+    printf("\n");
+    hoteHorlogeReelle(true);
+    bancPointFixe();
+    return 0;
+}
@@ -0,0 +1,50 @@
+#include "Test.h"
+
+struct Test
+{
+    const char*  nom;
+    FonctionTest fn;
+};
+
+static const int MAX_TESTS = 128;
+static Test      s_tests[MAX_TESTS];
+static int       s_nbTests = 0;
+static bool      s_echec   = false;
+
+EnregistrementTest::EnregistrementTest(const char* nom, FonctionTest fn)
+{
+    if (s_nbTests < MAX_TESTS) s_tests[s_nbTests++] = { nom, fn };
+}
+
+void echecTest(const char* fichier, int ligne, const char* message)
+{
+    printf("    %s:%d: %s\n", fichier, ligne, message);
+    s_echec = true;
+}
+
+int main(int argc, char** argv)
+{
+    // Argument optionnel : ne lance que les tests dont le nom le contient
+    const char* filtre = argc > 1 ? argv[1] : nullptr;
+    int echecs = 0, lances = 0;
+
+    for (int i = 0; i < s_nbTests; i++) {
+        if (filtre && !strstr(s_tests[i].nom, filtre)) continue;
+
+        hoteReinitialise();
+        hoteSerieCapture(true);   // journal du firmware hors de la sortie du test
+        s_echec = false;
+        s_tests[i].fn();
+        lances++;
+
+        printf("[%s] %s\n", s_echec ? "ECHEC" : " OK  ", s_tests[i].nom);
+        if (s_echec) {
+            echecs++;
+            const std::string& serie = hoteSerieSortie();
+            if (!serie.empty()) printf("    --- Serial ---\n%s\n", serie.c_str());
+        }
+    }
+
+    printf("%d/%d tests OK\n", lances - echecs, lances);
+    return echecs;
+}
@@ -0,0 +1,65 @@
+#ifndef TEST_H
+#define TEST_H
+
+#include <Arduino.h>
+#include "Hote.h"
+
+// =====================
+//   Cadre de test minimal (sans dépendance)
+// =====================
+//
+//   TEST(nom) { VERIFIE(x > 0); VERIFIE_EGAL(a, b); VERIFIE_PROCHE(f, 1.0, 1e-3); }
+//
+// Chaque TEST part d'une couche factice remise à zéro (hoteReinitialise).
+// Une vérification ratée affiche fichier:ligne et passe au test suivant ;
+// le code de sortie est le nombre de tests en échec (lu par ctest).
+
+typedef void (*FonctionTest)();
+
+struct EnregistrementTest
+{
+    EnregistrementTest(const char* nom, FonctionTest fn);
+};
+
+void echecTest(const char* fichier, int ligne, const char* message);
+
+#define TEST(nom)                                                   \
+    static void nom();                                              \
+    static EnregistrementTest s_enregistre_##nom(#nom, nom);        \
+    static void nom()
+
+#define VERIFIE(cond)                                               \
+    do {                                                            \
+        if (!(cond)) { echecTest(__FILE__, __LINE__, #cond); return; } \
+    } while (0)
+
+#define VERIFIE_EGAL(a, b)                                          \
+    do {                                                            \
+        if (!((a) == (b))) {                                        \
+            char m_[160];                                           \
+            snprintf(m_, sizeof(m_), "%s == %s (%lld != %lld)", #a, #b, \
+                     (long long)(a), (long long)(b));               \
+            echecTest(__FILE__, __LINE__, m_); return;              \
+        }                                                           \
+    } while (0)
+
+#define VERIFIE_PROCHE(a, b, tol)                                   \
+    do {                                                            \
+        double a_ = (double)(a), b_ = (double)(b);                  \
+        if (!(fabs(a_ - b_) <= (double)(tol))) {                    \
+            char m_[160];                                           \
+            snprintf(m_, sizeof(m_), "%s ~ %s (%.6g, %.6g, tol %g)", #a, #b, a_, b_, (double)(tol)); \
+            echecTest(__FILE__, __LINE__, m_); return;              \
+        }                                                           \
+    } while (0)
+
+#define VERIFIE_TEXTE(a, b)                                         \
+    do {                                                            \
+        if (strcmp((a), (b)) != 0) {                                \
+            char m_[240];                                           \
+            snprintf(m_, sizeof(m_), "%s == \"%s\" (\"%s\")", #a, (b), (a)); \
+            echecTest(__FILE__, __LINE__, m_); return;              \
+        }                                                           \
+    } while (0)
+
+#endif
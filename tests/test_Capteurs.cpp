@@ -0,0 +1,194 @@
+#include "Test.h"
+#include "Capteurs.h"
+#include "FauxCapteurs.h"
+#include <INA236.h>
+
+// Capteurs complet sur le bus factice : BNO055 et MS5837 scriptés,
+// INA236 par adresse (hoteIna), fuite sur D1, ALERT batterie sur D7
+static const uint8_t BROCHE_FUITE = 1;
+
+struct Banc
+{
+    FauxBNO055 bno;
+    FauxMS5837 puce;
+    Capteurs   capteurs;
+
+    Banc()
+    : capteurs(0x28, 0x40, 0x41, 0x27, 0x76, 2200.0f)
+    {
+        puce.regleModele02BA(true);
+        puce.reglePression(1013.25f, 15.0f);
+        Wire.branche(FauxBNO055::ADRESSE, &bno);
+        Wire.branche(FauxMS5837::ADRESSE, &puce);
+    }
+
+    ~Banc()
+    {
+        Wire.debranche(FauxBNO055::ADRESSE);
+        Wire.debranche(FauxMS5837::ADRESSE);
+    }
+
+    // update() au pas de la tâche capteurs (10 ms)
+    void tourne(uint32_t duree_ms)
+    {
+        for (uint32_t t = 0; t < duree_ms; t += 10) {
+            hoteAvance_ms(10);
+            capteurs.update();
+        }
+    }
+};
+
+static bool s_failsafe = false;
+static void failsafe() { s_failsafe = true; }
+
+TEST(imu_en_rafale)
+{
+    Banc* b = new Banc();
+    b->bno.regleEuler(90.0f, -5.5f, 12.25f);
+    b->bno.regleAcceleration(0.1f, -0.2f, 9.81f);
+    b->bno.regleGyro(0.0f, 0.0f, 45.0f);
+    b->bno.regleGravite(0.0f, 0.0f, 9.81f);
+    b->bno.regleLineaire(0.0f, 0.0f, -0.5f);   // accélère vers le bas
+    b->bno.regleCalibration(3, 3, 2, 1);
+    VERIFIE(b->capteurs.begin());
+
+    b->tourne(40);
+    const IMUData& imu = b->capteurs.getIMUData();
+    VERIFIE(imu.seq >= 1);
+    VERIFIE_PROCHE(imu.yaw,   90.0, 1e-3);
+    VERIFIE_PROCHE(imu.roll,  -5.5, 1e-3);
+    VERIFIE_PROCHE(imu.pitch, 12.25, 1e-3);
+    VERIFIE_PROCHE(imu.az, 9.81, 0.01);
+    VERIFIE_PROCHE(imu.gx, 0.0, 1e-6);
+    VERIFIE_PROCHE(imu.gz, 45.0 * DEG_TO_RAD, 1e-3);
+    VERIFIE_PROCHE(imu.accVerticale_mps2, 0.5, 0.01);
+    VERIFIE_EGAL(imu.sysCal, 3);
+    VERIFIE_EGAL(imu.magCal, 1);
+    delete b;
+}
+
+TEST(cadence_imu)
+{
+    Banc* b = new Banc();
+    VERIFIE(b->capteurs.begin());
+    uint32_t avant = b->bno.lectures();
+
+    // 50 Hz, phase 0 : au premier appel puis toutes les 20 ms,
+    // une rafale chacune
+    b->tourne(200);
+    VERIFIE_EGAL(b->capteurs.getIMUData().seq, 11u);
+    VERIFIE_EGAL(b->bno.lectures() - avant, 11u);
+    delete b;
+}
+
+TEST(profondeur_publiee)
+{
+    Banc* b = new Banc();
+    b->puce.reglePression(1013.25f + 997.0f * 9.80665f * 2.0f / 100.0f - 0.25f, 15.0f);
+    VERIFIE(b->capteurs.begin());
+
+    VERIFIE(!b->capteurs.getDepthData().estimationValide);
+    b->tourne(100);
+
+    const DepthData& d = b->capteurs.getDepthData();
+    VERIFIE(d.seq >= 1);
+    VERIFIE(d.estimationValide);
+    VERIFIE_PROCHE(d.temperature_C, 15.0, 0.02);
+    VERIFIE_PROCHE(d.depth_m, 2.0, 0.002);
+    VERIFIE_PROCHE(d.profondeurFiltree_m, 2.0, 0.01);
+    VERIFIE(!b->capteurs.isDepthStale());
+
+    // Capteur muet : la profondeur devient périmée
+    Wire.debranche(FauxMS5837::ADRESSE);
+    b->tourne(600);
+    VERIFIE(b->capteurs.isDepthStale());
+    delete b;
+}
+
+TEST(batterie_et_soc)
+{
+    Banc* b = new Banc();
+    hoteIna(0x40).tension_V  = 7.4f;
+    hoteIna(0x40).courant_mA = 2200.0f;   // 1 C : 1 %/36 s
+    VERIFIE(b->capteurs.begin());
+
+    b->tourne(36000);
+    const PowerData& p = b->capteurs.getPowerData();
+    VERIFIE_PROCHE(p.busVoltage_V, 7.4, 1e-4);
+    VERIFIE_PROCHE(p.power_mW, 7.4 * 2200.0, 0.5);
+    VERIFIE_PROCHE(b->capteurs.getBatteryPercent(), 99.0, 0.05);
+    delete b;
+}
+
+TEST(alerte_surintensite)
+{
+    Banc* b = new Banc();
+    VERIFIE(b->capteurs.begin());
+    VERIFIE(hoteIna(0x40).registreAlerte != 0);
+    VERIFIE(!b->capteurs.getPowerData().alerteSurintensite);
+
+    // Front parasite : AFF non levé, rien n'est signalé
+    hoteRegleBroche(7, LOW);
+    b->tourne(10);
+    VERIFIE(!b->capteurs.getPowerData().alerteSurintensite);
+    hoteRegleBroche(7, HIGH);
+
+    hoteIna(0x40).drapeaux = 0x0010;
+    hoteRegleBroche(7, LOW);
+    b->tourne(10);
+    VERIFIE(b->capteurs.getPowerData().alerteSurintensite);
+    VERIFIE_EGAL(hoteIna(0x40).drapeaux, 0);   // acquittée à la lecture
+    delete b;
+}
+
+TEST(fuite_parasite_filtree)
+{
+    Banc* b = new Banc();
+    b->capteurs.setLeakFailsafe(failsafe);
+    VERIFIE(b->capteurs.begin());
+
+    // Impulsion de 150 µs : retombée avant la fin du filtre
+    hoteRegleBroche(BROCHE_FUITE, HIGH);
+    hoteAvance_us(150);
+    hoteRegleBroche(BROCHE_FUITE, LOW);
+    b->tourne(20);
+    VERIFIE(!s_failsafe);
+    VERIFIE(!b->capteurs.getLeakData().leakLatched);
+    VERIFIE_EGAL(b->capteurs.getLeakData().parasites, 1);
+
+    // Aucune attente active dans le filtre : le temps n'avance pas
+    uint64_t t0 = hoteTemps_us();
+    hoteRegleBroche(BROCHE_FUITE, HIGH);
+    VERIFIE_EGAL(hoteTemps_us(), t0);
+    hoteRegleBroche(BROCHE_FUITE, LOW);
+    delete b;
+}
+
+// En dernier : le latch fuite est statique (un seul capteur par carte)
+TEST(fuite_par_interruption)
+{
+    Banc* b = new Banc();
+    b->capteurs.setLeakFailsafe(failsafe);
+    VERIFIE(b->capteurs.begin());
+    VERIFIE(b->capteurs.getLeakData().sensorPresent);
+    VERIFIE(b->capteurs.getLeakData().interruptActive);
+
+    // Front horodaté, confirmé au premier passage après le filtre
+    hoteRegleBroche(BROCHE_FUITE, HIGH);
+    VERIFIE(!s_failsafe);
+    hoteAvance_us(200);
+    b->capteurs.updateLeak();
+    VERIFIE(s_failsafe);
+
+    b->tourne(10);
+    const LeakData& l = b->capteurs.getLeakData();
+    VERIFIE(l.leakLatched);
+    VERIFIE(l.failsafeDeclenche);
+    VERIFIE(l.detectionParIsr);
+
+    // Mémorisée : reste vraie une fois la broche retombée
+    hoteRegleBroche(BROCHE_FUITE, LOW);
+    b->tourne(10);
+    VERIFIE(b->capteurs.getLeakData().leakLatched);
+    delete b;
+}
@@ -0,0 +1,165 @@
+#include "Test.h"
+#include "CommandMotor.h"
+
+static const uint8_t SERVO_BALLAST   = 3;
+static const uint8_t SERVO_DIRECTION = 6;
+
+// Impulsion SER0067 attendue pour un angle (500-2500 µs)
+static int impulsion(float angle)
+{
+    return 500 + (int)(angle * 2000.0f / 180.0f + 0.5f);
+}
+
+TEST(begin_attache_les_servos)
+{
+    CommandMotor m;
+    VERIFIE(m.begin());
+    VERIFIE(hoteServo(SERVO_BALLAST).attache);
+    VERIFIE(hoteServo(SERVO_DIRECTION).attache);
+    VERIFIE_EGAL(hoteBroche(4).pwm, 0);
+    VERIFIE_EGAL(hoteBroche(5).pwm, 0);
+
+    // Premier servo de la carte : attach() retourne l'index 0
+    m.setServoAngle(90.0f);
+    VERIFIE_EGAL(hoteServo(SERVO_BALLAST).impulsion_us, impulsion(90.0f));
+}
+
+TEST(rampe_limitee_en_vitesse)
+{
+    CommandMotor m;
+    m.begin();
+    m.setServoAngle(0.0f);   // position connue, écrite directement
+
+    m.setServoAngle(90.0f);  // 90 deg/s par défaut
+    for (int i = 0; i < 50; i++) {
+        hoteAvance_ms(10);
+        m.update();
+    }
+    VERIFIE_PROCHE(m.getServoAngle(), 45.0, 0.5);
+    VERIFIE_EGAL(m.getServoConsigne(), 90.0f);
+
+    for (int i = 0; i < 60; i++) {
+        hoteAvance_ms(10);
+        m.update();
+    }
+    VERIFIE_EGAL(m.getServoAngle(), 90.0f);
+    VERIFIE_EGAL(hoteServo(SERVO_BALLAST).impulsion_us, impulsion(90.0f));
+}
+
+TEST(bande_morte_et_hysteresis)
+{
+    CommandMotor m;
+    m.begin();
+    m.setServoAngle(60.0f);
+    uint32_t ecritures = hoteServo(SERVO_BALLAST).ecritures;
+
+    // Bruit sous la bande morte (1 deg) : rien n'est écrit
+    m.setServoAngle(60.6f);
+    m.setServoAngle(59.5f);
+    VERIFIE_EGAL(hoteServo(SERVO_BALLAST).ecritures, ecritures);
+    VERIFIE_EGAL(m.statsServo().evitees, 2u);
+
+    // Montée acceptée, puis retour de 1,5 deg : sous bande morte + hystérésis
+    m.setServoAngle(62.0f);
+    m.setServoAngle(60.5f);
+    VERIFIE_EGAL(m.getServoConsigne(), 62.0f);
+    m.setServoAngle(59.9f);
+    VERIFIE_PROCHE(m.getServoConsigne(), 59.9, 1e-4);
+}
+
+TEST(impulsion_inchangee_non_reecrite)
+{
+    CommandMotor m;
+    m.begin();
+    m.setLimiteurServo(0.0f, 0.0f, 0.0f);
+    m.setServoAngle(30.0f);
+    uint32_t ecritures = hoteServo(SERVO_BALLAST).ecritures;
+
+    // 0,01 deg = 0,11 µs : même impulsion quantifiée
+    m.setServoAngle(30.01f);
+    VERIFIE_EGAL(hoteServo(SERVO_BALLAST).ecritures, ecritures);
+    VERIFIE_EGAL(m.statsServo().identiques, 1u);
+}
+
+TEST(driver_pwm)
+{
+    CommandMotor m;
+    m.begin();
+    m.setDriverCommand(0.5f);
+    VERIFIE_EGAL(hoteBroche(4).pwm, 128);
+    VERIFIE_EGAL(hoteBroche(5).pwm, 0);
+    m.setDriverCommand(2.0f);
+    VERIFIE_EGAL(hoteBroche(4).pwm, 255);
+    m.setDriverCommand(-1.0f);
+    VERIFIE_EGAL(hoteBroche(4).pwm, 0);
+}
+
+TEST(coupure_urgence_verrouille)
+{
+    CommandMotor m;
+    m.begin();
+    m.setDriverCommand(1.0f);
+    m.setServoAngle(180.0f);
+
+    m.coupureUrgence();
+    VERIFIE_EGAL(hoteBroche(4).pwm, 0);
+    VERIFIE_EGAL(hoteServo(SERVO_BALLAST).impulsion_us, impulsion(0.0f));
+    VERIFIE(m.ballastVerrouille());
+
+    // Plus aucune consigne ne remplit le ballast
+    m.setServoAngle(120.0f);
+    m.ballastRemplir();
+    hoteAvance_ms(100);
+    m.update();
+    VERIFIE_EGAL(hoteServo(SERVO_BALLAST).impulsion_us, impulsion(0.0f));
+    VERIFIE_EGAL(hoteProfondeurSectionCritique(), 0);
+}
+
+TEST(direction_non_bloquante)
+{
+    CommandMotor m;
+    m.begin();
+    m.servoDirectionDroite();
+    VERIFIE(m.directionEnMouvement());
+    VERIFIE_EGAL(hoteServo(SERVO_DIRECTION).impulsion_us, impulsion(0.0f));   // FT90R : 0 = vers la droite
+
+    hoteAvance_ms(999);
+    m.update();
+    VERIFIE(m.directionEnMouvement());
+    hoteAvance_ms(1);
+    m.update();
+    VERIFIE(!m.directionEnMouvement());
+    VERIFIE_EGAL(m.getEtatDirection(), 1);
+}
+
+TEST(coupure_immediate_puis_vidage)
+{
+    CommandMotor m;
+    m.begin();
+    m.setDriverCommand(1.0f);
+    m.setServoAngle(120.0f);
+    uint32_t ecritures = hoteServo(SERVO_BALLAST).ecritures;
+
+    // Contexte interruption : driver coupé sans analogWrite ni Servo
+    uint32_t pwm = hoteBroche(4).ecrituresPwm;
+    m.coupureImmediate();
+    VERIFIE(m.coupee());
+    VERIFIE_EGAL(hoteBroche(4).pwm, 0);
+    VERIFIE_EGAL(hoteBroche(4).ecrituresPwm, pwm);
+    VERIFIE_EGAL(hoteServo(SERVO_BALLAST).ecritures, ecritures);
+
+    // Verrou : plus aucune écriture driver ni ballast
+    m.setDriverCommand(1.0f);
+    m.setServoAngle(180.0f);
+    VERIFIE_EGAL(hoteBroche(4).pwm, 0);
+    VERIFIE_EGAL(hoteBroche(4).ecrituresPwm, pwm);
+    VERIFIE_EGAL(hoteServo(SERVO_BALLAST).ecritures, ecritures);
+    VERIFIE_EGAL(m.getDriverPwm(), 0);
+
+    // Tick moteur suivant : ballast vidé et verrouillé
+    hoteAvance_ms(10);
+    m.update();
+    VERIFIE(m.ballastVerrouille());
+    VERIFIE_EGAL(hoteServo(SERVO_BALLAST).impulsion_us, impulsion(0.0f));
+    VERIFIE_EGAL(hoteProfondeurSectionCritique(), 0);
+}
@@ -0,0 +1,141 @@
+#include "Test.h"
+#include "AsservProfond.h"
+#include "Capteurs.h"
+
+// Chemin virgule fixe contre référence float sur des traces complètes :
+// l'écart doit rester borné, intégrale et charge comprises (pas de dérive).
+
+// Suite reproductible (LCG), uniforme dans [mini ; maxi]
+static uint32_t s_graine = 1;
+
+static float uniforme(float mini, float maxi)
+{
+    s_graine = s_graine * 1664525u + 1013904223u;
+    return mini + (maxi - mini) * (float)(s_graine >> 8) * (1.0f / 16777216.0f);
+}
+
+struct DeuxLois
+{
+    LoiPid<float>  f;
+    LoiPid<Q16_16> q;
+    float          ecartMax;
+
+    DeuxLois(float kp, float ki, float kd, float neutre)
+    : ecartMax(0.0f)
+    {
+        f.kp = kp; f.ki = ki; f.kd = kd; f.neutre = neutre; f.integrale = 0.0f;
+        q.kp = reel<Q16_16>(kp); q.ki = reel<Q16_16>(ki); q.kd = reel<Q16_16>(kd);
+        q.neutre = reel<Q16_16>(neutre); q.integrale = Q16_16();
+    }
+
+    void pas(float erreur, float vitesse, float dt)
+    {
+        float cf = f.commande(erreur, vitesse, dt);
+        float cq = q.commande(reel<Q16_16>(erreur), reel<Q16_16>(vitesse), reel<Q16_16>(dt)).versFloat();
+        if (fabsf(cf - cq) > ecartMax) ecartMax = fabsf(cf - cq);
+    }
+
+    float ecartIntegrale() const { return fabsf(f.integrale - q.integrale.versFloat()); }
+};
+
+TEST(pid_plongee)
+{
+    // Descente 0 -> 3 m puis tenue, 20 Hz pendant 10 min : un premier ordre
+    // grossier suffit, les deux lois reçoivent exactement les mêmes entrées
+    DeuxLois l(30.0f, 10.0f, 80.0f, 30.0f);
+    float prof = 0.0f, vitesse = 0.0f;
+    for (uint32_t n = 0; n < 12000; n++) {
+        float erreur = 3.0f - prof;
+        l.pas(erreur, vitesse, 0.05f);
+        float commande = l.f.commande(erreur, vitesse, 0.0f);
+        vitesse += ((commande - 32.0f) * 0.002f - vitesse * 0.5f) * 0.05f;
+        prof    += vitesse * 0.05f + uniforme(-0.002f, 0.002f);
+    }
+    VERIFIE(l.ecartMax < 0.01f);
+    VERIFIE(l.ecartIntegrale() < 0.01f);
+}
+
+TEST(pid_aleatoire)
+{
+    // Entrées quelconques, une sur deux sans nouvel échantillon (dt = 0)
+    s_graine = 1;
+    DeuxLois l(30.0f, 10.0f, 80.0f, 30.0f);
+    for (uint32_t n = 0; n < 100000; n++) {
+        float dt = (n & 1) ? uniforme(0.04f, 0.06f) : 0.0f;
+        l.pas(uniforme(-2.0f, 2.0f), uniforme(-0.3f, 0.3f), dt);
+    }
+    VERIFIE(l.ecartMax < 0.01f);
+    VERIFIE(l.ecartIntegrale() < 0.01f);
+}
+
+TEST(pid_butees_et_anti_windup)
+{
+    // Longues saturations des deux côtés : l'intégrale gelée doit rester
+    // la même dans les deux chemins
+    DeuxLois l(30.0f, 10.0f, 80.0f, 30.0f);
+    for (uint32_t n = 0; n < 20000; n++) {
+        float erreur = ((n / 2000) & 1) ? 8.0f : -8.0f;
+        l.pas(erreur + uniforme(-0.01f, 0.01f), 0.0f, 0.05f);
+    }
+    VERIFIE(l.ecartMax < 0.01f);
+    VERIFIE(l.ecartIntegrale() < 0.01f);
+}
+
+// Deux compteurs contre une intégration en double, au pas de POWER_BATT
+static void traceCoulomb(float courantMin_mA, float courantMax_mA, uint32_t pas,
+                         double& ecartF_mAh, double& ecartQ_mAh)
+{
+    const float    capacite_mAh = 2200.0f;
+    const uint32_t pas_ms       = 100;
+
+    CoulombCounter     cf(capacite_mAh);
+    CoulombCounterFixe cq(capacite_mAh);
+    double reference_mAh = capacite_mAh;
+
+    ecartF_mAh = ecartQ_mAh = 0.0;
+    for (uint32_t n = 0; n < pas; n++) {
+        float courant_mA = uniforme(courantMin_mA, courantMax_mA);
+        cf.integre(courant_mA, pas_ms);
+        cq.integre(courant_mA, pas_ms);
+        reference_mAh -= (double)courant_mA * pas_ms / 3600000.0;
+
+        if (n % 600 == 599) {   // toutes les minutes
+            double f = fabs((double)cf.get_soc() * capacite_mAh / 100.0 - reference_mAh);
+            double q = fabs((double)cq.get_soc() * capacite_mAh / 100.0 - reference_mAh);
+            if (f > ecartF_mAh) ecartF_mAh = f;
+            if (q > ecartQ_mAh) ecartQ_mAh = q;
+        }
+    }
+}
+
+TEST(coulomb_propulsion)
+{
+    s_graine = 1;
+    double f, q;
+    traceCoulomb(50.0f, 2000.0f, 36000, f, q);   // 1 h
+    VERIFIE(q < 0.01);
+    VERIFIE(f < 0.5);
+}
+
+TEST(coulomb_veille)
+{
+    // Faible courant : le pas (4e-3 mAh) est de l'ordre de l'ulp de la
+    // charge float, le chemin fixe reste exact
+    s_graine = 1;
+    double f, q;
+    traceCoulomb(100.0f, 200.0f, 36000 * 4, f, q);   // 4 h
+    VERIFIE(q < 0.01);
+    VERIFIE(q < f);
+}
+
+TEST(coulomb_soc_a_la_demande)
+{
+    CoulombCounterFixe c(2200.0f);
+    VERIFIE_PROCHE(c.get_soc(), 100.0, 1e-4);
+
+    c.integre(2200.0f, 36000);   // 1 % en 36 s à 1 C
+    VERIFIE_PROCHE(c.get_soc(), 99.0, 1e-4);
+    VERIFIE_EGAL(c.soc().brut(), c.soc().brut());   // relu sans changement de charge
+    c.integre(2200.0f, 36000);
+    VERIFIE_PROCHE(c.get_soc(), 98.0, 1e-4);
+}
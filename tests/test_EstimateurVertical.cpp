@@ -0,0 +1,81 @@
+#include "Test.h"
+#include "EstimateurVertical.h"
+
+// Bruit gaussien reproductible (Box-Muller sur un LCG)
+static uint32_t s_graine = 1;
+static float gauss(float sigma)
+{
+    s_graine = s_graine * 1664525u + 1013904223u;
+    float u1 = ((s_graine >> 8) + 1) / 16777217.0f;
+    s_graine = s_graine * 1664525u + 1013904223u;
+    float u2 = (s_graine >> 8) / 16777216.0f;
+    return sigma * sqrtf(-2.0f * logf(u1)) * cosf(6.2831853f * u2);
+}
+
+TEST(premiere_mesure_initialise)
+{
+    EstimateurVertical e;
+    VERIFIE(!e.initialise());
+    e.prediction(100);                 // ignorée tant que non initialisé
+    e.correction(2.0f, 100);
+    VERIFIE(e.initialise());
+    VERIFIE_PROCHE(e.profondeur_m(), 2.0, 0.0);
+    VERIFIE_PROCHE(e.vitesse_mps(), 0.0, 0.0);
+}
+
+TEST(instant_passe_ignore)
+{
+    EstimateurVertical e;
+    e.reset(1.0f, 1000);
+    e.setAcceleration(1.0f);
+    e.prediction(900);
+    VERIFIE_PROCHE(e.profondeur_m(), 1.0, 0.0);
+    e.prediction(1100);
+    VERIFIE_PROCHE(e.vitesse_mps(), 0.1, 1e-6);
+    VERIFIE_PROCHE(e.profondeur_m(), 1.005, 1e-6);
+}
+
+TEST(suit_une_descente_a_vitesse_constante)
+{
+    s_graine = 1;
+    EstimateurVertical e;
+    e.reset(0.0f, 0);
+
+    // 0,2 m/s, mesure MS5837 à 20 Hz (σ 3 mm), IMU à 100 Hz sans accélération
+    for (uint32_t t = 10; t <= 20000; t += 10) {
+        e.setAcceleration(gauss(0.05f));
+        e.prediction(t);
+        if (t % 50 == 0) e.correction(0.2f * t / 1000.0f + gauss(0.003f), t);
+    }
+    VERIFIE_PROCHE(e.profondeur_m(), 4.0, 0.01);
+    VERIFIE_PROCHE(e.vitesse_mps(), 0.2, 0.02);
+    VERIFIE_PROCHE(e.profondeurPredite_m(0.3f), 4.06, 0.015);
+    VERIFIE(e.incertitude_m() < 0.003f);
+}
+
+TEST(estime_le_biais_accelerometre)
+{
+    s_graine = 2;
+    EstimateurVertical e;
+    e.reset(1.0f, 0);
+
+    // Immobile, accéléromètre biaisé de +0,1 m/s²
+    for (uint32_t t = 10; t <= 60000; t += 10) {
+        e.setAcceleration(0.1f + gauss(0.05f));
+        e.prediction(t);
+        if (t % 50 == 0) e.correction(1.0f + gauss(0.003f), t);
+    }
+    VERIFIE_PROCHE(e.biais_mps2(), 0.1, 0.02);
+    VERIFIE_PROCHE(e.vitesse_mps(), 0.0, 0.01);
+}
+
+TEST(trou_de_plus_d_une_seconde)
+{
+    EstimateurVertical e;
+    e.reset(1.0f, 0);
+    e.setAcceleration(1.0f);
+    e.prediction(5000);                // pas de prédiction sur un trou
+    VERIFIE_PROCHE(e.profondeur_m(), 1.0, 0.0);
+    e.prediction(5100);                // reprend depuis t = 5000
+    VERIFIE_PROCHE(e.vitesse_mps(), 0.1, 1e-6);
+}
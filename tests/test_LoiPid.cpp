@@ -0,0 +1,221 @@
+#include "Test.h"
+#include "AsservProfond.h"
+#include "FauxCapteurs.h"
+
+// Mêmes cas pour la référence float et le chemin virgule fixe
+template <typename T>
+static LoiPid<T> loi(float kp, float ki, float kd, float neutre)
+{
+    LoiPid<T> l;
+    l.kp = reel<T>(kp); l.ki = reel<T>(ki); l.kd = reel<T>(kd);
+    l.neutre = reel<T>(neutre); l.integrale = T(0);
+    return l;
+}
+
+template <typename T>
+static float cmd(LoiPid<T>& l, float erreur, float vitesse, float dt)
+{
+    return versFloat(l.commande(reel<T>(erreur), reel<T>(vitesse), reel<T>(dt)));
+}
+
+// Tolérance : quelques LSB Q16.16 après les produits
+static const double TOL = 1e-3;
+
+template <typename T>
+static void proportionnelDerivee()
+{
+    LoiPid<T> l = loi<T>(30.0f, 0.0f, 80.0f, 30.0f);
+    VERIFIE_PROCHE(cmd(l, 1.0f, 0.0f, 0.0f), 60.0, TOL);
+    VERIFIE_PROCHE(cmd(l, -0.5f, 0.0f, 0.0f), 15.0, TOL);
+    // Descente à 0,1 m/s : le terme D retient (+ = vers le fond)
+    VERIFIE_PROCHE(cmd(l, 1.0f, 0.1f, 0.0f), 52.0, TOL);
+}
+
+template <typename T>
+static void butees()
+{
+    LoiPid<T> l = loi<T>(30.0f, 0.0f, 0.0f, 30.0f);
+    VERIFIE_PROCHE(cmd(l, 10.0f, 0.0f, 0.0f), 180.0, 0.0);
+    VERIFIE_PROCHE(cmd(l, -10.0f, 0.0f, 0.0f), 0.0, 0.0);
+}
+
+template <typename T>
+static void integraleBorneeEtAntiWindup()
+{
+    LoiPid<T> l = loi<T>(30.0f, 10.0f, 0.0f, 30.0f);
+
+    // Erreur constante 0,08 m : +0,8 deg/s d'intégrale jusqu'à la borne de 45 deg
+    for (int i = 0; i < 1200; i++) cmd(l, 0.08f, 0.0f, 0.05f);
+    VERIFIE_PROCHE(versFloat(l.integrale), 45.0, TOL);
+
+    // Loin de la consigne en descente : le trim n'est pas appris
+    l.integrale = T(0);
+    for (int i = 0; i < 100; i++) cmd(l, 0.5f, 0.1f, 0.05f);
+    VERIFIE_PROCHE(versFloat(l.integrale), 0.0, TOL);
+
+    // Loin mais immobilisé (gros défaut de trim équilibré par P) : appris
+    for (int i = 0; i < 100; i++) cmd(l, 0.2f, 0.0f, 0.05f);
+    VERIFIE_PROCHE(versFloat(l.integrale), 10.0, TOL);
+    l.integrale = T(0);
+
+    // En butée haute avec une erreur qui y pousse : intégrale gelée
+    l.integrale = T(0);
+    l.neutre = reel<T>(178.0f);
+    cmd(l, 0.08f, 0.0f, 0.05f);                   // 178 + 2,4 > 180
+    VERIFIE_PROCHE(versFloat(l.integrale), 0.0, TOL);
+
+    // Erreur de signe opposé en butée haute : l'intégrale peut en sortir
+    l.integrale = reel<T>(20.0f);
+    cmd(l, -0.05f, 0.0f, 0.4f);
+    VERIFIE_PROCHE(versFloat(l.integrale), 19.8, TOL);
+}
+
+template <typename T>
+static void repriseSansACoup()
+{
+    LoiPid<T> l = loi<T>(30.0f, 10.0f, 80.0f, 30.0f);
+    l.reprise(reel<T>(0.4f), reel<T>(70.0f));
+    VERIFIE_PROCHE(cmd(l, 0.4f, 0.0f, 0.0f), 70.0, TOL);
+
+    // Au-delà de l'autorité intégrale : bornée, la sortie ne part plus de l'angle actuel
+    l.reprise(reel<T>(0.0f), reel<T>(170.0f));
+    VERIFIE_PROCHE(versFloat(l.integrale), 45.0, TOL);
+
+    // Sans terme intégral, rien ne résorberait un décalage : intégrale nulle
+    LoiPid<T> p = loi<T>(30.0f, 0.0f, 0.0f, 30.0f);
+    p.reprise(reel<T>(0.0f), reel<T>(90.0f));
+    VERIFIE_PROCHE(versFloat(p.integrale), 0.0, 0.0);
+}
+
+template <typename T>
+static void filtreVitesse()
+{
+    // 1er ordre : tend vers la dérivée brute, 63 % environ après tf
+    T v = T(0);
+    for (int i = 0; i < 4; i++) v = LoiPid<T>::filtreVitesse(v, reel<T>(1.0f), reel<T>(0.05f), reel<T>(0.2f));
+    VERIFIE_PROCHE(versFloat(v), 1.0 - pow(0.8, 4), TOL);
+}
+
+TEST(proportionnel_derivee_float)  { proportionnelDerivee<float>(); }
+TEST(proportionnel_derivee_fixe)   { proportionnelDerivee<Q16_16>(); }
+TEST(butees_float)                 { butees<float>(); }
+TEST(butees_fixe)                  { butees<Q16_16>(); }
+TEST(integrale_float)              { integraleBorneeEtAntiWindup<float>(); }
+TEST(integrale_fixe)               { integraleBorneeEtAntiWindup<Q16_16>(); }
+TEST(reprise_float)                { repriseSansACoup<float>(); }
+TEST(reprise_fixe)                 { repriseSansACoup<Q16_16>(); }
+TEST(filtre_vitesse_float)         { filtreVitesse<float>(); }
+TEST(filtre_vitesse_fixe)          { filtreVitesse<Q16_16>(); }
+
+// =====================
+//   Tenue de profondeur (AsservProfond) sur le bus factice
+// =====================
+
+// MS5837 immobile à la surface : consigne 0,5 m -> erreur constante
+struct BancAsserv
+{
+    FauxBNO055   bno;
+    FauxMS5837   puce;
+    CommandMotor motor;
+    Capteurs     capteurs;
+    AsservProfond asserv;
+
+    BancAsserv()
+    : capteurs(0x28, 0x40, 0x41, 0x27, 0x76, 2200.0f)
+    , asserv(&motor, &capteurs)
+    {
+        puce.regleModele02BA(true);
+        puce.reglePression(1013.0f, 15.0f);
+        Wire.branche(FauxBNO055::ADRESSE, &bno);
+        Wire.branche(FauxMS5837::ADRESSE, &puce);
+        motor.begin();
+        motor.setLimiteurServo(0.0f, 0.0f, 0.0f);
+        capteurs.begin();
+        asserv.setGains(30.0f, 10.0f, 0.0f);
+        asserv.setAngleNeutre(30.0f);
+        mesure(200);
+    }
+
+    ~BancAsserv()
+    {
+        Wire.debranche(FauxBNO055::ADRESSE);
+        Wire.debranche(FauxMS5837::ADRESSE);
+    }
+
+    // Capteurs au pas de leur tâche (5 ms), sans asservissement
+    void mesure(uint32_t duree_ms)
+    {
+        for (uint32_t t = 0; t < duree_ms; t += 5) {
+            hoteAvance_ms(5);
+            capteurs.update();
+        }
+    }
+
+    // Tenue au pas de la tâche contrôle (40 ms)
+    void tiens(float cible_m, uint32_t duree_ms)
+    {
+        for (uint32_t t = 0; t < duree_ms; t += 40) {
+            mesure(40);
+            asserv.setProfondeurVoulue(cible_m);
+        }
+    }
+};
+
+TEST(debut_de_tenue_sans_angle_parque)
+{
+    BancAsserv* b = new BancAsserv();
+
+    // Servo parqué à 90 deg (Controller::stop) : sans influence sur l'intégrale
+    b->motor.setServoAngle(90.0f);
+    b->asserv.setProfondeurVoulue(0.05f);
+    VERIFIE_PROCHE(b->asserv.getIntegrale(), 0.0, TOL);
+
+    // Trim appris près de la consigne, gardé d'une tenue à la suivante
+    b->tiens(0.05f, 2000);
+    float trim = b->asserv.getIntegrale();
+    VERIFIE(trim > 0.5f);
+    b->asserv.arrete();
+    b->motor.setServoAngle(0.0f);   // remontée : ballast vidé
+    b->asserv.setProfondeurVoulue(0.05f);
+    VERIFIE_PROCHE(b->asserv.getIntegrale(), trim, 0.1);
+    delete b;
+}
+
+TEST(reprise_capteur_revenu_sans_a_coup)
+{
+    BancAsserv* b = new BancAsserv();
+    b->tiens(0.05f, 400);
+
+    // MS5837 muet en pleine tenue : ballast au neutre
+    hoteAvance_ms(600);
+    b->asserv.setProfondeurVoulue(0.05f);
+    VERIFIE_PROCHE(b->motor.getServoConsigne(), 30.0, 0.01);
+
+    // Capteur revenu : la commande repart de l'angle courant
+    b->mesure(100);
+    b->asserv.setProfondeurVoulue(0.05f);
+    VERIFIE_PROCHE(b->motor.getServoConsigne(), 30.0, 0.1);
+    delete b;
+}
+
+
+TEST(tenue_sur_profondeur_filtree)
+{
+    BancAsserv* b = new BancAsserv();
+
+    // Descente à 0,2 m/s : P sur la profondeur filtrée, pas sur la prédite
+    // (la vitesse n'a sa place que dans D, nul ici)
+    float prof = 0.0f;
+    for (int i = 0; i < 50; i++) {
+        prof += 0.2f * 0.04f;
+        b->puce.reglePression(1013.0f + 997.0f * 9.80665f * prof / 100.0f, 15.0f);
+        b->mesure(40);
+        b->asserv.setProfondeurVoulue(0.5f);
+    }
+    const DepthData& d = b->capteurs.getDepthData();
+    VERIFIE(d.vitesseVerticale_mps > 0.15f);
+    VERIFIE(d.profondeurPredite_m - d.profondeurFiltree_m > 0.045f);
+    float attendu = 30.0f + 30.0f * (0.5f - d.profondeurFiltree_m) + b->asserv.getIntegrale();
+    VERIFIE_PROCHE(b->motor.getServoConsigne(), attendu, 0.3);
+    delete b;
+}
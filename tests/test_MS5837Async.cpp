@@ -0,0 +1,137 @@
+#include "Test.h"
+#include "MS5837Async.h"
+#include "FauxCapteurs.h"
+
+struct Banc
+{
+    FauxMS5837  puce;
+    MS5837Async baro;
+
+    Banc() : baro(Wire, FauxMS5837::ADRESSE) { Wire.branche(FauxMS5837::ADRESSE, &puce); }
+    ~Banc() { Wire.debranche(FauxMS5837::ADRESSE); }
+
+    // Un cycle D1/D2 complet, poll() toutes les ms
+    bool mesure()
+    {
+        if (!baro.startConversion(micros())) return false;
+        for (int i = 0; i < 100; i++) {
+            hoteAvance_us(1000);
+            if (baro.poll(micros())) return true;
+        }
+        return false;
+    }
+};
+
+TEST(init_crc)
+{
+    Banc b;
+    VERIFIE(b.baro.init());
+
+    // Un coefficient corrompu : CRC faux
+    b.puce.regleMotProm(3, b.puce.prom(3) ^ 0x0100);
+    VERIFIE(!b.baro.init());
+}
+
+TEST(absent)
+{
+    MS5837Async baro(Wire, FauxMS5837::ADRESSE);
+    VERIFIE(!baro.init());
+}
+
+// Exemple de la datasheet MS5837-30BA : D1 = 4958179, D2 = 6815414
+TEST(compensation_exemple_datasheet)
+{
+    Banc b;
+    VERIFIE(b.baro.init());
+    VERIFIE(b.mesure());
+    VERIFIE_PROCHE(b.baro.pressure_mbar(), 3999.8, 0.05);
+    VERIFIE_PROCHE(b.baro.temperature_C(), 19.82, 0.005);
+}
+
+// Second ordre : froid (< 20 °C, < -15 °C) et chaud, contre la compensation de référence
+TEST(compensation_second_ordre)
+{
+    Banc b;
+    VERIFIE(b.baro.init());
+
+    static const float cas[][2] = {
+        { 1013.0f, 25.0f }, { 1013.0f, 10.0f }, { 3000.0f, 4.0f },
+        { 1500.0f, -20.0f }, { 25000.0f, 30.0f }
+    };
+    for (size_t i = 0; i < sizeof(cas) / sizeof(cas[0]); i++) {
+        b.puce.reglePression(cas[i][0], cas[i][1]);
+        VERIFIE(b.mesure());
+        float p, t;
+        b.puce.compense(b.puce.d1(), b.puce.d2(), p, t);
+        VERIFIE_PROCHE(b.baro.pressure_mbar(), p, 1e-3);
+        VERIFIE_PROCHE(b.baro.temperature_C(), t, 1e-3);
+        VERIFIE_PROCHE(b.baro.pressure_mbar(), cas[i][0], 0.15);
+        VERIFIE_PROCHE(b.baro.temperature_C(), cas[i][1], 0.015);
+    }
+}
+
+TEST(modele_02BA)
+{
+    Banc b;
+    VERIFIE(b.baro.init());
+    b.baro.setModel(MS5837Async::MODEL_02BA);
+    b.puce.regleModele02BA(true);
+
+    b.puce.reglePression(1013.25f, 12.0f);
+    VERIFIE(b.mesure());
+    VERIFIE_PROCHE(b.baro.pressure_mbar(), 1013.25, 0.015);
+    VERIFIE_PROCHE(b.baro.temperature_C(), 12.0, 0.015);
+}
+
+TEST(profondeur)
+{
+    Banc b;
+    VERIFIE(b.baro.init());
+    b.baro.setFluidDensity(1000.0f);
+    // 101300 Pa + 1000 kg/m³ x g x 2 m
+    b.puce.reglePression((101300.0f + 1000.0f * 9.80665f * 2.0f) / 100.0f, 18.0f);
+    VERIFIE(b.mesure());
+    VERIFIE_PROCHE(b.baro.depth_m(), 2.0, 0.002);
+}
+
+TEST(profondeur_fixe_contre_float)
+{
+    Banc b;
+    VERIFIE(b.baro.init());
+    b.baro.setModel(MS5837Async::MODEL_02BA);
+    b.puce.regleModele02BA(true);
+    b.baro.setFluidDensity(997.0f);
+
+    // Surface à 10 m, 02BA (Pa entiers) : même profondeur sans flottant
+    for (int cm = 0; cm <= 1000; cm += 37) {
+        b.puce.reglePression((101300.0f + 997.0f * 9.80665f * cm / 100.0f) / 100.0f, 12.0f);
+        VERIFIE(b.mesure());
+        VERIFIE_PROCHE(b.baro.profondeur().versFloat(), b.baro.depth_m(), 1e-3);
+    }
+}
+
+TEST(deux_phases_sans_blocage)
+{
+    Banc b;
+    VERIFIE(b.baro.init());
+    uint32_t t0 = micros();
+    VERIFIE(b.baro.startConversion(t0));
+    VERIFIE(b.baro.busy());
+    VERIFIE(!b.baro.startConversion(t0));      // cycle déjà en cours
+
+    // Avant 20 ms : aucune transaction
+    uint32_t avant = Wire.transactions();
+    hoteAvance_us(19000);
+    VERIFIE(!b.baro.poll(micros()));
+    VERIFIE_EGAL(Wire.transactions(), avant);
+
+    // D1 lu, D2 lancé ; puis échantillon complet 20 ms plus tard
+    hoteAvance_us(1000);
+    VERIFIE(!b.baro.poll(micros()));
+    VERIFIE_EGAL(b.puce.conversions(), 2u);
+    hoteAvance_us(20000);
+    VERIFIE(b.baro.poll(micros()));
+    VERIFIE(!b.baro.busy());
+    VERIFIE_EGAL(b.baro.sampleCount(), 1u);
+    VERIFIE_EGAL(b.baro.lastCycle_us(), 40000u);
+}
@@ -0,0 +1,81 @@
+#include "Test.h"
+#include "PointFixe.h"
+
+TEST(depuis_float_arrondi)
+{
+    VERIFIE_EGAL(Q16_16::depuisFloat(1.0f).brut(), 65536);
+    VERIFIE_EGAL(Q16_16::depuisFloat(-1.5f).brut(), -98304);
+    VERIFIE_EGAL(Q16_16::depuisFloat(0.0f).brut(), 0);
+    VERIFIE_EGAL(Q16_16::depuisFloat(-0.0f).brut(), 0);
+
+    // Au plus un demi-LSB d'écart avec la conversion double
+    uint32_t graine = 7;
+    for (int i = 0; i < 200000; i++) {
+        graine ^= graine << 13; graine ^= graine >> 17; graine ^= graine << 5;
+        float v = ((int32_t)graine / 2147483648.0f) * 30000.0f;
+        double attendu = (double)v * 65536.0;
+        VERIFIE(fabs((double)Q16_16::depuisFloat(v).brut() - attendu) <= 0.5);
+
+        float u = ((int32_t)graine / 2147483648.0f) * 100.0f;
+        VERIFIE(fabs((double)Q8_24::depuisFloat(u).brut() - (double)u * 16777216.0) <= 0.5);
+    }
+}
+
+TEST(depuis_float_special)
+{
+    VERIFIE_EGAL(Q16_16::depuisFloat(NAN).brut(), 0);
+    VERIFIE_EGAL(Q16_16::depuisFloat(INFINITY).brut(), Q16_16::BRUT_MAX);
+    VERIFIE_EGAL(Q16_16::depuisFloat(-INFINITY).brut(), Q16_16::BRUT_MIN);
+    VERIFIE_EGAL(Q16_16::depuisFloat(1e9f).brut(), Q16_16::BRUT_MAX);
+    VERIFIE_EGAL(Q16_16::depuisFloat(-1e9f).brut(), Q16_16::BRUT_MIN);
+    VERIFIE_EGAL(Q8_24::depuisFloat(200.0f).brut(), Q8_24::BRUT_MAX);
+    VERIFIE_EGAL(Q16_16::depuisFloat(1e-30f).brut(), 0);
+}
+
+TEST(constante_et_entier)
+{
+    static constexpr Q16_16 c = Q16_16::constante(0.3f);
+    VERIFIE_EGAL(c.brut(), 19661);
+    VERIFIE_EGAL(Q16_16(100).brut(), 100 * 65536);
+    VERIFIE_EGAL(Q16_16(40000).brut(), Q16_16::BRUT_MAX);    // > ENT_MAX : saturé
+    VERIFIE_EGAL(Q16_16(-40000).brut(), Q16_16::BRUT_MIN);
+}
+
+TEST(arithmetique_saturee)
+{
+    Q16_16 grand = Q16_16(30000);
+    VERIFIE_EGAL((grand + grand).brut(), Q16_16::BRUT_MAX);
+    VERIFIE_EGAL((-grand - grand).brut(), Q16_16::BRUT_MIN);
+    VERIFIE_EGAL((grand * Q16_16(2)).brut(), Q16_16::BRUT_MAX);
+    VERIFIE_EGAL((-Q16_16::depuisBrut(Q16_16::BRUT_MIN)).brut(), Q16_16::BRUT_MAX);
+
+    VERIFIE_PROCHE((Q16_16(3) * Q16_16::depuisFloat(0.25f)).versFloat(), 0.75, 1e-9);
+    VERIFIE_PROCHE((Q16_16(1) / Q16_16(3)).versFloat(), 1.0 / 3.0, 1.0 / 65536);
+    VERIFIE_PROCHE((Q16_16(-1) / Q16_16(3)).versFloat(), -1.0 / 3.0, 1.0 / 65536);
+}
+
+TEST(division_par_zero)
+{
+    VERIFIE_EGAL((Q16_16(5) / Q16_16()).brut(), Q16_16::BRUT_MAX);
+    VERIFIE_EGAL((Q16_16(-5) / Q16_16()).brut(), Q16_16::BRUT_MIN);
+    VERIFIE_EGAL((Q16_16() / Q16_16()).brut(), 0);
+}
+
+TEST(arrondi_et_fraction)
+{
+    VERIFIE_EGAL(Q16_16::depuisFloat(2.5f).arrondi(), 3);
+    VERIFIE_EGAL(Q16_16::depuisFloat(-2.5f).arrondi(), -2);   // demi vers +inf
+    VERIFIE_EGAL(Q16_16::depuisFloat(-2.6f).arrondi(), -3);
+
+    VERIFIE_EGAL(fraction<Q16_16>(1, 3).brut(), 21845);
+    VERIFIE_EGAL(fraction<Q16_16>(2, 3).brut(), 43691);       // arrondi, pas tronqué
+    VERIFIE_EGAL(fraction<Q16_16>(-2, 3).brut(), -43691);
+    VERIFIE_PROCHE(fraction<float>(40, 1000), 0.04, 1e-9);
+}
+
+TEST(borne_reel)
+{
+    VERIFIE(borneReel(Q16_16(200), Q16_16(0), Q16_16(180)) == Q16_16(180));
+    VERIFIE(borneReel(Q16_16(-1), Q16_16(0), Q16_16(180)) == Q16_16(0));
+    VERIFIE_PROCHE(borneReel(50.0f, 0.0f, 180.0f), 50.0, 0.0);
+}
@@ -0,0 +1,132 @@
+#include "Test.h"
+#include "ReponseHttp.h"
+
+class Capture : public Print
+{
+public:
+    std::string texte;
+    size_t write(uint8_t c) override { texte += (char)c; return 1; }
+    size_t write(const uint8_t* b, size_t n) override { texte.append((const char*)b, n); return n; }
+    using Print::write;
+};
+
+static std::string fixe(float v, uint8_t decimales)
+{
+    char tampon[32];
+    ReponseHttp r(tampon, sizeof(tampon));
+    r.ajouteFixe(v, decimales);
+    return std::string(tampon, r.taille());
+}
+
+TEST(reponse_complete_content_length)
+{
+    char tampon[256];
+    ReponseHttp r(tampon, sizeof(tampon));
+    r.statut(200);
+    r.entete("Content-Type", "application/json");
+    r.finEntetes();
+    r.ajoute('{');
+    r.cleJson("a"); r.ajouteEntier(-12);
+    r.cleJson("b"); r.ajouteBool(true);
+    r.ajoute('}');
+
+    Capture c;
+    VERIFIE_EGAL(r.envoie(c), c.texte.size());
+    VERIFIE_TEXTE(c.texte.c_str(),
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: application/json\r\n"
+        "Content-Length: 18\r\n"
+        "Connection: close\r\n"
+        "\r\n"
+        "{\"a\":-12,\"b\":true}");
+}
+
+TEST(longueur_externe)
+{
+    char tampon[128];
+    ReponseHttp r(tampon, sizeof(tampon));
+    r.statut(200);
+    r.finEntetes();
+    r.termine(1000);
+    VERIFIE(std::string(tampon, r.taille()).find("Content-Length: 1000\r\n") != std::string::npos);
+}
+
+TEST(debordement_donne_500)
+{
+    char tampon[96];
+    ReponseHttp r(tampon, sizeof(tampon));
+    r.statut(200);
+    r.finEntetes();
+    for (int i = 0; i < 20; i++) r.ajoute("0123456789");
+    VERIFIE(r.debordement());
+
+    r.termine();
+    VERIFIE(std::string(tampon, r.taille()).compare(0, 12, "HTTP/1.1 500") == 0);
+}
+
+TEST(ajoute_fixe)
+{
+    VERIFIE_TEXTE(fixe(1.5f, 2).c_str(), "1.50");
+    VERIFIE_TEXTE(fixe(-3.14159f, 3).c_str(), "-3.142");
+    VERIFIE_TEXTE(fixe(0.999f, 2).c_str(), "1.00");     // retenue sur l'entier
+    VERIFIE_TEXTE(fixe(-0.004f, 2).c_str(), "0.00");    // pas de "-0.00"
+    VERIFIE_TEXTE(fixe(0.05f, 1).c_str(), "0.1");
+    VERIFIE_TEXTE(fixe(1234.0f, 0).c_str(), "1234");
+    VERIFIE_TEXTE(fixe(NAN, 2).c_str(), "null");
+    VERIFIE_TEXTE(fixe(INFINITY, 2).c_str(), "null");
+    VERIFIE_TEXTE(fixe(5e9f, 2).c_str(), "null");
+}
+
+TEST(decoupe_decimal_valeurs_exactes)
+{
+    bool neg;
+    uint32_t e, f;
+
+    VERIFIE(ReponseHttp::decoupeDecimal(0.125f, 2, neg, e, f));   // exact en binaire : .5 arrondi au-dessus
+    VERIFIE(!neg); VERIFIE_EGAL(e, 0u); VERIFIE_EGAL(f, 13u);
+
+    VERIFIE(ReponseHttp::decoupeDecimal(-2147483648.0f, 0, neg, e, f));
+    VERIFIE(neg); VERIFIE_EGAL(e, 2147483648u); VERIFIE_EGAL(f, 0u);
+
+    VERIFIE(ReponseHttp::decoupeDecimal(1e-30f, 6, neg, e, f));
+    VERIFIE_EGAL(e, 0u); VERIFIE_EGAL(f, 0u);
+
+    VERIFIE(!ReponseHttp::decoupeDecimal(4.0e9f, 2, neg, e, f));
+    VERIFIE(!ReponseHttp::decoupeDecimal(NAN, 2, neg, e, f));
+}
+
+// Chemin entier et référence float : au plus une unité du dernier chiffre
+TEST(decoupe_decimal_contre_flottant)
+{
+    static const uint32_t p10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+    uint32_t graine = 12345;
+    for (int i = 0; i < 100000; i++) {
+        graine = graine * 1664525u + 1013904223u;
+        float v = ((int32_t)graine / 2147483648.0f) * (float)(1u << (graine % 24));
+        uint8_t d = (graine >> 8) % 7;
+
+        bool nf, nq;
+        uint32_t ef, ff, eq, fq;
+        bool okF = ReponseHttp::decoupeDecimalFlottant(v, d, nf, ef, ff);
+        bool okQ = ReponseHttp::decoupeDecimal(v, d, nq, eq, fq);
+        VERIFIE_EGAL(okF, okQ);
+        if (!okF) continue;
+
+        int64_t a = (int64_t)ef * p10[d] + ff;
+        int64_t b = (int64_t)eq * p10[d] + fq;
+        VERIFIE(llabs(a - b) <= 1);
+    }
+}
+
+TEST(statut_406)
+{
+    VERIFIE_TEXTE(ReponseHttp::texteStatut(406), "Not Acceptable");
+
+    char tampon[96];
+    ReponseHttp r(tampon, sizeof(tampon));
+    r.statut(406);
+    r.finEntetes();
+    Capture c;
+    r.envoie(c);
+    VERIFIE(c.texte.compare(0, 28, "HTTP/1.1 406 Not Acceptable\r") == 0);
+}
@@ -0,0 +1,166 @@
+#include "Test.h"
+#include "RequeteHttp.h"
+#include <limits.h>
+
+static RequeteHttp::Etat alimente(RequeteHttp& r, const char* texte)
+{
+    RequeteHttp::Etat e = r.etat();
+    while (*texte && !r.terminee()) e = r.feed(*texte++);
+    return e;
+}
+
+TEST(ligne_et_query)
+{
+    RequeteHttp r;
+    VERIFIE(alimente(r, "GET /cmd?c=z&v=12 HTTP/1.1\r\nHost: poisson\r\n\r\n") == RequeteHttp::COMPLETE);
+    VERIFIE_TEXTE(r.methode(), "GET");
+    VERIFIE_TEXTE(r.chemin(), "/cmd");
+    VERIFIE_TEXTE(r.query(), "c=z&v=12");
+    VERIFIE(r.estMethode("GET"));
+
+    char c = 0;
+    VERIFIE(r.parametreChar("c", c));
+    VERIFIE_EGAL(c, 'z');
+    long v = 0;
+    VERIFIE(r.parametreEntier("v", v));
+    VERIFIE_EGAL(v, 12);
+    VERIFIE(!r.parametreEntier("absent", v));
+}
+
+TEST(sans_query)
+{
+    RequeteHttp r;
+    alimente(r, "GET / HTTP/1.1\r\n\r\n");
+    VERIFIE(r.etat() == RequeteHttp::COMPLETE);
+    VERIFIE_TEXTE(r.chemin(), "/");
+    VERIFIE_TEXTE(r.query(), "");
+}
+
+TEST(octet_par_octet_sur_plusieurs_ticks)
+{
+    RequeteHttp r;
+    alimente(r, "GET /da");
+    VERIFIE(r.etat() == RequeteHttp::LIGNE);
+    alimente(r, "ta HTTP/1.1\r\nAccept: */*\r");
+    VERIFIE(r.etat() == RequeteHttp::ENTETES);
+    alimente(r, "\n\r\n");
+    VERIFIE(r.etat() == RequeteHttp::COMPLETE);
+    VERIFIE_TEXTE(r.chemin(), "/data");
+}
+
+TEST(parametres)
+{
+    RequeteHttp r;
+    alimente(r, "GET /pid?kp=30.5&ki=-.25&kd=&x&neg=-42&mauvais=1a HTTP/1.1\r\n\r\n");
+
+    float f = 0.0f;
+    VERIFIE(r.parametreDecimal("kp", f));
+    VERIFIE_PROCHE(f, 30.5, 1e-5);
+    VERIFIE(r.parametreDecimal("ki", f));
+    VERIFIE_PROCHE(f, -0.25, 1e-6);
+    VERIFIE(!r.parametreDecimal("kd", f));     // vide
+    VERIFIE(!r.parametreDecimal("x", f));      // sans '='
+
+    const char* valeur;
+    uint8_t n;
+    VERIFIE(r.parametre("x", valeur, n));
+    VERIFIE_EGAL(n, 0);
+
+    long v = 0;
+    VERIFIE(r.parametreEntier("neg", v));
+    VERIFIE_EGAL(v, -42);
+    VERIFIE(!r.parametreEntier("mauvais", v));
+
+    // Préfixe d'un autre nom : pas de faux positif
+    VERIFIE(!r.parametre("k", valeur, n));
+}
+
+TEST(entier_sans_debordement)
+{
+    // Bornes de long (32 bits sur la carte, 64 sur le PC) : acceptées
+    // exactement, un chiffre de plus est refusé au lieu de reboucler
+    char requete[160];
+    snprintf(requete, sizeof(requete),
+             "GET /cmd?max=%ld&min=%ld&trop=%ld0&sous=%ld0&plus=%lu HTTP/1.1\r\n\r\n",
+             LONG_MAX, LONG_MIN, LONG_MAX, LONG_MIN, (unsigned long)LONG_MAX + 1);
+
+    RequeteHttp r;
+    alimente(r, requete);
+
+    long v = 7;
+    VERIFIE(r.parametreEntier("max", v));
+    VERIFIE_EGAL(v, LONG_MAX);
+    VERIFIE(r.parametreEntier("min", v));
+    VERIFIE_EGAL(v, LONG_MIN);
+
+    v = 7;
+    VERIFIE(!r.parametreEntier("trop", v));
+    VERIFIE(!r.parametreEntier("sous", v));
+    VERIFIE(!r.parametreEntier("plus", v));
+    VERIFIE_EGAL(v, 7);   // inchangé sur refus
+}
+
+TEST(if_none_match)
+{
+    RequeteHttp r;
+    alimente(r, "GET / HTTP/1.1\r\nif-none-match:  \"abc123\" \r\n\r\n");
+    VERIFIE(r.etat() == RequeteHttp::COMPLETE);
+    VERIFIE_TEXTE(r.ifNoneMatch(), "\"abc123\"");
+}
+
+static RequeteHttp* avecEncodage(const char* valeur)
+{
+    static RequeteHttp r;
+    char requete[128];
+    r.reset();
+    if (valeur) snprintf(requete, sizeof(requete), "GET / HTTP/1.1\r\nAccept-Encoding: %s\r\n\r\n", valeur);
+    else        snprintf(requete, sizeof(requete), "GET / HTTP/1.1\r\nHost: poisson\r\n\r\n");
+    alimente(r, requete);
+    return &r;
+}
+
+TEST(accept_encoding)
+{
+    // Sans en-tête : identité seule
+    VERIFIE(!avecEncodage(nullptr)->accepteGzip());
+    VERIFIE(avecEncodage(nullptr)->accepteIdentite());
+
+    // Navigateurs
+    VERIFIE(avecEncodage("gzip, deflate, br, zstd")->accepteGzip());
+    VERIFIE(avecEncodage("deflate,GZIP")->accepteGzip());
+    VERIFIE(avecEncodage("br;q=1.0, gzip;q=0.8, *;q=0.1")->accepteGzip());
+    VERIFIE(avecEncodage("*")->accepteGzip());
+
+    // Refus explicites
+    VERIFIE(!avecEncodage("deflate, br")->accepteGzip());
+    VERIFIE(!avecEncodage("gzip;q=0, deflate")->accepteGzip());
+    VERIFIE(!avecEncodage("gzip; q=0.000")->accepteGzip());
+    VERIFIE(avecEncodage("gzip;q=0.001")->accepteGzip());
+    VERIFIE(!avecEncodage("*;q=0, deflate")->accepteGzip());
+    VERIFIE(!avecEncodage("*;q=0, deflate")->accepteIdentite());
+    VERIFIE(!avecEncodage("br, identity;q=0")->accepteIdentite());
+    VERIFIE(avecEncodage("identity, *;q=0")->accepteIdentite());
+    VERIFIE(avecEncodage("gzip")->accepteIdentite());
+}
+
+TEST(erreurs)
+{
+    RequeteHttp r;
+    VERIFIE(alimente(r, "GET\r\n") == RequeteHttp::ERREUR);
+    VERIFIE_EGAL(r.codeErreur(), 400);
+
+    r.reset();
+    VERIFIE(alimente(r, "GET pasdeslash HTTP/1.1\r\n") == RequeteHttp::ERREUR);
+    VERIFIE_EGAL(r.codeErreur(), 400);
+
+    r.reset();
+    std::string longue = "GET /" + std::string(RequeteHttp::TAILLE_LIGNE, 'a');
+    VERIFIE(alimente(r, longue.c_str()) == RequeteHttp::ERREUR);
+    VERIFIE_EGAL(r.codeErreur(), 414);
+
+    r.reset();
+    alimente(r, "GET / HTTP/1.1\r\n");
+    std::string entetes(RequeteHttp::MAX_ENTETES + 1, 'h');
+    VERIFIE(alimente(r, entetes.c_str()) == RequeteHttp::ERREUR);
+    VERIFIE_EGAL(r.codeErreur(), 431);
+}
@@ -0,0 +1,108 @@
+#include "Test.h"
+#include "Scheduler.h"
+
+static int s_a, s_b, s_fond;
+static uint32_t s_dureeB_us;
+
+static void tacheA()    { s_a++; }
+static void tacheB()    { s_b++; hoteAvance_us(s_dureeB_us); }
+static void tacheFond() { s_fond++; }
+
+static void raz()
+{
+    s_a = s_b = s_fond = 0;
+    s_dureeB_us = 0;
+}
+
+TEST(periode_exacte)
+{
+    raz();
+    Scheduler s;
+    s.addTask("a", tacheA, 1000, 0);
+    s.begin();
+
+    // 10 ms à pas de 100 µs : 10 exécutions (t = 0, 1, ..., 9 ms)
+    for (int i = 0; i < 100; i++) { s.run(); hoteAvance_us(100); }
+    VERIFIE_EGAL(s_a, 10);
+    VERIFIE_EGAL(s.task(0).overruns, 0u);
+    VERIFIE_EGAL(s.task(0).retard.max_us(), 0u);
+}
+
+TEST(priorite_puis_echeance)
+{
+    raz();
+    Scheduler s;
+    s.addTask("b", tacheB, 1000, 1);
+    s.addTask("a", tacheA, 1000, 0);
+    s.begin();
+
+    // Les deux sont dues : la plus prioritaire d'abord, une par passage
+    s.run();
+    VERIFIE_EGAL(s_a, 1);
+    VERIFIE_EGAL(s_b, 0);
+    s.run();
+    VERIFIE_EGAL(s_b, 1);
+}
+
+TEST(fond_seulement_sans_tache_due)
+{
+    raz();
+    Scheduler s;
+    s.addTask("a", tacheA, 1000, 0);
+    s.addBackgroundTask("fond", tacheFond);
+    s.begin();
+
+    s.run();                 // a est due
+    VERIFIE_EGAL(s_fond, 0);
+    s.run();                 // rien de dû
+    VERIFIE_EGAL(s_fond, 1);
+    VERIFIE_EGAL(s.tempsDisponible_us(), 1000u);
+
+    hoteAvance_us(400);
+    VERIFIE_EGAL(s.tempsDisponible_us(), 600u);
+    hoteAvance_us(600);
+    VERIFIE_EGAL(s.tempsDisponible_us(), 0u);
+}
+
+TEST(overrun_recale_sans_rattrapage)
+{
+    raz();
+    Scheduler s;
+    s.addTask("b", tacheB, 1000, 0);
+    s.begin();
+
+    s_dureeB_us = 2500;      // dépasse deux périodes
+    s.run();
+    VERIFIE_EGAL(s.task(0).overruns, 1u);
+    VERIFIE_EGAL(s.task(0).duree.max_us(), 2500u);
+
+    // Prochaine échéance : fin + période, pas les créneaux perdus
+    s_dureeB_us = 0;
+    s.run();
+    VERIFIE_EGAL(s_b, 1);
+    hoteAvance_us(1000);
+    s.run();
+    VERIFIE_EGAL(s_b, 2);
+}
+
+TEST(rebouclage_micros)
+{
+    raz();
+    Scheduler s;
+    hoteAvance_us(0xFFFFFFFFu - 1500);   // 1,5 ms avant le rebouclage 32 bits
+    s.addTask("a", tacheA, 1000, 0);
+    s.begin();
+
+    for (int i = 0; i < 50; i++) { s.run(); hoteAvance_us(100); }
+    VERIFIE_EGAL(s_a, 5);
+    VERIFIE_EGAL(s.task(0).overruns, 0u);
+}
+
+TEST(table_pleine)
+{
+    raz();
+    Scheduler s;
+    for (uint8_t i = 0; i < Scheduler::MAX_TASKS; i++) VERIFIE(s.addTask("a", tacheA, 1000, 0) == (int8_t)i);
+    VERIFIE(s.addTask("a", tacheA, 1000, 0) == -1);
+    VERIFIE(s.addTask("nul", nullptr, 1000, 0) == -1);
+}
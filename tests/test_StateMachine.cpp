@@ -0,0 +1,105 @@
+#include "Test.h"
+#include "StateMachine.h"
+#include "Journal.h"
+
+#include <string>
+
+// Machine d'état sur capteurs non démarrés : seules les entrées d'état et
+// l'urgence sont observées (journal capturé, écritures servo comptées)
+
+static const uint8_t SERVO_BALLAST = 3;
+
+struct Banc
+{
+    CommandMotor motor;
+    Capteurs     capteurs;
+    Safety       safety;
+    StateMachine sm;
+
+    Banc()
+    : sm(motor, capteurs, safety)
+    {
+        hoteSerieCapture(true);
+        journal.vidange();   // messages des tests précédents
+        hoteSerieEfface();
+        motor.begin();
+        safety.begin();
+        sm.begin();
+    }
+
+    // update() au pas de la tâche contrôle, jusqu'à t + duree_ms
+    void tourne(uint32_t duree_ms, uint32_t pas_ms)
+    {
+        for (uint32_t t = 0; t < duree_ms; t += pas_ms) {
+            hoteAvance_ms(pas_ms);
+            sm.update();
+        }
+    }
+
+    uint32_t occurrences(const char* texte)
+    {
+        for (int i = 0; i < 8; i++) journal.vidange();
+        const std::string& sortie = hoteSerieSortie();
+        uint32_t n = 0;
+        for (size_t p = sortie.find(texte); p != std::string::npos; p = sortie.find(texte, p + 1)) n++;
+        return n;
+    }
+};
+
+TEST(urgence_entree_une_fois)
+{
+    // Passages rapprochés (1 ms) : l'ancienne fenêtre de 50 ms
+    // rejouait l'entrée une cinquantaine de fois
+    Banc b;
+    b.sm.setEmergency(EmergencyState::LEAK);
+    b.sm.update();
+    VERIFIE(b.sm.getCurrentState() == FishState::EMERGENCY);
+    VERIFIE(b.motor.ballastVerrouille());
+    uint32_t ecritures = hoteServo(SERVO_BALLAST).ecritures;
+
+    b.tourne(200, 1);
+    VERIFIE_EGAL(hoteServo(SERVO_BALLAST).ecritures, ecritures);
+    VERIFIE_EGAL(b.occurrences("=== EMERGENCY ==="), 1u);
+    VERIFIE_EGAL(b.occurrences("Cause: LEAK"), 1u);
+}
+
+TEST(urgence_entree_meme_a_cadence_lente)
+{
+    // Premier passage plus de 50 ms après la transition : l'entrée a lieu
+    Banc b;
+    b.sm.setEmergency(EmergencyState::BATTERY);
+    hoteAvance_ms(100);
+    b.sm.update();
+    b.tourne(500, 100);
+    VERIFIE(b.motor.ballastVerrouille());
+    VERIFIE_EGAL(b.occurrences("=== EMERGENCY ==="), 1u);
+}
+
+TEST(entree_descente_une_fois)
+{
+    // Profondeur jamais publiée : la descente dure, son entrée ne se
+    // rejoue pas
+    Banc b;
+    b.sm.startMission();
+    b.tourne(500, 1);
+    VERIFIE(b.sm.getCurrentState() == FishState::DESCENDING);
+    VERIFIE_EGAL(b.occurrences("DESCENTE vers"), 1u);
+}
+
+TEST(fin_de_mission_sans_profondeur)
+{
+    // Timeouts seuls : chaque état n'annonce son entrée qu'une fois
+    Banc b;
+    b.sm.setDescentTimeout(100);
+    b.sm.setMoveDuration(100);
+    b.sm.setTurnDuration(100);
+    b.sm.setAscentTimeout(100);
+    b.sm.startMission();
+    b.tourne(1000, 10);
+    VERIFIE(b.sm.isMissionFinished());
+    VERIFIE(!b.sm.isRunning());
+    VERIFIE_EGAL(b.occurrences("AVANCEMENT"), 1u);
+    VERIFIE_EGAL(b.occurrences("DEMI-TOUR"), 1u);
+    VERIFIE_EGAL(b.occurrences("REMONT"), 1u);
+    VERIFIE_EGAL(b.occurrences("MISSION TERMIN"), 1u);
+}
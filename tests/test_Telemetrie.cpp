@@ -0,0 +1,106 @@
+#include "Test.h"
+#include "Telemetrie.h"
+#include "Safety.h"
+
+// Objets du firmware sans begin() : instantané capteurs à zéro
+struct Banc
+{
+    CommandMotor motor;
+    Safety       safety;
+    Capteurs     capteurs;
+    StateMachine sm;
+    Telemetrie   telemetrie;
+
+    Banc()
+    : capteurs(0x28, 0x40, 0x41, 0x27, 0x76, 2200.0f)
+    , sm(motor, capteurs, safety)
+    {}
+
+    void ecrit(uint32_t n)
+    {
+        for (uint32_t i = 0; i < n; i++) {
+            telemetrie.update(capteurs, motor, sm);
+            hoteAvance_ms(telemetrie.getPeriode());
+        }
+    }
+};
+
+TEST(cadence)
+{
+    Banc* b = new Banc();
+    b->telemetrie.setPeriode(200);
+
+    b->telemetrie.update(b->capteurs, b->motor, b->sm);
+    hoteAvance_ms(199);
+    b->telemetrie.update(b->capteurs, b->motor, b->sm);
+    VERIFIE_EGAL(b->telemetrie.count(), 1);
+    hoteAvance_ms(1);
+    b->telemetrie.update(b->capteurs, b->motor, b->sm);
+    VERIFIE_EGAL(b->telemetrie.count(), 2);
+
+    // Retard de plusieurs périodes : un seul enregistrement, pas de rattrapage
+    hoteAvance_ms(1000);
+    b->telemetrie.update(b->capteurs, b->motor, b->sm);
+    b->telemetrie.update(b->capteurs, b->motor, b->sm);
+    VERIFIE_EGAL(b->telemetrie.count(), 3);
+    delete b;
+}
+
+TEST(anneau_plein_segments)
+{
+    Banc* b = new Banc();
+    const uint32_t N = Telemetrie::CAPACITE + 88;
+    b->ecrit(N);
+
+    VERIFIE_EGAL(b->telemetrie.count(), Telemetrie::CAPACITE);
+    VERIFIE_EGAL(b->telemetrie.total(), N);
+    VERIFIE_EGAL(b->telemetrie.premierIndex(), 88u);
+
+    // Du plus ancien gardé à la fin : deux segments contigus (rebouclage)
+    uint16_t n = 0;
+    const TelemetrieRecord* r = b->telemetrie.segment(88, N, n);
+    VERIFIE(r != nullptr);
+    VERIFIE_EGAL(n, Telemetrie::CAPACITE - 88);
+    // Enregistrement k écrit à k x 200 ms = 2k dixièmes de seconde
+    VERIFIE_EGAL(r[0].t_ds, 2 * 88);
+    VERIFIE_EGAL(r[n - 1].t_ds, 2 * (88 + n - 1));
+
+    uint32_t suite = 88 + n;
+    r = b->telemetrie.segment(suite, N, n);
+    VERIFIE_EGAL(n, 88);
+    VERIFIE_EGAL(r[0].t_ds, 2 * suite);
+    VERIFIE_EGAL(r[n - 1].t_ds, 2 * (N - 1));
+
+    VERIFIE(b->telemetrie.segment(N, N, n) == nullptr);
+    VERIFIE_EGAL(n, 0);
+    delete b;
+}
+
+TEST(index_ecrase_lu_a_sa_place)
+{
+    Banc* b = new Banc();
+    b->ecrit(Telemetrie::CAPACITE + 10);
+
+    // Index 3 écrasé par 3 + CAPACITE : c'est lui qui est rendu
+    uint16_t n = 0;
+    const TelemetrieRecord* r = b->telemetrie.segment(3, 4, n);
+    VERIFIE_EGAL(n, 1);
+    VERIFIE_EGAL(r[0].t_ds, 2 * (3 + Telemetrie::CAPACITE));
+    delete b;
+}
+
+TEST(entete)
+{
+    Banc* b = new Banc();
+    b->telemetrie.setPeriode(100);
+    b->ecrit(5);
+
+    TelemetrieEntete h;
+    b->telemetrie.fillEntete(h);
+    VERIFIE(memcmp(h.magic, "PTLM", 4) == 0);
+    VERIFIE_EGAL(h.tailleRecord, sizeof(TelemetrieRecord));
+    VERIFIE_EGAL(h.count, 5);
+    VERIFIE_EGAL(h.periode_ms, 100);
+    VERIFIE_EGAL(h.maintenant_ms, 500u);
+    delete b;
+}